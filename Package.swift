@@ -206,6 +206,8 @@ let package = Package(
         "src/core/client_channel/load_balanced_call_destination.h",
         "src/core/client_channel/local_subchannel_pool.cc",
         "src/core/client_channel/local_subchannel_pool.h",
+        "src/core/client_channel/retry_buffer_budget.cc",
+        "src/core/client_channel/retry_buffer_budget.h",
         "src/core/client_channel/retry_filter.cc",
         "src/core/client_channel/retry_filter.h",
         "src/core/client_channel/retry_filter_legacy_call_data.cc",
@@ -474,6 +476,8 @@ let package = Package(
         "src/core/ext/transport/chttp2/transport/writable_streams.h",
         "src/core/ext/transport/chttp2/transport/write_cycle.cc",
         "src/core/ext/transport/chttp2/transport/write_cycle.h",
+        "src/core/ext/transport/chttp2/transport/write_scheduler.cc",
+        "src/core/ext/transport/chttp2/transport/write_scheduler.h",
         "src/core/ext/transport/chttp2/transport/write_size_policy.cc",
         "src/core/ext/transport/chttp2/transport/write_size_policy.h",
         "src/core/ext/transport/chttp2/transport/writing.cc",
@@ -1467,6 +1471,7 @@ let package = Package(
         "src/core/lib/event_engine/extensions/receive_coalescing_extension.h",
         "src/core/lib/event_engine/extensions/supports_fd.h",
         "src/core/lib/event_engine/extensions/supports_win_sockets.h",
+        "src/core/lib/event_engine/extensions/tcp_info_sampling.h",
         "src/core/lib/event_engine/extensions/tcp_trace.h",
         "src/core/lib/event_engine/grpc_polled_fd.h",
         "src/core/lib/event_engine/handle_containers.h",
@@ -1505,6 +1510,8 @@ let package = Package(
         "src/core/lib/event_engine/posix_engine/posix_write_event_sink.cc",
         "src/core/lib/event_engine/posix_engine/posix_write_event_sink.h",
         "src/core/lib/event_engine/posix_engine/set_socket_dualstack.cc",
+        "src/core/lib/event_engine/posix_engine/tcp_info_sampler.cc",
+        "src/core/lib/event_engine/posix_engine/tcp_info_sampler.h",
         "src/core/lib/event_engine/posix_engine/tcp_socket_utils.cc",
         "src/core/lib/event_engine/posix_engine/tcp_socket_utils.h",
         "src/core/lib/event_engine/posix_engine/timer.cc",
@@ -1842,6 +1849,8 @@ let package = Package(
         "src/core/lib/transport/promise_endpoint.h",
         "src/core/lib/transport/status_conversion.cc",
         "src/core/lib/transport/status_conversion.h",
+        "src/core/lib/transport/tcp_info_bdp_estimator.cc",
+        "src/core/lib/transport/tcp_info_bdp_estimator.h",
         "src/core/lib/transport/timeout_encoding.cc",
         "src/core/lib/transport/timeout_encoding.h",
         "src/core/lib/transport/transport.cc",
@@ -1877,16 +1886,20 @@ let package = Package(
         "src/core/load_balancing/lb_policy_factory.h",
         "src/core/load_balancing/lb_policy_registry.cc",
         "src/core/load_balancing/lb_policy_registry.h",
+        "src/core/load_balancing/least_request/least_request.cc",
         "src/core/load_balancing/oob_backend_metric.cc",
         "src/core/load_balancing/oob_backend_metric.h",
         "src/core/load_balancing/oob_backend_metric_internal.h",
         "src/core/load_balancing/outlier_detection/outlier_detection.cc",
         "src/core/load_balancing/outlier_detection/outlier_detection.h",
+        "src/core/load_balancing/peak_ewma/peak_ewma.cc",
         "src/core/load_balancing/pick_first/pick_first.cc",
         "src/core/load_balancing/pick_first/pick_first.h",
         "src/core/load_balancing/priority/priority.cc",
         "src/core/load_balancing/ring_hash/ring_hash.cc",
         "src/core/load_balancing/ring_hash/ring_hash.h",
+        "src/core/load_balancing/ring_hash/ring_hash_lookup.cc",
+        "src/core/load_balancing/ring_hash/ring_hash_lookup.h",
         "src/core/load_balancing/rls/rls.cc",
         "src/core/load_balancing/rls/rls.h",
         "src/core/load_balancing/round_robin/round_robin.cc",
@@ -1971,6 +1984,8 @@ let package = Package(
         "src/core/service_config/service_config_impl.h",
         "src/core/service_config/service_config_parser.cc",
         "src/core/service_config/service_config_parser.h",
+        "src/core/telemetry/call_trace_sampler.cc",
+        "src/core/telemetry/call_trace_sampler.h",
         "src/core/telemetry/call_tracer.cc",
         "src/core/telemetry/call_tracer.h",
         "src/core/telemetry/context_list_entry.cc",
@@ -1982,6 +1997,7 @@ let package = Package(
         "src/core/telemetry/histogram_view.h",
         "src/core/telemetry/instrument.cc",
         "src/core/telemetry/instrument.h",
+        "src/core/telemetry/latency_sketch.h",
         "src/core/telemetry/metrics.cc",
         "src/core/telemetry/metrics.h",
         "src/core/telemetry/stats.cc",
@@ -2043,7 +2059,9 @@ let package = Package(
         "src/core/tsi/local_transport_security.cc",
         "src/core/tsi/local_transport_security.h",
         "src/core/tsi/ssl/key_logging/ssl_key_logging.cc",
+        "src/core/tsi/ssl/ktls/ssl_ktls.cc",
         "src/core/tsi/ssl/key_logging/ssl_key_logging.h",
+        "src/core/tsi/ssl/ktls/ssl_ktls.h",
         "src/core/tsi/ssl/session_cache/ssl_session.h",
         "src/core/tsi/ssl/session_cache/ssl_session_boringssl.cc",
         "src/core/tsi/ssl/session_cache/ssl_session_cache.cc",
@@ -77,6 +77,7 @@ if test "$PHP_GRPC" != "no"; then
     src/core/client_channel/lb_metadata.cc \
     src/core/client_channel/load_balanced_call_destination.cc \
     src/core/client_channel/local_subchannel_pool.cc \
+    src/core/client_channel/retry_buffer_budget.cc \
     src/core/client_channel/retry_filter.cc \
     src/core/client_channel/retry_filter_legacy_call_data.cc \
     src/core/client_channel/retry_interceptor.cc \
@@ -208,6 +209,7 @@ if test "$PHP_GRPC" != "no"; then
     src/core/ext/transport/chttp2/transport/transport_common.cc \
     src/core/ext/transport/chttp2/transport/varint.cc \
     src/core/ext/transport/chttp2/transport/write_cycle.cc \
+    src/core/ext/transport/chttp2/transport/write_scheduler.cc \
     src/core/ext/transport/chttp2/transport/write_size_policy.cc \
     src/core/ext/transport/chttp2/transport/writing.cc \
     src/core/ext/transport/inproc/inproc_transport.cc \
@@ -621,6 +623,7 @@ if test "$PHP_GRPC" != "no"; then
     src/core/lib/event_engine/posix_engine/posix_interface_windows.cc \
     src/core/lib/event_engine/posix_engine/posix_write_event_sink.cc \
     src/core/lib/event_engine/posix_engine/set_socket_dualstack.cc \
+    src/core/lib/event_engine/posix_engine/tcp_info_sampler.cc \
     src/core/lib/event_engine/posix_engine/tcp_socket_utils.cc \
     src/core/lib/event_engine/posix_engine/timer.cc \
     src/core/lib/event_engine/posix_engine/timer_heap.cc \
@@ -776,6 +779,7 @@ if test "$PHP_GRPC" != "no"; then
     src/core/lib/transport/error_utils.cc \
     src/core/lib/transport/promise_endpoint.cc \
     src/core/lib/transport/status_conversion.cc \
+    src/core/lib/transport/tcp_info_bdp_estimator.cc \
     src/core/lib/transport/timeout_encoding.cc \
     src/core/lib/transport/transport.cc \
     src/core/lib/transport/transport_op_string.cc \
@@ -791,11 +795,14 @@ if test "$PHP_GRPC" != "no"; then
     src/core/load_balancing/health_check_client.cc \
     src/core/load_balancing/lb_policy.cc \
     src/core/load_balancing/lb_policy_registry.cc \
+    src/core/load_balancing/least_request/least_request.cc \
     src/core/load_balancing/oob_backend_metric.cc \
     src/core/load_balancing/outlier_detection/outlier_detection.cc \
+    src/core/load_balancing/peak_ewma/peak_ewma.cc \
     src/core/load_balancing/pick_first/pick_first.cc \
     src/core/load_balancing/priority/priority.cc \
     src/core/load_balancing/ring_hash/ring_hash.cc \
+    src/core/load_balancing/ring_hash/ring_hash_lookup.cc \
     src/core/load_balancing/rls/rls.cc \
     src/core/load_balancing/round_robin/round_robin.cc \
     src/core/load_balancing/weighted_round_robin/static_stride_scheduler.cc \
@@ -839,6 +846,7 @@ if test "$PHP_GRPC" != "no"; then
     src/core/service_config/service_config_channel_arg_filter.cc \
     src/core/service_config/service_config_impl.cc \
     src/core/service_config/service_config_parser.cc \
+    src/core/telemetry/call_trace_sampler.cc \
     src/core/telemetry/call_tracer.cc \
     src/core/telemetry/context_list_entry.cc \
     src/core/telemetry/default_tcp_tracer.cc \
@@ -874,6 +882,7 @@ if test "$PHP_GRPC" != "no"; then
     src/core/tsi/fake_transport_security.cc \
     src/core/tsi/local_transport_security.cc \
     src/core/tsi/ssl/key_logging/ssl_key_logging.cc \
+    src/core/tsi/ssl/ktls/ssl_ktls.cc \
     src/core/tsi/ssl/session_cache/ssl_session_boringssl.cc \
     src/core/tsi/ssl/session_cache/ssl_session_cache.cc \
     src/core/tsi/ssl/session_cache/ssl_session_openssl.cc \
@@ -1719,7 +1728,9 @@ if test "$PHP_GRPC" != "no"; then
   PHP_ADD_BUILD_DIR($ext_builddir/src/core/lib/transport)
   PHP_ADD_BUILD_DIR($ext_builddir/src/core/load_balancing)
   PHP_ADD_BUILD_DIR($ext_builddir/src/core/load_balancing/grpclb)
+  PHP_ADD_BUILD_DIR($ext_builddir/src/core/load_balancing/least_request)
   PHP_ADD_BUILD_DIR($ext_builddir/src/core/load_balancing/outlier_detection)
+  PHP_ADD_BUILD_DIR($ext_builddir/src/core/load_balancing/peak_ewma)
   PHP_ADD_BUILD_DIR($ext_builddir/src/core/load_balancing/pick_first)
   PHP_ADD_BUILD_DIR($ext_builddir/src/core/load_balancing/priority)
   PHP_ADD_BUILD_DIR($ext_builddir/src/core/load_balancing/ring_hash)
@@ -1749,6 +1760,7 @@ if test "$PHP_GRPC" != "no"; then
   PHP_ADD_BUILD_DIR($ext_builddir/src/core/tsi/alts/handshaker)
   PHP_ADD_BUILD_DIR($ext_builddir/src/core/tsi/alts/zero_copy_frame_protector)
   PHP_ADD_BUILD_DIR($ext_builddir/src/core/tsi/ssl/key_logging)
+  PHP_ADD_BUILD_DIR($ext_builddir/src/core/tsi/ssl/ktls)
   PHP_ADD_BUILD_DIR($ext_builddir/src/core/tsi/ssl/session_cache)
   PHP_ADD_BUILD_DIR($ext_builddir/src/core/util)
   PHP_ADD_BUILD_DIR($ext_builddir/src/core/util/http_client)
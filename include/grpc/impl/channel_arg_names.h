@@ -98,6 +98,12 @@
 /** Should BDP probing be performed?
     Boolean valued. Defaults to true(enabled). */
 #define GRPC_ARG_HTTP2_BDP_PROBE "grpc.http2.bdp_probe"
+/** EXPERIMENTAL. How BDP probing estimates the bandwidth-delay product.
+    String valued: "ping" (the default) times BDP pings, "tcp_info" takes
+    the minimum round trip time that the kernel reports in TCP_INFO, and
+    the bandwidth from the bytes received, and sends no pings. "tcp_info"
+    falls back to "ping" on endpoints that do not report TCP_INFO. */
+#define GRPC_ARG_HTTP2_BDP_ESTIMATOR "grpc.http2.bdp_estimator"
 /** (DEPRECATED) Does not have any effect.
     Earlier, this arg configured the minimum time between successive ping frames
     without receiving any data/header frame, Int valued, milliseconds. This put
@@ -153,6 +159,45 @@
     GRPC_WRITE_BUFFER_HINT is set? This is an upper bound
   * Integer valued, bytes. Defaults to 65535 bytes. */
 #define GRPC_ARG_HTTP2_WRITE_BUFFER_SIZE "grpc.http2.write_buffer_size"
+/** EXPERIMENTAL. How an HTTP/2 connection shares writes between streams.
+    String valued: "fifo" (the default) lets each stream send as much as
+    flow control allows when its turn comes, "drr" serves streams by deficit
+    round robin so that one stream cannot hold up the others for more than
+    GRPC_ARG_HTTP2_WRITE_SCHEDULER_QUANTUM bytes. */
+#define GRPC_ARG_HTTP2_WRITE_SCHEDULER "grpc.http2.write_scheduler"
+/** EXPERIMENTAL. Bytes a stream of weight 1 may send per turn when
+    GRPC_ARG_HTTP2_WRITE_SCHEDULER is "drr". Int valued, defaults to 16384. */
+#define GRPC_ARG_HTTP2_WRITE_SCHEDULER_QUANTUM \
+  "grpc.http2.write_scheduler_quantum"
+/** EXPERIMENTAL. Name of a metadata key whose value, an integer from 1 to
+    64, sets a stream's weight when GRPC_ARG_HTTP2_WRITE_SCHEDULER is "drr".
+    The weight is read from the initial metadata that the stream sends.
+    Streams without it have weight 1. */
+#define GRPC_ARG_HTTP2_WRITE_WEIGHT_METADATA_KEY \
+  "grpc.http2.write_weight_metadata_key"
+/** EXPERIMENTAL. Longest an HTTP/2 connection may hold back a write so
+    that frames from several streams go out together. A held back write
+    waits only for work the connection already has queued, never on a timer,
+    and starts as soon as that work adds nothing to it. Connections stop
+    holding back writes for a while when it gathers nothing, and writes are
+    never held back on a connection that has been idle. Int valued,
+    microseconds, 0 to 1000. Defaults to 0 (write immediately). */
+#define GRPC_ARG_HTTP2_WRITE_COALESCING_DELAY_US \
+  "grpc.http2.write_coalescing_delay_us"
+/** EXPERIMENTAL. Once this many bytes of messages are waiting, a write held
+    back by GRPC_ARG_HTTP2_WRITE_COALESCING_DELAY_US starts without waiting
+    for more. Int valued, bytes. Defaults to 16384. */
+#define GRPC_ARG_HTTP2_WRITE_COALESCING_BYTES \
+  "grpc.http2.write_coalescing_bytes"
+/** EXPERIMENTAL. Once an http2 connection has had no streams for this long,
+    it gives back the memory it keeps for traffic: it asks the peer to stop
+    using the HPACK table it decodes with, drops its own HPACK caches, and
+    releases spare write buffers. The next stream restores the HPACK table
+    size. The same trimming happens regardless of this setting when the
+    resource quota runs short. Int valued, milliseconds. Defaults to INT_MAX
+    (never on idle alone). */
+#define GRPC_ARG_HTTP2_IDLE_MEMORY_TRIM_TIMEOUT_MS \
+  "grpc.http2.idle_memory_trim_timeout_ms"
 /** Should we allow receipt of true-binary data on http2 connections?
     Defaults to on (1) */
 #define GRPC_ARG_HTTP2_ENABLE_TRUE_BINARY "grpc.http2.true_binary"
@@ -355,15 +400,16 @@
     retries are enabled when they are configured via the service config.
     For details, see:
       https://github.com/grpc/proposal/blob/master/A6-client-retries.md
-    NOTE: Hedging functionality is not yet implemented, so those
-          fields in the service config will currently be ignored.  See
-          also the GRPC_ARG_EXPERIMENTAL_ENABLE_HEDGING arg below.
+    NOTE: Hedging is only implemented by the promise-based client
+          channel, and only when GRPC_ARG_EXPERIMENTAL_ENABLE_HEDGING
+          (below) is set; otherwise those fields in the service config
+          are ignored.
  */
 #define GRPC_ARG_ENABLE_RETRIES "grpc.enable_retries"
 /** Enables hedging functionality, as described in:
       https://github.com/grpc/proposal/blob/master/A6-client-retries.md
-    Default is currently false, since this functionality is not yet
-    fully implemented.
+    Default is currently false, since this functionality is only
+    implemented by the promise-based client channel.
     NOTE: This channel arg is experimental and will eventually be removed.
           Once hedging functionality has been implemented and proves stable,
           this arg will be removed, and the hedging functionality will
@@ -371,6 +417,12 @@
 #define GRPC_ARG_EXPERIMENTAL_ENABLE_HEDGING "grpc.experimental.enable_hedging"
 /** Per-RPC retry buffer size, in bytes. Default is 256 KiB. */
 #define GRPC_ARG_PER_RPC_RETRY_BUFFER_SIZE "grpc.per_rpc_retry_buffer_size"
+/** EXPERIMENTAL: Retry buffer size shared by all RPCs on a channel, in
+    bytes.  An RPC that has buffered GRPC_ARG_PER_RPC_RETRY_BUFFER_SIZE
+    bytes keeps buffering from this shared budget instead of giving up on
+    retries, as long as the channel's resource quota is not under memory
+    pressure.  Buffered messages are not copied.  Default is 0. */
+#define GRPC_ARG_RETRY_BUFFER_CHANNEL_SIZE "grpc.retry_buffer_channel_size"
 /** Channel arg that carries the bridged objective c object for custom metrics
  * logging filter. */
 #define GRPC_ARG_MOBILE_LOG_CONTEXT "grpc.mobile_log_context"
@@ -414,6 +466,13 @@
  *  capped at this value.  Defaults to 10. */
 #define GRPC_ARG_MAX_CONNECTIONS_PER_SUBCHANNEL_CAP \
   "grpc.max_connections_per_subchannel_cap"
+/** EXPERIMENTAL. Percentage (1-100) of MAX_CONCURRENT_STREAMS in use on
+ *  every connection of a subchannel at which the subchannel starts another
+ *  connection, up to the max connections per subchannel. Int valued.
+ *  Defaults to 100, which adds a connection only once the existing ones are
+ *  full. */
+#define GRPC_ARG_SUBCHANNEL_CONNECTION_SCALE_UP_PERCENT \
+  "grpc.subchannel_connection_scale_up_percent"
 /** If set, determines an upper bound on the number of milliseconds that the
  * c-ares based DNS resolver will wait on queries before cancelling them.
  * The default value is 120,000ms. Setting this to "0" will disable the
@@ -468,6 +527,14 @@
 #define GRPC_ARG_TCP_TRACING_ENABLED "grpc.tcp_tracing_enabled"
 /* Enable tracing full buffer payloads for TCP telemetry. */
 #define GRPC_ARG_TCP_TRACE_FULL_BUFFER "grpc.experimental.tcp_trace_full_buffer"
+/** EXPERIMENTAL. If positive, read each connection's TCP_INFO this often, in
+    milliseconds. The round trip time, congestion window, delivery rate,
+    retransmits and send-limited time are recorded as metrics labelled by
+    target, and the latest sample is reported in the connection's channelz
+    socket. Int valued, defaults to 0 (disabled). Only posix endpoints on
+    Linux support this. */
+#define GRPC_ARG_TCP_INFO_SAMPLE_INTERVAL_MS \
+  "grpc.experimental.tcp_info_sample_interval_ms"
 /** Server config fetcher. */
 #define GRPC_ARG_SERVER_CONFIG_FETCHER "grpc.server_config_fetcher"
 /** Set the maximum size of a security frame that can be received on a HTTP2
@@ -175,6 +175,14 @@ class OpenTelemetryPluginBuilder {
       std::unique_ptr<opentelemetry::context::propagation::TextMapPropagator>
           text_map_propagator);
   /// EXPERIMENTAL API
+  /// Traces only a sample of calls, deciding when each call starts, so that
+  /// tracing uses no more than \a cpu_budget of one CPU (e.g. 0.01 for 1%).
+  /// Only calls that start a trace are sampled; a call with a parent span,
+  /// local or propagated from the peer, follows the parent's decision.
+  /// Calls that are not sampled create no spans. If not called, every call is
+  /// traced.
+  OpenTelemetryPluginBuilder& SetTracingCpuBudget(double cpu_budget);
+  /// EXPERIMENTAL API
   /// Returns a TextMapPropagator that uses gRPC's "grpc-trace-bin" metadata to
   /// propagate span contexts.
   static std::unique_ptr<opentelemetry::context::propagation::TextMapPropagator>
@@ -85,6 +85,7 @@ class ClientCall final
 
   void Orphaned() override {
     SourceDestructing();
+    ReportLatency();
     if (!saw_trailing_metadata_.load(std::memory_order_relaxed)) {
       CancelWithError(absl::CancelledError());
     }
@@ -111,6 +111,7 @@ class ServerCall final : public Call, public DualRefCounted<ServerCall> {
 
   void Orphaned() override {
     SourceDestructing();
+    ReportLatency();
     if (!saw_was_cancelled_.load(std::memory_order_relaxed)) {
       CancelWithError(absl::CancelledError());
     }
@@ -59,11 +59,25 @@ ChannelzRegistry::InternalGetAllEntities() {
       std::numeric_limits<size_t>::max()));
 }
 
+void ChannelzRegistry::InternalForEachEntity(
+    absl::FunctionRef<void(WeakRefCountedPtr<BaseNode>)> callback) {
+  auto all = [](const BaseNode*) { return true; };
+  const intptr_t end_node = NumberNodes(all);
+  intptr_t start_node = 0;
+  while (true) {
+    auto [nodes, end] =
+        CollectNodes(start_node, end_node, all, kMaxNodesPerLock);
+    if (!nodes.empty()) start_node = nodes.back()->uuid() + 1;
+    for (auto& node : nodes) callback(std::move(node));
+    if (end) return;
+  }
+}
+
 void ChannelzRegistry::InternalLogAllEntities() {
-  for (const auto& p : InternalGetAllEntities()) {
-    std::string json = p->RenderJsonString();
+  InternalForEachEntity([](WeakRefCountedPtr<BaseNode> node) {
+    std::string json = node->RenderJsonString();
     LOG(INFO) << json;
-  }
+  });
 }
 
 void ChannelzRegistry::InternalRegister(BaseNode* node) {
@@ -147,71 +161,83 @@ std::tuple<std::vector<WeakRefCountedPtr<BaseNode>>, bool>
 ChannelzRegistry::QueryNodes(
     intptr_t start_node, absl::FunctionRef<bool(const BaseNode*)> discriminator,
     size_t max_results) {
+  const intptr_t end_node = NumberNodes(discriminator);
+  return CollectNodes(start_node, end_node, discriminator, max_results);
+}
+
+intptr_t ChannelzRegistry::NumberNodes(
+    absl::FunctionRef<bool(const BaseNode*)> discriminator) {
   // Mitigate drain hotspotting by randomizing the drain order each query.
   std::vector<size_t> nursery_visitation_order;
   for (size_t i = 0; i < kNodeShards; ++i) {
     nursery_visitation_order.push_back(i);
   }
   absl::c_shuffle(nursery_visitation_order, SharedBitGen());
-  // In the iteration below, even once we have max_results nodes, we need
-  // to find the next node in order to know if we've hit the end.  If we get
-  // through the loop without returning, then we return end=true.  But if we
-  // find a node to add after we already have max_results nodes, then we
-  // return with end=false before exiting the loop.  However, in the latter
-  // case, we will have already increased the ref count of the next node,
-  // so we need to unref it, but we can't do that while holding the lock.
-  // So instead, we store it in node_after_end, which will be unreffed
-  // after releasing the lock.
-  WeakRefCountedPtr<BaseNode> node_after_end;
-  std::vector<WeakRefCountedPtr<BaseNode>> result;
-  MutexLock index_lock(&index_mu_);
-  for (auto it = index_.lower_bound(start_node); it != index_.end(); ++it) {
-    BaseNode* node = it->second;
-    if (!discriminator(node)) continue;
-    auto node_ref = node->WeakRefIfNonZero();
-    if (node_ref == nullptr) continue;
-    if (result.size() == max_results) {
-      node_after_end = std::move(node_ref);
-      return std::tuple(std::move(result), false);
-    }
-    result.emplace_back(std::move(node_ref));
-  }
+  // Refs taken to check that nodes are still alive; these must be dropped
+  // outside the locks.
+  std::vector<WeakRefCountedPtr<BaseNode>> refs;
   for (auto nursery_index : nursery_visitation_order) {
-    NodeShard& node_shard = node_shards_[nursery_index];
-    MutexLock shard_lock(&node_shard.mu);
-    for (auto [nursery, numbered] :
-         {std::pair(&node_shard.nursery, &node_shard.numbered),
-          std::pair(&node_shard.orphaned, &node_shard.orphaned_numbered)}) {
-      if (nursery->head == nullptr) continue;
-      BaseNode* n = nursery->head;
-      while (n != nullptr) {
-        if (!discriminator(n)) {
-          n = n->next_;
-          continue;
-        }
-        auto node_ref = n->WeakRefIfNonZero();
-        if (node_ref == nullptr) {
-          n = n->next_;
-          continue;
-        }
-        BaseNode* next = n->next_;
-        nursery->Remove(n);
-        numbered->AddToHead(n);
-        n->uuid_ = uuid_generator_;
-        ++uuid_generator_;
-        index_.emplace(n->uuid_, n);
-        if (n->uuid_ >= start_node) {
-          if (result.size() == max_results) {
-            node_after_end = std::move(node_ref);
-            return std::tuple(std::move(result), false);
+    {
+      NodeShard& node_shard = node_shards_[nursery_index];
+      MutexLock index_lock(&index_mu_);
+      MutexLock shard_lock(&node_shard.mu);
+      for (auto [nursery, numbered] :
+           {std::pair(&node_shard.nursery, &node_shard.numbered),
+            std::pair(&node_shard.orphaned, &node_shard.orphaned_numbered)}) {
+        BaseNode* n = nursery->head;
+        while (n != nullptr) {
+          BaseNode* next = n->next_;
+          if (discriminator(n)) {
+            auto node_ref = n->WeakRefIfNonZero();
+            if (node_ref != nullptr) {
+              nursery->Remove(n);
+              numbered->AddToHead(n);
+              n->uuid_ = uuid_generator_;
+              ++uuid_generator_;
+              index_.emplace(n->uuid_, n);
+              refs.emplace_back(std::move(node_ref));
+            }
           }
-          result.emplace_back(std::move(node_ref));
+          n = next;
         }
-        n = next;
       }
     }
+    refs.clear();
+  }
+  MutexLock index_lock(&index_mu_);
+  return uuid_generator_;
+}
+
+std::tuple<std::vector<WeakRefCountedPtr<BaseNode>>, bool>
+ChannelzRegistry::CollectNodes(
+    intptr_t start_node, intptr_t end_node,
+    absl::FunctionRef<bool(const BaseNode*)> discriminator,
+    size_t max_results) {
+  std::vector<WeakRefCountedPtr<BaseNode>> result;
+  // Even once we have max_results nodes, we need to find the next node in
+  // order to know if we've hit the end.  Its ref can't be dropped while
+  // holding the lock, so it's kept here until we return.
+  WeakRefCountedPtr<BaseNode> node_after_end;
+  while (start_node < end_node) {
+    MutexLock index_lock(&index_mu_);
+    auto it = index_.lower_bound(start_node);
+    for (size_t visited = 0; visited < kMaxNodesPerLock; ++visited, ++it) {
+      if (it == index_.end() || it->first >= end_node) {
+        return std::tuple(std::move(result), true);
+      }
+      BaseNode* node = it->second;
+      if (!discriminator(node)) continue;
+      auto node_ref = node->WeakRefIfNonZero();
+      if (node_ref == nullptr) continue;
+      if (result.size() == max_results) {
+        node_after_end = std::move(node_ref);
+        return std::tuple(std::move(result), false);
+      }
+      result.emplace_back(std::move(node_ref));
+    }
+    // Let registration and unregistration in before the next batch.
+    start_node = it == index_.end() ? end_node : it->first;
   }
-  CHECK(node_after_end == nullptr);
   return std::tuple(std::move(result), true);
 }
 
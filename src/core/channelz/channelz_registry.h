@@ -145,6 +145,14 @@ class ChannelzRegistry final {
     return Default()->InternalGetAllEntities();
   }
 
+  // Calls `callback` for each entity, in uuid order, without holding any
+  // registry lock during the call and without collecting every entity
+  // first.  Entities registered after the walk starts are not visited.
+  static void ForEachEntity(
+      absl::FunctionRef<void(WeakRefCountedPtr<BaseNode>)> callback) {
+    Default()->InternalForEachEntity(callback);
+  }
+
   // Test only helper function to reset to initial state.
   static void TestOnlyReset();
 
@@ -229,6 +237,22 @@ class ChannelzRegistry final {
       absl::FunctionRef<bool(const BaseNode*)> discriminator,
       size_t max_results);
 
+  // Queries run in two phases, neither of which holds a lock for longer than
+  // it takes to handle one shard or kMaxNodesPerLock nodes, so that
+  // registration and unregistration never wait on a whole query.
+  //
+  // First, numbers the nodes that pass `discriminator` and have no uuid yet,
+  // one shard at a time.  Returns the next uuid to be assigned: nodes below
+  // it are the snapshot that the second phase reads.
+  intptr_t NumberNodes(absl::FunctionRef<bool(const BaseNode*)> discriminator);
+  // Second, collects numbered nodes with uuids in [start_node, end_node) that
+  // pass `discriminator`.  Returns true as the second element if there are no
+  // more.
+  std::tuple<std::vector<WeakRefCountedPtr<BaseNode>>, bool> CollectNodes(
+      intptr_t start_node, intptr_t end_node,
+      absl::FunctionRef<bool(const BaseNode*)> discriminator,
+      size_t max_results);
+
   std::tuple<std::vector<WeakRefCountedPtr<BaseNode>>, bool>
   InternalGetChildren(const BaseNode* parent, intptr_t start_node,
                       size_t max_results) {
@@ -322,8 +346,12 @@ class ChannelzRegistry final {
 
   void InternalLogAllEntities();
   std::vector<WeakRefCountedPtr<BaseNode>> InternalGetAllEntities();
+  void InternalForEachEntity(
+      absl::FunctionRef<void(WeakRefCountedPtr<BaseNode>)> callback);
 
   static constexpr size_t kNodeShards = 63;
+  // The most index entries a query visits per acquisition of index_mu_.
+  static constexpr size_t kMaxNodesPerLock = 256;
   size_t NodeShardIndex(BaseNode* node) {
     return absl::HashOf(node) % kNodeShards;
   }
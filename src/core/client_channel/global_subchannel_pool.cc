@@ -20,6 +20,7 @@
 
 #include <grpc/support/port_platform.h>
 
+#include <thread>
 #include <utility>
 
 #include "src/core/client_channel/subchannel.h"
@@ -33,56 +34,121 @@ RefCountedPtr<GlobalSubchannelPool> GlobalSubchannelPool::instance() {
 
 RefCountedPtr<Subchannel> GlobalSubchannelPool::RegisterSubchannel(
     const SubchannelKey& key, RefCountedPtr<Subchannel> constructed) {
-  auto shard_index = ShardIndex(key);
-  auto& write_shard = write_shards_[shard_index];
-  auto& read_shard = read_shards_[shard_index];
-  SubchannelMap old_map1;
-  SubchannelMap old_map2;
-  MutexLock lock(&write_shard.mu);
-  auto* existing = write_shard.map.Lookup(key);
-  if (existing != nullptr) {
-    auto existing_ref = (*existing)->RefIfNonZero();
-    if (existing_ref != nullptr) return existing_ref;
-  }
-  old_map1 = std::exchange(write_shard.map,
-                           write_shard.map.Add(key, constructed->WeakRef()));
-  MutexLock lock_read(&read_shard.mu);
-  old_map2 = std::exchange(read_shard.map, write_shard.map);
-  return constructed;
+  return shards_[key.Hash() % kShards].Register(key, std::move(constructed));
 }
 
 void GlobalSubchannelPool::UnregisterSubchannel(const SubchannelKey& key,
                                                 Subchannel* subchannel) {
-  auto shard_index = ShardIndex(key);
-  auto& write_shard = write_shards_[shard_index];
-  auto& read_shard = read_shards_[shard_index];
-  SubchannelMap old_map1;
-  SubchannelMap old_map2;
-  MutexLock lock(&write_shard.mu);
-  auto* existing = write_shard.map.Lookup(key);
-  // delete only if key hasn't been re-registered to a different subchannel
-  // between strong-unreffing and unregistration of subchannel.
-  if (existing == nullptr || existing->get() != subchannel) return;
-  old_map1 = std::exchange(write_shard.map, write_shard.map.Remove(key));
-  MutexLock lock_read(&read_shard.mu);
-  old_map2 = std::exchange(read_shard.map, write_shard.map);
+  shards_[key.Hash() % kShards].Unregister(key, subchannel);
 }
 
 RefCountedPtr<Subchannel> GlobalSubchannelPool::FindSubchannel(
     const SubchannelKey& key) {
-  auto shard_index = ShardIndex(key);
-  auto& read_shard = read_shards_[shard_index];
-  read_shard.mu.Lock();
-  auto map = read_shard.map;
-  read_shard.mu.Unlock();
-  auto* subchannel = map.Lookup(key);
-  if (subchannel == nullptr) return nullptr;
-  return (*subchannel)->RefIfNonZero();
+  return shards_[key.Hash() % kShards].Find(key);
+}
+
+//
+// GlobalSubchannelPool::Shard
+//
+
+namespace {
+
+template <typename Bucket>
+auto FindEntry(Bucket* bucket, const SubchannelKey& key)
+    -> decltype(bucket->data()) {
+  if (bucket == nullptr) return nullptr;
+  for (auto& entry : *bucket) {
+    if (entry.key == key) return &entry;
+  }
+  return nullptr;
+}
+
+}  // namespace
+
+GlobalSubchannelPool::Shard::~Shard() {
+  for (auto& bucket : buckets_) delete bucket.load(std::memory_order_relaxed);
+}
+
+std::atomic<uint64_t>& GlobalSubchannelPool::Shard::StartRead() {
+  while (true) {
+    const uint64_t epoch = epoch_.load();
+    auto& readers = readers_[epoch & 1];
+    readers.fetch_add(1);
+    // If a writer bumped the epoch in the meantime, it may not have seen
+    // us in this count, so use the other one.
+    if (epoch_.load() == epoch) return readers;
+    readers.fetch_sub(1, std::memory_order_release);
+  }
+}
+
+RefCountedPtr<Subchannel> GlobalSubchannelPool::Shard::Find(
+    const SubchannelKey& key) {
+  auto& readers = StartRead();
+  RefCountedPtr<Subchannel> subchannel;
+  const Entry* entry =
+      FindEntry(BucketFor(key).load(std::memory_order_acquire), key);
+  if (entry != nullptr) subchannel = entry->subchannel->RefIfNonZero();
+  readers.fetch_sub(1, std::memory_order_release);
+  return subchannel;
 }
 
-size_t GlobalSubchannelPool::ShardIndex(const SubchannelKey& key) {
-  absl::string_view addr(key.address().addr, key.address().len);
-  return absl::HashOf(addr) % kShards;
+RefCountedPtr<Subchannel> GlobalSubchannelPool::Shard::Register(
+    const SubchannelKey& key, RefCountedPtr<Subchannel> constructed) {
+  std::unique_ptr<const Bucket> old_bucket;
+  MutexLock lock(&mu_);
+  auto& slot = BucketFor(key);
+  const Bucket* bucket = slot.load(std::memory_order_relaxed);
+  const Entry* entry = FindEntry(bucket, key);
+  if (entry != nullptr) {
+    auto existing_ref = entry->subchannel->RefIfNonZero();
+    if (existing_ref != nullptr) return existing_ref;
+  }
+  auto new_bucket = bucket == nullptr ? std::make_unique<Bucket>()
+                                      : std::make_unique<Bucket>(*bucket);
+  Entry* new_entry = FindEntry(new_bucket.get(), key);
+  if (new_entry != nullptr) {
+    new_entry->subchannel = constructed->WeakRef();
+  } else {
+    new_bucket->push_back(Entry{key, constructed->WeakRef()});
+  }
+  old_bucket = PublishLocked(slot, std::move(new_bucket));
+  return constructed;
+}
+
+void GlobalSubchannelPool::Shard::Unregister(const SubchannelKey& key,
+                                             Subchannel* subchannel) {
+  std::unique_ptr<const Bucket> old_bucket;
+  MutexLock lock(&mu_);
+  auto& slot = BucketFor(key);
+  const Bucket* bucket = slot.load(std::memory_order_relaxed);
+  const Entry* entry = FindEntry(bucket, key);
+  // delete only if key hasn't been re-registered to a different subchannel
+  // between strong-unreffing and unregistration of subchannel.
+  if (entry == nullptr || entry->subchannel.get() != subchannel) return;
+  std::unique_ptr<Bucket> new_bucket;
+  if (bucket->size() > 1) {
+    new_bucket = std::make_unique<Bucket>();
+    new_bucket->reserve(bucket->size() - 1);
+    for (const Entry& other : *bucket) {
+      if (&other != entry) new_bucket->push_back(other);
+    }
+  }
+  old_bucket = PublishLocked(slot, std::move(new_bucket));
+}
+
+std::unique_ptr<const GlobalSubchannelPool::Bucket>
+GlobalSubchannelPool::Shard::PublishLocked(
+    std::atomic<const Bucket*>& slot,
+    std::unique_ptr<const Bucket> new_bucket) {
+  std::unique_ptr<const Bucket> old_bucket(
+      slot.exchange(new_bucket.release(), std::memory_order_acq_rel));
+  // Readers that may have seen the old bucket are all counted under the
+  // current epoch.  Readers that start after this see the new bucket.
+  const uint64_t epoch = epoch_.fetch_add(1);
+  while (readers_[epoch & 1].load(std::memory_order_acquire) != 0) {
+    std::this_thread::yield();
+  }
+  return old_bucket;
 }
 
 GlobalSubchannelPool::GlobalSubchannelPool() = default;
@@ -20,8 +20,12 @@
 #define GRPC_SRC_CORE_CLIENT_CHANNEL_GLOBAL_SUBCHANNEL_POOL_H
 
 #include <grpc/support/port_platform.h>
+#include <stdint.h>
 
-#include <map>
+#include <array>
+#include <atomic>
+#include <memory>
+#include <vector>
 
 #include "src/core/client_channel/subchannel_pool_interface.h"
 #include "src/core/util/ref_counted_ptr.h"
@@ -49,18 +53,57 @@ class GlobalSubchannelPool final : public SubchannelPoolInterface {
   ~GlobalSubchannelPool() override;
 
   static const size_t kShards = 127;
+  static const size_t kBucketsPerShard = 16;
 
-  using SubchannelMap = AVL<SubchannelKey, WeakRefCountedPtr<Subchannel>>;
-  struct LockedMap {
-    Mutex mu;
-    SubchannelMap map ABSL_GUARDED_BY(mu);
+  struct Entry {
+    SubchannelKey key;
+    WeakRefCountedPtr<Subchannel> subchannel;
   };
-  using ShardedMap = std::array<LockedMap, kShards>;
+  using Bucket = std::vector<Entry>;
 
-  static size_t ShardIndex(const SubchannelKey& key);
+  // A shard is a fixed table of buckets, and each bucket is immutable once
+  // published, so lookups never take a lock.  Writers copy only the bucket
+  // they change, publish the copy, and free the old bucket once no reader
+  // can be using it.  To tell when that is, each reader counts itself in
+  // one of two reader counts, picked by the low bit of the epoch; a writer
+  // bumps the epoch so that new readers use the other count, and then
+  // waits for the old count to drain.
+  class Shard {
+   public:
+    ~Shard();
 
-  ShardedMap write_shards_;
-  ShardedMap read_shards_;
+    RefCountedPtr<Subchannel> Find(const SubchannelKey& key);
+    RefCountedPtr<Subchannel> Register(const SubchannelKey& key,
+                                       RefCountedPtr<Subchannel> constructed);
+    void Unregister(const SubchannelKey& key, Subchannel* subchannel);
+
+   private:
+    // Returns the reader count that the caller must decrement when done
+    // with the map.
+    std::atomic<uint64_t>& StartRead();
+
+    std::atomic<const Bucket*>& BucketFor(const SubchannelKey& key) {
+      // The low part of the hash already picked the shard.
+      return buckets_[key.Hash() / kShards % kBucketsPerShard];
+    }
+
+    // Publishes new_bucket in place of the bucket in slot and returns the
+    // old bucket, which no reader is using anymore.  The caller should
+    // destroy it after releasing mu_, since dropping weak refs may destroy
+    // subchannels.  A null new_bucket leaves the slot empty.
+    std::unique_ptr<const Bucket> PublishLocked(
+        std::atomic<const Bucket*>& slot,
+        std::unique_ptr<const Bucket> new_bucket)
+        ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
+    Mutex mu_;
+    // Only changed while holding mu_.
+    std::array<std::atomic<const Bucket*>, kBucketsPerShard> buckets_{};
+    std::atomic<uint64_t> epoch_{0};
+    std::atomic<uint64_t> readers_[2] = {0, 0};
+  };
+
+  std::array<Shard, kShards> shards_;
 };
 
 }  // namespace grpc_core
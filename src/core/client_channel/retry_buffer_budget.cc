@@ -0,0 +1,100 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/client_channel/retry_buffer_budget.h"
+
+#include <grpc/event_engine/memory_request.h>
+#include <grpc/impl/channel_arg_names.h>
+#include <limits.h>
+
+#include <string>
+#include <utility>
+
+#include "src/core/client_channel/client_channel_args.h"
+#include "src/core/lib/resource_quota/resource_quota.h"
+#include "src/core/telemetry/metrics.h"
+#include "src/core/util/useful.h"
+
+namespace grpc_core {
+
+namespace {
+// Above this memory pressure, calls stop taking more of the budget and
+// commit instead, since the buffered data might be all that is keeping
+// the quota from reclaiming memory.
+constexpr double kMaxMemoryPressure = 0.8;
+}  // namespace
+
+RetryBufferMetricsDomain::UpDownCounterHandle
+    RetryBufferMetricsDomain::kSharedBytes =
+        RetryBufferMetricsDomain::RegisterUpDownCounter(
+            "grpc.client.retry_buffer.shared_bytes",
+            "Bytes of requests buffered for retries beyond the per-RPC "
+            "limit, using the channel's shared retry buffer.",
+            "By");
+
+RetryBufferMetricsDomain::CounterHandle
+    RetryBufferMetricsDomain::kCommitsOnBufferFull =
+        RetryBufferMetricsDomain::RegisterCounter(
+            "grpc.client.retry_buffer.commits_on_buffer_full",
+            "Number of calls that gave up on retries because their requests "
+            "no longer fit in the retry buffer.",
+            "call");
+
+RefCountedPtr<RetryBufferBudget> RetryBufferBudget::Create(
+    const ChannelArgs& args) {
+  const int max_bytes =
+      Clamp(args.GetInt(GRPC_ARG_RETRY_BUFFER_CHANNEL_SIZE).value_or(0), 0,
+            INT_MAX);
+  auto* stats_plugin_group =
+      args.GetObject<GlobalStatsPluginRegistry::StatsPluginGroup>();
+  auto storage = RetryBufferMetricsDomain::GetStorage(
+      stats_plugin_group != nullptr ? stats_plugin_group->GetCollectionScope()
+                                    : GlobalCollectionScope(),
+      args.GetString(GRPC_ARG_SERVER_URI).value_or(""));
+  auto resource_quota = args.GetObjectRef<ResourceQuota>();
+  if (resource_quota == nullptr) resource_quota = ResourceQuota::Default();
+  return MakeRefCounted<RetryBufferBudget>(
+      max_bytes, resource_quota->memory_quota()->CreateMemoryOwner(),
+      std::move(storage));
+}
+
+RetryBufferBudget::RetryBufferBudget(
+    size_t max_bytes, MemoryOwner memory_owner,
+    InstrumentStorageRefPtr<RetryBufferMetricsDomain> storage)
+    : max_bytes_(max_bytes),
+      memory_owner_(std::move(memory_owner)),
+      storage_(std::move(storage)) {}
+
+bool RetryBufferBudget::TryReserve(size_t bytes) {
+  if (memory_owner_.GetPressureInfo().pressure_control_value >
+      kMaxMemoryPressure) {
+    return false;
+  }
+  size_t used_bytes = used_bytes_.load(std::memory_order_relaxed);
+  do {
+    if (bytes > max_bytes_ - used_bytes) return false;
+  } while (!used_bytes_.compare_exchange_weak(
+      used_bytes, used_bytes + bytes, std::memory_order_relaxed));
+  memory_owner_.Reserve(grpc_event_engine::experimental::MemoryRequest(bytes));
+  storage_->Increment(RetryBufferMetricsDomain::kSharedBytes, bytes);
+  return true;
+}
+
+void RetryBufferBudget::Release(size_t bytes) {
+  used_bytes_.fetch_sub(bytes, std::memory_order_relaxed);
+  memory_owner_.Release(bytes);
+  storage_->Decrement(RetryBufferMetricsDomain::kSharedBytes, bytes);
+}
+
+}  // namespace grpc_core
@@ -0,0 +1,86 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_CLIENT_CHANNEL_RETRY_BUFFER_BUDGET_H
+#define GRPC_SRC_CORE_CLIENT_CHANNEL_RETRY_BUFFER_BUDGET_H
+
+#include <stddef.h>
+
+#include <atomic>
+
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/resource_quota/memory_quota.h"
+#include "src/core/telemetry/instrument.h"
+#include "src/core/util/ref_counted.h"
+#include "src/core/util/ref_counted_ptr.h"
+
+namespace grpc_core {
+
+class RetryBufferMetricsDomain final
+    : public InstrumentDomain<RetryBufferMetricsDomain> {
+ public:
+  using Backend = LowContentionBackend;
+  static constexpr absl::string_view kName = "retry_buffer";
+  GRPC_INSTRUMENT_DOMAIN_LABELS("grpc.target");
+
+  static UpDownCounterHandle kSharedBytes;
+  static CounterHandle kCommitsOnBufferFull;
+};
+
+// Memory that the calls on a channel may use to buffer requests for
+// retries beyond GRPC_ARG_PER_RPC_RETRY_BUFFER_SIZE.
+//
+// Buffered messages hold references to the slices that were sent rather
+// than copies, so the budget bounds how much the channel keeps alive for
+// replay.  Reservations are charged to the channel's resource quota, and
+// are refused while the quota is under memory pressure.
+class RetryBufferBudget final : public RefCounted<RetryBufferBudget> {
+ public:
+  // The budget is empty unless GRPC_ARG_RETRY_BUFFER_CHANNEL_SIZE is set.
+  static RefCountedPtr<RetryBufferBudget> Create(const ChannelArgs& args);
+
+  // Do not instantiate directly -- use Create() instead.
+  RetryBufferBudget(
+      size_t max_bytes, MemoryOwner memory_owner,
+      InstrumentStorageRefPtr<RetryBufferMetricsDomain> storage);
+
+  // Returns false if the channel has no shared budget.
+  bool enabled() const { return max_bytes_ > 0; }
+
+  // Reserves bytes for a call.  Returns false if that would exceed the
+  // budget or the resource quota is under memory pressure.
+  bool TryReserve(size_t bytes);
+  // Returns bytes previously reserved with TryReserve().
+  void Release(size_t bytes);
+
+  // Records that a call was committed because it had buffered as much as
+  // it could.
+  void RecordCommitOnBufferFull() {
+    storage_->Increment(RetryBufferMetricsDomain::kCommitsOnBufferFull);
+  }
+
+  size_t used_bytes() const {
+    return used_bytes_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  const size_t max_bytes_;
+  std::atomic<size_t> used_bytes_{0};
+  MemoryOwner memory_owner_;
+  const InstrumentStorageRefPtr<RetryBufferMetricsDomain> storage_;
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_CLIENT_CHANNEL_RETRY_BUFFER_BUDGET_H
@@ -95,6 +95,7 @@ RetryFilter::RetryFilter(const grpc_channel_element_args& args)
       per_rpc_retry_buffer_size_(
           GetMaxPerRpcRetryBufferSize(args.channel_args)),
       retry_throttler_(args.channel_args.GetObjectRef<RetryThrottler>()),
+      retry_buffer_budget_(RetryBufferBudget::Create(args.channel_args)),
       service_config_parser_index_(RetryServiceConfigParser::ParserIndex()) {}
 
 const RetryMethodConfig* RetryFilter::GetRetryPolicy(Arena* arena) {
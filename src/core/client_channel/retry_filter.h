@@ -28,6 +28,7 @@
 #include <optional>
 
 #include "src/core/client_channel/client_channel_filter.h"
+#include "src/core/client_channel/retry_buffer_budget.h"
 #include "src/core/client_channel/retry_service_config.h"
 #include "src/core/client_channel/retry_throttle.h"
 #include "src/core/lib/channel/channel_args.h"
@@ -70,6 +71,10 @@ class RetryFilter final {
     return per_rpc_retry_buffer_size_;
   }
 
+  RetryBufferBudget* retry_buffer_budget() const {
+    return retry_buffer_budget_.get();
+  }
+
   static size_t GetMaxPerRpcRetryBufferSize(const ChannelArgs& args) {
     // By default, we buffer 256 KiB per RPC for retries.
     // TODO(roth): Do we have any data to suggest a better value?
@@ -105,6 +110,7 @@ class RetryFilter final {
   grpc_event_engine::experimental::EventEngine* const event_engine_;
   size_t per_rpc_retry_buffer_size_;
   RefCountedPtr<RetryThrottler> retry_throttler_;
+  const RefCountedPtr<RetryBufferBudget> retry_buffer_budget_;
   const size_t service_config_parser_index_;
 };
 
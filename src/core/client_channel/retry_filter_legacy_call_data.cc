@@ -1490,6 +1490,7 @@ RetryFilter::LegacyCallData::LegacyCallData(RetryFilter* chand,
 
 RetryFilter::LegacyCallData::~LegacyCallData() {
   FreeAllCachedSendOpData();
+  ReleaseSharedRetryBuffer();
   // Make sure there are no remaining pending batches.
   for (size_t i = 0; i < GPR_ARRAY_SIZE(pending_batches_); ++i) {
     GRPC_CHECK_EQ(pending_batches_[i].batch, nullptr);
@@ -1745,9 +1746,11 @@ RetryFilter::LegacyCallData::PendingBatchesAdd(
   // in flight, we will need to pick the one on which the max number of send
   // ops have already been sent, and we commit to that attempt.
   if (GPR_UNLIKELY(bytes_buffered_for_retry_ >
-                   chand_->per_rpc_retry_buffer_size())) {
+                   chand_->per_rpc_retry_buffer_size()) &&
+      !retry_committed_ && !ReserveSharedRetryBuffer()) {
     GRPC_TRACE_LOG(retry, INFO) << "chand=" << chand_ << " calld=" << this
                                 << ": exceeded retry buffer size, committing";
+    chand_->retry_buffer_budget()->RecordCommitOnBufferFull();
     RetryCommit(call_attempt_.get());
   }
   return pending;
@@ -1847,9 +1850,30 @@ RetryFilter::LegacyCallData::PendingBatchFind(const char* log_message,
 // retry code
 //
 
+bool RetryFilter::LegacyCallData::ReserveSharedRetryBuffer() {
+  RetryBufferBudget* budget = chand_->retry_buffer_budget();
+  if (!budget->enabled()) return false;
+  const size_t needed =
+      bytes_buffered_for_retry_ - chand_->per_rpc_retry_buffer_size();
+  if (needed > shared_bytes_buffered_for_retry_) {
+    if (!budget->TryReserve(needed - shared_bytes_buffered_for_retry_)) {
+      return false;
+    }
+    shared_bytes_buffered_for_retry_ = needed;
+  }
+  return true;
+}
+
+void RetryFilter::LegacyCallData::ReleaseSharedRetryBuffer() {
+  if (shared_bytes_buffered_for_retry_ == 0) return;
+  chand_->retry_buffer_budget()->Release(
+      std::exchange(shared_bytes_buffered_for_retry_, 0));
+}
+
 void RetryFilter::LegacyCallData::RetryCommit(CallAttempt* call_attempt) {
   if (retry_committed_) return;
   retry_committed_ = true;
+  ReleaseSharedRetryBuffer();
   GRPC_TRACE_LOG(retry, INFO)
       << "chand=" << chand_ << " calld=" << this << ": committing retries";
   if (call_attempt != nullptr) {
@@ -348,6 +348,11 @@ class RetryFilter::LegacyCallData final {
   void FreeCachedSendTrailingMetadata();
   void FreeAllCachedSendOpData();
 
+  // Takes what is buffered beyond the per-RPC limit from the channel's
+  // shared retry buffer budget.  Returns false if the budget can't cover it.
+  bool ReserveSharedRetryBuffer();
+  void ReleaseSharedRetryBuffer();
+
   // Commits the call so that no further retry attempts will be performed.
   void RetryCommit(CallAttempt* call_attempt);
 
@@ -398,6 +403,9 @@ class RetryFilter::LegacyCallData final {
   // batches received from above will be added to this list, and they
   // will not be removed until we have invoked their completion callbacks.
   size_t bytes_buffered_for_retry_ = 0;
+  // How much of bytes_buffered_for_retry_ is taken from the channel's
+  // shared retry buffer budget.
+  size_t shared_bytes_buffered_for_retry_ = 0;
   PendingBatch pending_batches_[MAX_PENDING_BATCHES];
   bool pending_send_initial_metadata_ : 1;
   bool pending_send_message_ : 1;
@@ -14,6 +14,8 @@
 
 #include "src/core/client_channel/retry_interceptor.h"
 
+#include <algorithm>
+
 #include "src/core/lib/promise/cancel_callback.h"
 #include "src/core/lib/promise/for_each.h"
 #include "src/core/lib/promise/map.h"
@@ -23,6 +25,10 @@
 namespace grpc_core {
 
 namespace {
+// Number of latency samples needed before a method's hedging delay
+// follows its latency instead of the configured hedgingDelay.
+constexpr uint64_t kMinLatencySamplesForHedgingDelay = 100;
+
 size_t GetMaxPerRpcRetryBufferSize(const ChannelArgs& args) {
   // By default, we buffer 256 KiB per RPC for retries.
   // TODO(roth): Do we have any data to suggest a better value?
@@ -137,14 +143,23 @@ std::optional<Duration> RetryState::ShouldRetry(
 RetryInterceptor::RetryInterceptor(const ChannelArgs& args)
     : per_rpc_retry_buffer_size_(GetMaxPerRpcRetryBufferSize(args)),
       service_config_parser_index_(RetryServiceConfigParser::ParserIndex()),
-      retry_throttler_(args.GetObjectRef<RetryThrottler>()) {}
+      hedging_service_config_parser_index_(
+          HedgingServiceConfigParser::ParserIndex()),
+      retry_throttler_(args.GetObjectRef<RetryThrottler>()),
+      retry_buffer_budget_(RetryBufferBudget::Create(args)) {}
 
 void RetryInterceptor::InterceptCall(
     UnstartedCallHandler unstarted_call_handler) {
+  const HedgingMethodConfig* hedging_policy = GetHedgingPolicy();
+  // The sketch lives in the method's parsed config, which the service
+  // config call data keeps alive for the whole call.
+  LatencySketch* method_latency =
+      hedging_policy != nullptr ? hedging_policy->latency() : nullptr;
   auto call_handler = unstarted_call_handler.StartCall();
   auto* arena = call_handler.arena();
   auto call = arena->MakeRefCounted<Call>(RefAsSubclass<RetryInterceptor>(),
-                                          std::move(call_handler));
+                                          std::move(call_handler),
+                                          hedging_policy, method_latency);
   call->StartAttempt();
   call->Start();
 }
@@ -156,17 +171,38 @@ const RetryMethodConfig* RetryInterceptor::GetRetryPolicy() {
       svc_cfg_call_data->GetMethodParsedConfig(service_config_parser_index_));
 }
 
+const HedgingMethodConfig* RetryInterceptor::GetHedgingPolicy() {
+  auto* svc_cfg_call_data = MaybeGetContext<ServiceConfigCallData>();
+  if (svc_cfg_call_data == nullptr) return nullptr;
+  return static_cast<const HedgingMethodConfig*>(
+      svc_cfg_call_data->GetMethodParsedConfig(
+          hedging_service_config_parser_index_));
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // RetryInterceptor::Call
 
 RetryInterceptor::Call::Call(RefCountedPtr<RetryInterceptor> interceptor,
-                             CallHandler call_handler)
+                             CallHandler call_handler,
+                             const HedgingMethodConfig* hedging_policy,
+                             LatencySketch* method_latency)
     : call_handler_(std::move(call_handler)),
       interceptor_(std::move(interceptor)),
+      hedging_policy_(hedging_policy),
+      method_latency_(method_latency),
       retry_state_(interceptor_->GetRetryPolicy(),
                    interceptor_->retry_throttler_) {
   GRPC_TRACE_LOG(retry, INFO)
-      << DebugTag() << " retry call created: " << retry_state_;
+      << DebugTag() << " retry call created: " << retry_state_ << " hedging:{"
+      << (hedging_policy_ != nullptr ? absl::StrCat(*hedging_policy_)
+                                     : "none")
+      << "}";
+}
+
+RetryInterceptor::Call::~Call() {
+  if (shared_buffer_bytes_ > 0) {
+    interceptor_->retry_buffer_budget_->Release(shared_buffer_bytes_);
+  }
 }
 
 auto RetryInterceptor::Call::ClientToBuffer() {
@@ -209,22 +245,205 @@ void RetryInterceptor::Call::Start() {
                         }),
                     [self]() { self->request_buffer_.Cancel(); });
   });
+  if (hedging_policy_ != nullptr) StartHedgingTimer();
+}
+
+void RetryInterceptor::Call::StartHedgingTimer() {
+  call_handler_.SpawnGuardedUntilCallCompletes(
+      "hedging_timer", [self = Ref()]() {
+        return Loop([self]() {
+          Timestamp next_hedge_time;
+          {
+            MutexLock lock(&self->mu_);
+            next_hedge_time = self->next_hedge_time_;
+          }
+          return Map(Sleep(next_hedge_time), [self](absl::Status) {
+            return self->OnHedgingTimerFired();
+          });
+        });
+      });
+}
+
+LoopCtl<absl::Status> RetryInterceptor::Call::OnHedgingTimerFired() {
+  {
+    MutexLock lock(&mu_);
+    if (!CanStartHedgedAttemptLocked()) return absl::OkStatus();
+    // Pushback from the server may have moved the next attempt further out
+    // while we slept.
+    if (Timestamp::Now() < next_hedge_time_) return Continue{};
+    // Once the throttler is below its threshold, only the attempts already
+    // in flight are allowed to finish.
+    auto* throttler = interceptor_->retry_throttler_.get();
+    if (throttler != nullptr && !attempts_.empty() &&
+        throttler->IsThrottled()) {
+      GRPC_TRACE_LOG(retry, INFO) << DebugTag() << " hedging throttled";
+      hedging_stopped_ = true;
+      return absl::OkStatus();
+    }
+  }
+  StartAttempt();
+  return Continue{};
+}
+
+bool RetryInterceptor::Call::CanStartHedgedAttemptLocked() const {
+  return !hedging_stopped_ && committed_attempt_ == nullptr &&
+         num_attempts_started_ < hedging_policy_->max_attempts();
+}
+
+Duration RetryInterceptor::Call::HedgingDelay() const {
+  if (method_latency_ != nullptr) {
+    auto delay = method_latency_->Percentile(
+        *hedging_policy_->hedging_delay_percentile(),
+        kMinLatencySamplesForHedgingDelay);
+    // The configured delay is a floor, so that the delay can't collapse
+    // even if the latency estimate is biased low.
+    if (delay.has_value()) {
+      return std::max(*delay, hedging_policy_->hedging_delay());
+    }
+  }
+  return hedging_policy_->hedging_delay();
 }
 
 void RetryInterceptor::Call::StartAttempt() {
-  if (current_attempt_ != nullptr) {
-    current_attempt_->Cancel();
+  RefCountedPtr<Attempt> previous_attempt;
+  int num_previous_attempts;
+  {
+    MutexLock lock(&mu_);
+    if (hedging_policy_ != nullptr) {
+      if (!CanStartHedgedAttemptLocked()) return;
+      num_previous_attempts = num_attempts_started_++;
+      next_hedge_time_ = Timestamp::Now() + HedgingDelay();
+    } else {
+      num_previous_attempts = retry_state_.num_attempts_completed();
+      if (current_attempt_ != nullptr) {
+        previous_attempt = current_attempt_->RefIfNonZero();
+      }
+    }
+  }
+  if (previous_attempt != nullptr) previous_attempt->Cancel();
+  auto attempt = call_handler_.arena()->MakeRefCounted<Attempt>(
+      Ref(), num_previous_attempts);
+  {
+    MutexLock lock(&mu_);
+    current_attempt_ = attempt.get();
+    attempts_.push_back(attempt.get());
+  }
+  attempt->Start();
+}
+
+bool RetryInterceptor::Call::OnHedgedAttemptFinished(Attempt* attempt,
+                                                     const ServerMetadata& md) {
+  auto* throttler = interceptor_->retry_throttler_.get();
+  const auto status = md.get(GrpcStatusMetadata());
+  bool start_next_attempt = false;
+  bool forward;
+  {
+    MutexLock lock(&mu_);
+    attempts_.erase(std::remove(attempts_.begin(), attempts_.end(), attempt),
+                    attempts_.end());
+    if (committed_attempt_ != nullptr) return committed_attempt_ == attempt;
+    if (!status.has_value() || *status == GRPC_STATUS_OK) {
+      if (status.has_value() && throttler != nullptr) {
+        throttler->RecordSuccess();
+      }
+      return true;
+    }
+    if (!hedging_policy_->non_fatal_status_codes().Contains(*status)) {
+      GRPC_TRACE_LOG(retry, INFO)
+          << attempt->DebugTag() << " status "
+          << grpc_status_code_to_string(*status)
+          << " is fatal for hedging";
+      return true;
+    }
+    if (throttler != nullptr && !throttler->RecordFailure()) {
+      GRPC_TRACE_LOG(retry, INFO)
+          << attempt->DebugTag() << " hedging throttled";
+      hedging_stopped_ = true;
+    }
+    const auto server_pushback = md.get(GrpcRetryPushbackMsMetadata());
+    if (server_pushback.has_value() && *server_pushback < Duration::Zero()) {
+      GRPC_TRACE_LOG(retry, INFO)
+          << attempt->DebugTag() << " hedging stopped by server push-back";
+      hedging_stopped_ = true;
+    } else if (server_pushback.has_value()) {
+      next_hedge_time_ = Timestamp::Now() + *server_pushback;
+    } else {
+      // A non-fatal failure sends the next hedged attempt right away,
+      // rather than waiting out the hedging delay.
+      start_next_attempt = CanStartHedgedAttemptLocked();
+    }
+    // Only the last attempt to finish reports its failure to the
+    // application.
+    forward = attempts_.empty() && !CanStartHedgedAttemptLocked();
+  }
+  if (start_next_attempt) StartAttempt();
+  return forward;
+}
+
+void RetryInterceptor::Call::RemoveAttempt(Attempt* attempt) {
+  MutexLock lock(&mu_);
+  attempts_.erase(std::remove(attempts_.begin(), attempts_.end(), attempt),
+                  attempts_.end());
+  if (current_attempt_ == attempt) current_attempt_ = nullptr;
+}
+
+bool RetryInterceptor::Call::CommitAttempt(Attempt* attempt) {
+  absl::InlinedVector<RefCountedPtr<Attempt>, 1> losing_attempts;
+  size_t shared_buffer_bytes;
+  {
+    MutexLock lock(&mu_);
+    if (committed_attempt_ != nullptr) return committed_attempt_ == attempt;
+    if (hedging_policy_ == nullptr && current_attempt_ != attempt) return false;
+    committed_attempt_ = attempt;
+    for (Attempt* other : attempts_) {
+      if (other == attempt) continue;
+      auto ref = other->RefIfNonZero();
+      if (ref != nullptr) losing_attempts.push_back(std::move(ref));
+    }
+    shared_buffer_bytes = std::exchange(shared_buffer_bytes_, 0);
   }
-  auto current_attempt = call_handler_.arena()->MakeRefCounted<Attempt>(Ref());
-  current_attempt_ = current_attempt.get();
-  current_attempt->Start();
+  // Nothing more is buffered for replay once committed.
+  if (shared_buffer_bytes > 0) {
+    interceptor_->retry_buffer_budget_->Release(shared_buffer_bytes);
+  }
+  request_buffer_.Commit(attempt->reader());
+  for (auto& losing_attempt : losing_attempts) losing_attempt->Cancel();
+  return true;
+}
+
+bool RetryInterceptor::Call::IsLosingAttempt(Attempt* attempt) {
+  MutexLock lock(&mu_);
+  return committed_attempt_ != nullptr && committed_attempt_ != attempt;
 }
 
 void RetryInterceptor::Call::MaybeCommit(size_t buffered) {
   GRPC_TRACE_LOG(retry, INFO) << DebugTag() << " buffered:" << buffered << "/"
                               << interceptor_->per_rpc_retry_buffer_size_;
-  if (buffered >= interceptor_->per_rpc_retry_buffer_size_) {
-    std::ignore = current_attempt_->Commit();
+  if (buffered < interceptor_->per_rpc_retry_buffer_size_) return;
+  RetryBufferBudget& budget = *interceptor_->retry_buffer_budget_;
+  // With hedging, the buffer fills up once for all attempts, and the
+  // oldest attempt still running is kept.
+  RefCountedPtr<Attempt> attempt;
+  {
+    MutexLock lock(&mu_);
+    if (committed_attempt_ != nullptr) return;
+    // Past the per-RPC limit, keep buffering from the channel's shared
+    // budget for as long as it lasts.
+    const size_t needed = buffered - interceptor_->per_rpc_retry_buffer_size_;
+    if (budget.enabled() &&
+        (needed <= shared_buffer_bytes_ ||
+         budget.TryReserve(needed - shared_buffer_bytes_))) {
+      shared_buffer_bytes_ = std::max(shared_buffer_bytes_, needed);
+      return;
+    }
+    Attempt* candidate = current_attempt_;
+    if (hedging_policy_ != nullptr) {
+      candidate = attempts_.empty() ? nullptr : attempts_.front();
+    }
+    if (candidate != nullptr) attempt = candidate->RefIfNonZero();
+  }
+  if (attempt != nullptr && attempt->Commit()) {
+    budget.RecordCommitOnBufferFull();
   }
 }
 
@@ -235,8 +454,11 @@ std::string RetryInterceptor::Call::DebugTag() {
 ////////////////////////////////////////////////////////////////////////////////
 // RetryInterceptor::Attempt
 
-RetryInterceptor::Attempt::Attempt(RefCountedPtr<Call> call)
-    : call_(std::move(call)), reader_(call_->request_buffer()) {
+RetryInterceptor::Attempt::Attempt(RefCountedPtr<Call> call,
+                                   int num_previous_attempts)
+    : call_(std::move(call)),
+      num_previous_attempts_(num_previous_attempts),
+      reader_(call_->request_buffer()) {
   GRPC_TRACE_LOG(retry, INFO) << DebugTag() << " retry attempt created";
 }
 
@@ -246,6 +468,7 @@ auto RetryInterceptor::Attempt::ServerToClientGotInitialMetadata(
     ServerMetadataHandle md) {
   GRPC_TRACE_LOG(retry, INFO)
       << DebugTag() << " get server initial metadata " << md->DebugString();
+  RecordLatency();
   const bool committed = Commit();
   return If(
       committed,
@@ -282,9 +505,22 @@ auto RetryInterceptor::Attempt::ServerToClientGotTrailersOnlyResponse() {
         GRPC_TRACE_LOG(retry, INFO)
             << self->DebugTag()
             << " got server trailing metadata: " << md->DebugString();
-        auto delay = self->call_->ShouldRetry(
-            *md,
-            [self = self.get()]() -> std::string { return self->DebugTag(); });
+        // Fast failures say nothing about how long the method takes.
+        if (md->get(GrpcStatusMetadata()) == GRPC_STATUS_OK) {
+          self->RecordLatency();
+        } else {
+          self->latency_recorded_.store(true, std::memory_order_relaxed);
+        }
+        std::optional<Duration> delay;
+        bool forward = true;
+        if (self->call_->hedging_policy() != nullptr) {
+          forward = self->call_->OnHedgedAttemptFinished(self.get(), *md);
+        } else {
+          delay = self->call_->ShouldRetry(
+              *md, [self = self.get()]() -> std::string {
+                return self->DebugTag();
+              });
+        }
         return If(
             delay.has_value(),
             [self, delay]() {
@@ -293,7 +529,10 @@ auto RetryInterceptor::Attempt::ServerToClientGotTrailersOnlyResponse() {
                 return absl::OkStatus();
               });
             },
-            [self, md = std::move(md)]() mutable {
+            [self, forward, md = std::move(md)]() mutable {
+              // A hedged attempt that failed while others are still
+              // running just goes away quietly.
+              if (!forward) return absl::OkStatus();
               if (!self->Commit()) return absl::CancelledError();
               self->call_->call_handler()->SpawnPushServerTrailingMetadata(
                   std::move(md));
@@ -319,29 +558,32 @@ auto RetryInterceptor::Attempt::ServerToClient() {
 }
 
 bool RetryInterceptor::Attempt::Commit(SourceLocation whence) {
-  if (committed_) return true;
   GRPC_TRACE_LOG(retry, INFO) << DebugTag() << " commit attempt from "
                               << whence.file() << ":" << whence.line();
-  if (!call_->IsCurrentAttempt(this)) return false;
-  committed_ = true;
-  call_->request_buffer()->Commit(reader());
-  return true;
+  return call_->CommitAttempt(this);
 }
 
 auto RetryInterceptor::Attempt::ClientToServer() {
   return TrySeq(
       reader_.PullClientInitialMetadata(),
       [self = Ref()](ClientMetadataHandle metadata) {
-        int num_attempts_completed = self->call_->num_attempts_completed();
-        if (GPR_UNLIKELY(num_attempts_completed > 0)) {
+        if (GPR_UNLIKELY(self->num_previous_attempts_ > 0)) {
           metadata->Set(GrpcPreviousRpcAttemptsMetadata(),
-                        num_attempts_completed);
+                        self->num_previous_attempts_);
         } else {
           metadata->Remove(GrpcPreviousRpcAttemptsMetadata());
         }
-        self->initiator_ = self->call_->interceptor()->MakeChildCall(
+        auto initiator = self->call_->interceptor()->MakeChildCall(
             std::move(metadata), self->call_->call_handler()->arena()->Ref());
-        self->call_->call_handler()->AddChildCall(self->initiator_);
+        bool cancelled;
+        {
+          MutexLock lock(&self->mu_);
+          self->initiator_ = initiator;
+          self->started_ = true;
+          cancelled = self->cancelled_;
+        }
+        self->call_->call_handler()->AddChildCall(initiator);
+        if (cancelled) initiator.SpawnCancel();
         self->initiator_.SpawnGuarded(
             "server_to_client", [self]() { return self->ServerToClient(); });
         return ForEach(MessagesFrom(&self->reader_),
@@ -354,10 +596,35 @@ auto RetryInterceptor::Attempt::ClientToServer() {
 
 void RetryInterceptor::Attempt::Start() {
   call_->call_handler()->SpawnGuardedUntilCallCompletes(
-      "buffer_to_server", [self = Ref()]() { return self->ClientToServer(); });
+      "buffer_to_server", [self = Ref()]() {
+        // Once another attempt is committed, this attempt's reader fails;
+        // that must not fail the call.
+        return Map(self->ClientToServer(), [self](StatusFlag status) {
+          if (!status.ok() && self->call_->IsLosingAttempt(self.get())) {
+            return StatusFlag(true);
+          }
+          return status;
+        });
+      });
 }
 
-void RetryInterceptor::Attempt::Cancel() { initiator_.SpawnCancel(); }
+void RetryInterceptor::Attempt::Cancel() {
+  CallInitiator initiator;
+  {
+    MutexLock lock(&mu_);
+    cancelled_ = true;
+    if (!started_) return;
+    initiator = initiator_;
+  }
+  // Still waiting for the server: the latency is at least this long.
+  RecordLatency();
+  initiator.SpawnCancel();
+}
+
+void RetryInterceptor::Attempt::RecordLatency() {
+  if (latency_recorded_.exchange(true, std::memory_order_relaxed)) return;
+  call_->RecordAttemptLatency(Timestamp::Now() - start_time_);
+}
 
 std::string RetryInterceptor::Attempt::DebugTag() const {
   return absl::StrFormat("%s attempt:%p", call_->DebugTag(), this);
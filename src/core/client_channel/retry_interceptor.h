@@ -15,13 +15,21 @@
 #ifndef GRPC_SRC_CORE_CLIENT_CHANNEL_RETRY_INTERCEPTOR_H
 #define GRPC_SRC_CORE_CLIENT_CHANNEL_RETRY_INTERCEPTOR_H
 
+#include <atomic>
+
 #include "src/core/call/interception_chain.h"
 #include "src/core/call/request_buffer.h"
 #include "src/core/client_channel/client_channel_args.h"
+#include "src/core/client_channel/retry_buffer_budget.h"
 #include "src/core/client_channel/retry_service_config.h"
 #include "src/core/client_channel/retry_throttle.h"
 #include "src/core/filter/filter_args.h"
+#include "src/core/lib/promise/loop.h"
+#include "src/core/telemetry/latency_sketch.h"
 #include "src/core/util/backoff.h"
+#include "src/core/util/sync.h"
+#include "src/core/util/time.h"
+#include "absl/container/inlined_vector.h"
 
 namespace grpc_core {
 
@@ -78,14 +86,23 @@ class RetryInterceptor : public Interceptor {
   class Call final
       : public RefCounted<Call, NonPolymorphicRefCount, UnrefCallDtor> {
    public:
-    Call(RefCountedPtr<RetryInterceptor> interceptor, CallHandler call_handler);
-
+    Call(RefCountedPtr<RetryInterceptor> interceptor, CallHandler call_handler,
+         const HedgingMethodConfig* hedging_policy,
+         LatencySketch* method_latency);
+    ~Call();
+
+    // Starts a new attempt.  Without hedging, this cancels the previous
+    // attempt; with hedging, the previous attempts keep going, and no
+    // attempt is started once hedging has run its course.
     void StartAttempt();
     void Start();
 
     RequestBuffer* request_buffer() { return &request_buffer_; }
     CallHandler* call_handler() { return &call_handler_; }
     RetryInterceptor* interceptor() { return interceptor_.get(); }
+    const HedgingMethodConfig* hedging_policy() const {
+      return hedging_policy_;
+    }
     // if nullopt --> commit & don't retry
     // if duration --> retry after duration
     std::optional<Duration> ShouldRetry(
@@ -94,34 +111,60 @@ class RetryInterceptor : public Interceptor {
       return retry_state_.ShouldRetry(md, request_buffer_.committed(),
                                       lazy_attempt_debug_string);
     }
-    int num_attempts_completed() const {
-      return retry_state_.num_attempts_completed();
-    }
-    void RemoveAttempt(Attempt* attempt) {
-      if (current_attempt_ == attempt) current_attempt_ = nullptr;
-    }
-    bool IsCurrentAttempt(Attempt* attempt) {
-      CHECK(attempt != nullptr);
-      return current_attempt_ == attempt;
+    // Hedging only: handles a hedged attempt that finished without
+    // committing.  Returns true if its trailing metadata should be
+    // returned to the application, or false if the call waits for the
+    // other attempts.
+    bool OnHedgedAttemptFinished(Attempt* attempt, const ServerMetadata& md);
+    void RemoveAttempt(Attempt* attempt);
+    // Records the time an attempt took to get a response from the server,
+    // or for an attempt cancelled first, how long it had waited so far.
+    void RecordAttemptLatency(Duration latency) {
+      if (method_latency_ != nullptr) method_latency_->Record(latency);
     }
+    // Makes attempt the one whose response is returned to the application.
+    // Returns false if another attempt got there first.
+    bool CommitAttempt(Attempt* attempt);
+    // Returns true if another attempt was committed.
+    bool IsLosingAttempt(Attempt* attempt);
 
     std::string DebugTag();
 
    private:
     void MaybeCommit(size_t buffered);
     auto ClientToBuffer();
+    void StartHedgingTimer();
+    LoopCtl<absl::Status> OnHedgingTimerFired();
+    bool CanStartHedgedAttemptLocked() const ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+    Duration HedgingDelay() const;
 
     RequestBuffer request_buffer_;
     CallHandler call_handler_;
     RefCountedPtr<RetryInterceptor> interceptor_;
-    Attempt* current_attempt_ = nullptr;
+    const HedgingMethodConfig* const hedging_policy_;
+    // Set only if the hedging delay follows the method's latency.
+    LatencySketch* const method_latency_;
     retry_detail::RetryState retry_state_;
+    // Attempts run on their own parties, so they may call in concurrently.
+    Mutex mu_;
+    Attempt* current_attempt_ ABSL_GUARDED_BY(mu_) = nullptr;
+    Attempt* committed_attempt_ ABSL_GUARDED_BY(mu_) = nullptr;
+    // Attempts that have not yet finished.  Without hedging there is at
+    // most one.
+    absl::InlinedVector<Attempt*, 1> attempts_ ABSL_GUARDED_BY(mu_);
+    // Hedging state.
+    int num_attempts_started_ ABSL_GUARDED_BY(mu_) = 0;
+    bool hedging_stopped_ ABSL_GUARDED_BY(mu_) = false;
+    Timestamp next_hedge_time_ ABSL_GUARDED_BY(mu_);
+    // Bytes buffered beyond the per-RPC limit, taken from the channel's
+    // shared retry buffer budget until the call commits.
+    size_t shared_buffer_bytes_ ABSL_GUARDED_BY(mu_) = 0;
   };
 
   class Attempt final
       : public RefCounted<Attempt, NonPolymorphicRefCount, UnrefCallDtor> {
    public:
-    explicit Attempt(RefCountedPtr<Call> call);
+    Attempt(RefCountedPtr<Call> call, int num_previous_attempts);
     ~Attempt();
 
     void Start();
@@ -136,18 +179,32 @@ class RetryInterceptor : public Interceptor {
     auto ServerToClient();
     auto ServerToClientGotInitialMetadata(ServerMetadataHandle md);
     auto ServerToClientGotTrailersOnlyResponse();
+    // Records how long this attempt waited for the server, at most once.
+    // Attempts that lose a hedging race record the time they had waited when
+    // cancelled, so that the latency is not just the fastest attempt of
+    // each call.
+    void RecordLatency();
 
     RefCountedPtr<Call> call_;
+    const int num_previous_attempts_;
+    const Timestamp start_time_ = Timestamp::Now();
+    std::atomic<bool> latency_recorded_{false};
     RequestBuffer::Reader reader_;
     CallInitiator initiator_;
-    bool committed_ = false;
+    // Guards starting the child call against a concurrent Cancel().
+    Mutex mu_;
+    bool started_ ABSL_GUARDED_BY(mu_) = false;
+    bool cancelled_ ABSL_GUARDED_BY(mu_) = false;
   };
 
   const RetryMethodConfig* GetRetryPolicy();
+  const HedgingMethodConfig* GetHedgingPolicy();
 
   const size_t per_rpc_retry_buffer_size_;
   const size_t service_config_parser_index_;
+  const size_t hedging_service_config_parser_index_;
   const RefCountedPtr<RetryThrottler> retry_throttler_;
+  const RefCountedPtr<RetryBufferBudget> retry_buffer_budget_;
 };
 
 }  // namespace grpc_core
@@ -212,6 +212,66 @@ void RetryMethodConfig::JsonPostLoad(const Json& json, const JsonArgs& args,
   }
 }
 
+//
+// HedgingMethodConfig
+//
+
+const JsonLoaderInterface* HedgingMethodConfig::JsonLoader(const JsonArgs&) {
+  static const auto* loader =
+      JsonObjectLoader<HedgingMethodConfig>()
+          // Note: The "nonFatalStatusCodes" field requires custom parsing,
+          // so it's handled in JsonPostLoad() instead.
+          .Field("maxAttempts", &HedgingMethodConfig::max_attempts_)
+          .OptionalField("hedgingDelay", &HedgingMethodConfig::hedging_delay_)
+          .OptionalField("hedgingDelayPercentile",
+                         &HedgingMethodConfig::hedging_delay_percentile_)
+          .Finish();
+  return loader;
+}
+
+void HedgingMethodConfig::JsonPostLoad(const Json& json, const JsonArgs& args,
+                                       ValidationErrors* errors) {
+  // Validate maxAttempts.
+  {
+    ValidationErrors::ScopedField field(errors, ".maxAttempts");
+    if (!errors->FieldHasErrors()) {
+      if (max_attempts_ <= 1) {
+        errors->AddError("must be at least 2");
+      } else if (max_attempts_ > MAX_MAX_RETRY_ATTEMPTS) {
+        LOG(ERROR) << "service config: clamped hedgingPolicy.maxAttempts at "
+                   << MAX_MAX_RETRY_ATTEMPTS;
+        max_attempts_ = MAX_MAX_RETRY_ATTEMPTS;
+      }
+    }
+  }
+  // Validate hedgingDelayPercentile.
+  if (hedging_delay_percentile_.has_value()) {
+    ValidationErrors::ScopedField field(errors, ".hedgingDelayPercentile");
+    if (!errors->FieldHasErrors() && (*hedging_delay_percentile_ <= 0 ||
+                                      *hedging_delay_percentile_ >= 100)) {
+      errors->AddError("must be greater than 0 and less than 100");
+    }
+    latency_ = std::make_unique<LatencySketch>();
+  }
+  // Parse nonFatalStatusCodes.
+  auto status_code_list = LoadJsonObjectField<std::vector<std::string>>(
+      json.object(), args, "nonFatalStatusCodes", errors,
+      /*required=*/false);
+  if (status_code_list.has_value()) {
+    for (size_t i = 0; i < status_code_list->size(); ++i) {
+      ValidationErrors::ScopedField field(
+          errors, absl::StrCat(".nonFatalStatusCodes[", i, "]"));
+      grpc_status_code status;
+      if (!grpc_status_code_from_string((*status_code_list)[i].c_str(),
+                                        &status)) {
+        errors->AddError("failed to parse status code");
+      } else {
+        non_fatal_status_codes_.Add(status);
+      }
+    }
+  }
+}
+
 //
 // RetryServiceConfigParser
 //
@@ -275,4 +335,54 @@ RetryServiceConfigParser::ParsePerMethodParams(const ChannelArgs& args,
   return std::move(method_params.retry_policy);
 }
 
+//
+// HedgingServiceConfigParser
+//
+
+size_t HedgingServiceConfigParser::ParserIndex() {
+  return CoreConfiguration::Get().service_config_parser().GetParserIndex(
+      parser_name());
+}
+
+void HedgingServiceConfigParser::Register(
+    CoreConfiguration::Builder* builder) {
+  builder->service_config_parser()->RegisterParser(
+      std::make_unique<HedgingServiceConfigParser>());
+}
+
+namespace {
+
+struct HedgingMethodConfigJson {
+  std::unique_ptr<HedgingMethodConfig> hedging_policy;
+
+  static const JsonLoaderInterface* JsonLoader(const JsonArgs&) {
+    static const auto* loader =
+        JsonObjectLoader<HedgingMethodConfigJson>()
+            .OptionalField("hedgingPolicy",
+                           &HedgingMethodConfigJson::hedging_policy)
+            .Finish();
+    return loader;
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<ServiceConfigParser::ParsedConfig>
+HedgingServiceConfigParser::ParsePerMethodParams(const ChannelArgs& args,
+                                                 const Json& json,
+                                                 ValidationErrors* errors) {
+  if (!args.GetBool(GRPC_ARG_EXPERIMENTAL_ENABLE_HEDGING).value_or(false)) {
+    return nullptr;
+  }
+  auto method_params = LoadFromJson<HedgingMethodConfigJson>(
+      json, JsonChannelArgs(args), errors);
+  if (method_params.hedging_policy != nullptr &&
+      json.object().find("retryPolicy") != json.object().end()) {
+    ValidationErrors::ScopedField field(errors, ".hedgingPolicy");
+    errors->AddError("may not be specified together with retryPolicy");
+    return nullptr;
+  }
+  return std::move(method_params.hedging_policy);
+}
+
 }  // namespace grpc_core
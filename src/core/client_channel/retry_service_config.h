@@ -28,6 +28,7 @@
 #include "src/core/config/core_configuration.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/service_config/service_config_parser.h"
+#include "src/core/telemetry/latency_sketch.h"
 #include "src/core/util/json/json.h"
 #include "src/core/util/json/json_args.h"
 #include "src/core/util/json/json_object_loader.h"
@@ -90,6 +91,48 @@ class RetryMethodConfig final : public ServiceConfigParser::ParsedConfig {
   std::optional<Duration> per_attempt_recv_timeout_;
 };
 
+class HedgingMethodConfig final : public ServiceConfigParser::ParsedConfig {
+ public:
+  int max_attempts() const { return max_attempts_; }
+  Duration hedging_delay() const { return hedging_delay_; }
+  // If set, the hedging delay follows this percentile (between 0 and 100)
+  // of the method's observed latency, but never drops below
+  // hedging_delay(), which is also used until enough latency samples have
+  // been collected.
+  std::optional<float> hedging_delay_percentile() const {
+    return hedging_delay_percentile_;
+  }
+  StatusCodeSet non_fatal_status_codes() const {
+    return non_fatal_status_codes_;
+  }
+  // Latency of the calls that use this config, set only if
+  // hedging_delay_percentile() is.  Shared by every method the config
+  // applies to, and starts over when the service config changes.
+  LatencySketch* latency() const { return latency_.get(); }
+
+  static const JsonLoaderInterface* JsonLoader(const JsonArgs&);
+  void JsonPostLoad(const Json& json, const JsonArgs& args,
+                    ValidationErrors* errors);
+
+  template <typename Sink>
+  friend void AbslStringify(Sink& sink, const HedgingMethodConfig& config) {
+    sink.Append(absl::StrCat(
+        "max_attempts:", config.max_attempts_,
+        " hedging_delay:", config.hedging_delay_, " hedging_delay_percentile:",
+        config.hedging_delay_percentile_.has_value()
+            ? absl::StrCat(*config.hedging_delay_percentile_)
+            : "none",
+        " non_fatal_status_codes:", config.non_fatal_status_codes_.ToString()));
+  }
+
+ private:
+  int max_attempts_ = 0;
+  Duration hedging_delay_;
+  std::optional<float> hedging_delay_percentile_;
+  StatusCodeSet non_fatal_status_codes_;
+  std::unique_ptr<LatencySketch> latency_;
+};
+
 class RetryServiceConfigParser final : public ServiceConfigParser::Parser {
  public:
   absl::string_view name() const override { return parser_name(); }
@@ -109,6 +152,23 @@ class RetryServiceConfigParser final : public ServiceConfigParser::Parser {
   static absl::string_view parser_name() { return "retry"; }
 };
 
+// Parses the hedgingPolicy field of method configs.  The field is ignored
+// unless GRPC_ARG_EXPERIMENTAL_ENABLE_HEDGING is set.
+class HedgingServiceConfigParser final : public ServiceConfigParser::Parser {
+ public:
+  absl::string_view name() const override { return parser_name(); }
+
+  std::unique_ptr<ServiceConfigParser::ParsedConfig> ParsePerMethodParams(
+      const ChannelArgs& args, const Json& json,
+      ValidationErrors* errors) override;
+
+  static size_t ParserIndex();
+  static void Register(CoreConfiguration::Builder* builder);
+
+ private:
+  static absl::string_view parser_name() { return "hedging"; }
+};
+
 }  // namespace grpc_core
 
 #endif  // GRPC_SRC_CORE_CLIENT_CHANNEL_RETRY_SERVICE_CONFIG_H
@@ -125,6 +125,16 @@ void RetryThrottler::RecordSuccess() {
                                  std::numeric_limits<intptr_t>::max())));
 }
 
+bool RetryThrottler::IsThrottled() {
+  // First, check if we are stale and need to be replaced.
+  RetryThrottler* throttle_data = this;
+  GetReplacementThrottleDataIfNeeded(&throttle_data);
+  const intptr_t milli_tokens =
+      throttle_data->milli_tokens_.load(std::memory_order_relaxed);
+  return milli_tokens <=
+         static_cast<intptr_t>(throttle_data->max_milli_tokens_ / 2);
+}
+
 void RetryThrottlerChannelArgsUpdater::Update(
     const ServiceConfig& service_config, ChannelArgs& args) {
   // Get retry throttling parameters from service config.
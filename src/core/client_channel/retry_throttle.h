@@ -47,6 +47,10 @@ class RetryThrottler final : public RefCounted<RetryThrottler> {
   /// Records a success.
   void RecordSuccess();
 
+  /// Returns true if retries are currently throttled.  Used to decide
+  /// whether to send a hedged attempt, which is not preceded by a failure.
+  bool IsThrottled();
+
   // Exposed for testing purposes only.
   uintptr_t max_milli_tokens() const { return max_milli_tokens_; }
   uintptr_t milli_token_ratio() const { return milli_token_ratio_; }
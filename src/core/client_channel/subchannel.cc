@@ -193,6 +193,10 @@ class Subchannel::ConnectedSubchannel
   // Returns true if this RPC finishing brought the connection below quota.
   bool ReturnQuotaForRpc() { return stream_limiter_.ReturnQuotaForRpc(); }
 
+  SubchannelStreamLimiter::Usage GetStreamUsage() const {
+    return stream_limiter_.GetUsage();
+  }
+
  protected:
   explicit ConnectedSubchannel(WeakRefCountedPtr<Subchannel> subchannel,
                                const ChannelArgs& args,
@@ -1036,7 +1040,11 @@ Subchannel::Subchannel(SubchannelKey key,
           args_.GetObjectRef<GlobalStatsPluginRegistry::StatsPluginGroup>()),
       target_(args_.GetString(GRPC_ARG_DEFAULT_AUTHORITY).value_or("")),
       backend_service_(args_.GetString(GRPC_ARG_BACKEND_SERVICE).value_or("")),
-      locality_(args_.GetString(GRPC_ARG_LB_LOCALITY).value_or("")) {
+      locality_(args_.GetString(GRPC_ARG_LB_LOCALITY).value_or("")),
+      connection_scale_up_percent_(static_cast<uint32_t>(
+          Clamp(args_.GetInt(GRPC_ARG_SUBCHANNEL_CONNECTION_SCALE_UP_PERCENT)
+                    .value_or(100),
+                1, 100))) {
   if (stats_plugin_group_ != nullptr) {
     attempts_storage_ = SubchannelMetricsDomainAttempts::GetStorage(
         stats_plugin_group_->GetCollectionScope(), target_, backend_service_,
@@ -1559,7 +1567,25 @@ void TestOnlySetSubchannelAlwaysSendCallsToTransport(bool enabled) {
 
 RefCountedPtr<Subchannel::ConnectedSubchannel>
 Subchannel::ChooseConnectionLocked() {
-  // Try to find a connection with quota available for the RPC.
+  // Send the RPC on the connection with the fewest RPCs in flight, so that
+  // load and head-of-line blocking are spread across connections.
+  ConnectedSubchannel* least_loaded = nullptr;
+  SubchannelStreamLimiter::Usage least_loaded_usage;
+  for (auto& connection : connections_) {
+    const auto usage = connection->GetStreamUsage();
+    if (!usage.HasQuota()) continue;
+    if (least_loaded == nullptr ||
+        usage.rpcs_in_flight < least_loaded_usage.rpcs_in_flight) {
+      least_loaded = connection.get();
+      least_loaded_usage = usage;
+    }
+  }
+  // Quota is only handed out under mu_, so this can fail only if the
+  // transport lowered MAX_CONCURRENT_STREAMS in the meantime.
+  if (least_loaded != nullptr && least_loaded->GetQuotaForRpc()) {
+    MaybeScaleUpLocked(least_loaded_usage);
+    return least_loaded->Ref();
+  }
   for (auto& connection : connections_) {
     if (connection->GetQuotaForRpc()) return connection;
   }
@@ -1581,6 +1607,25 @@ Subchannel::ChooseConnectionLocked() {
   return nullptr;
 }
 
+void Subchannel::MaybeScaleUpLocked(
+    SubchannelStreamLimiter::Usage least_loaded_usage) {
+  if (connection_scale_up_percent_ >= 100) return;
+  // The RPC just added to the least loaded connection is counted too.
+  if ((static_cast<uint64_t>(least_loaded_usage.rpcs_in_flight) + 1) * 100 <
+      static_cast<uint64_t>(least_loaded_usage.max_concurrent_streams) *
+          connection_scale_up_percent_) {
+    return;
+  }
+  if (connections_.size() < watcher_list_.GetMaxConnectionsPerSubchannel() &&
+      !connection_attempt_in_flight_ && !retry_timer_handle_.has_value()) {
+    GRPC_TRACE_LOG(subchannel, INFO)
+        << "subchannel " << this << " " << key_.ToString()
+        << ": all connections at least " << connection_scale_up_percent_
+        << "% busy; adding a new connection";
+    StartConnectingLocked();
+  }
+}
+
 void Subchannel::RetryQueuedRpcs() {
   MutexLock lock(&mu_);
   if (shutdown_) return;
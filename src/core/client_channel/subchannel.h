@@ -30,6 +30,7 @@
 #include "src/core/client_channel/connector.h"
 #include "src/core/client_channel/subchannel_metrics.h"
 #include "src/core/client_channel/subchannel_pool_interface.h"
+#include "src/core/client_channel/subchannel_stream_limiter.h"
 #include "src/core/lib/address_utils/sockaddr_utils.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/channel/channel_fwd.h"
@@ -284,6 +285,9 @@ class Subchannel : public DualRefCounted<Subchannel> {
 
   RefCountedPtr<ConnectedSubchannel> ChooseConnectionLocked()
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  // Starts another connection if the least loaded one is busy enough.
+  void MaybeScaleUpLocked(SubchannelStreamLimiter::Usage least_loaded_usage)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
   void RetryQueuedRpcs() ABSL_LOCKS_EXCLUDED(mu_);
   void RetryQueuedRpcsLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
   void MaybeFailAllQueuedRpcsLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
@@ -396,6 +400,8 @@ class Subchannel : public DualRefCounted<Subchannel> {
   absl::string_view backend_service_;
   absl::string_view locality_;
   InstrumentStorageRefPtr<SubchannelMetricsDomainAttempts> attempts_storage_;
+  // From GRPC_ARG_SUBCHANNEL_CONNECTION_SCALE_UP_PERCENT.
+  const uint32_t connection_scale_up_percent_;
 };
 
 void TestOnlySetSubchannelAlwaysSendCallsToTransport(bool enabled);
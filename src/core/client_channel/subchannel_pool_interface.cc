@@ -23,6 +23,7 @@
 
 #include "src/core/lib/address_utils/sockaddr_utils.h"
 #include "src/core/lib/channel/channel_args.h"
+#include "absl/hash/hash.h"
 #include "absl/status/status.h"
 #include "absl/status/statusor.h"
 #include "absl/strings/str_cat.h"
@@ -36,7 +37,10 @@ namespace grpc_core {
 
 SubchannelKey::SubchannelKey(const grpc_resolved_address& address,
                              const ChannelArgs& args)
-    : address_(address), args_(args) {}
+    : address_(address),
+      args_(args),
+      hash_(absl::HashOf(
+          absl::string_view(address_.addr, address_.len), args_)) {}
 
 int SubchannelKey::Compare(const SubchannelKey& other) const {
   if (address_.len < other.address_.len) return -1;
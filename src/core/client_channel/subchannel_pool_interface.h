@@ -20,8 +20,10 @@
 #define GRPC_SRC_CORE_CLIENT_CHANNEL_SUBCHANNEL_POOL_INTERFACE_H
 
 #include <grpc/support/port_platform.h>
+#include <stddef.h>
 
 #include <string>
+#include <utility>
 
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/debug/trace.h"
@@ -52,7 +54,7 @@ class SubchannelKey final {
     return Compare(other) > 0;
   }
   bool operator==(const SubchannelKey& other) const {
-    return Compare(other) == 0;
+    return hash_ == other.hash_ && Compare(other) == 0;
   }
 
   int Compare(const SubchannelKey& other) const;
@@ -60,12 +62,22 @@ class SubchannelKey final {
   const grpc_resolved_address& address() const { return address_; }
   const ChannelArgs& args() const { return args_; }
 
+  // Hashing the channel args is expensive, so the hash is computed once
+  // when the key is created.
+  size_t Hash() const { return hash_; }
+
+  template <typename H>
+  friend H AbslHashValue(H h, const SubchannelKey& key) {
+    return H::combine(std::move(h), key.hash_);
+  }
+
   // Human-readable string suitable for logging.
   std::string ToString() const;
 
  private:
   grpc_resolved_address address_;
   ChannelArgs args_;
+  size_t hash_;
 };
 
 // Interface for subchannel pool.
@@ -73,4 +73,10 @@ bool SubchannelStreamLimiter::ReturnQuotaForRpc() {
          GetMaxConcurrentStreams(prev_stream_counts);
 }
 
+SubchannelStreamLimiter::Usage SubchannelStreamLimiter::GetUsage() const {
+  const uint64_t stream_counts = stream_counts_.load(std::memory_order_acquire);
+  return {GetRpcsInFlight(stream_counts),
+          GetMaxConcurrentStreams(stream_counts)};
+}
+
 }  // namespace grpc_core
@@ -24,6 +24,13 @@ namespace grpc_core {
 
 class SubchannelStreamLimiter {
  public:
+  struct Usage {
+    uint32_t rpcs_in_flight;
+    uint32_t max_concurrent_streams;
+
+    bool HasQuota() const { return rpcs_in_flight < max_concurrent_streams; }
+  };
+
   explicit SubchannelStreamLimiter(uint32_t max_concurrent_streams);
 
   // Sets the maximum number of concurrent streams.
@@ -39,6 +46,9 @@ class SubchannelStreamLimiter {
   // Returns true if the connection is no longer above its quota.
   bool ReturnQuotaForRpc();
 
+  // Returns a snapshot of the current usage.
+  Usage GetUsage() const;
+
  private:
   // First 32 bits are the MAX_CONCURRENT_STREAMS value reported by
   // the transport.
@@ -31,6 +31,7 @@
 #include "src/core/credentials/transport/tls/ssl_utils.h"
 #include "src/core/credentials/transport/transport_credentials.h"
 #include "src/core/handshaker/handshaker.h"
+#include "src/core/handshaker/security/secure_endpoint.h"
 #include "src/core/handshaker/security/security_handshaker.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/iomgr/closure.h"
@@ -229,7 +230,9 @@ class grpc_ssl_server_security_connector
   // the alternative thread-safe, however it will introduce too much contention
   // which in turn will affect performance.
   grpc_security_status InitializeHandshakerFactory(
-      std::optional<std::string> alpn_preferred_protocol_raw_list) {
+      std::optional<std::string> alpn_preferred_protocol_raw_list,
+      bool kernel_tls) {
+    kernel_tls_ = kernel_tls;
     if (has_cert_config_fetcher()) {
       // Load initial credentials from certificate_config_fetcher:
       if (!try_fetch_ssl_server_credentials()) {
@@ -268,6 +271,7 @@ class grpc_ssl_server_security_connector
           server_credentials->config().min_tls_version);
       options.max_tls_version = grpc_get_tsi_tls_version(
           server_credentials->config().max_tls_version);
+      options.enable_kernel_tls = kernel_tls_;
       const tsi_result result =
           tsi_create_ssl_server_handshaker_factory_with_options(
               &options, &server_handshaker_factory_);
@@ -387,6 +391,7 @@ class grpc_ssl_server_security_connector
     options.cipher_suites = grpc_get_ssl_cipher_suites();
     options.alpn_protocols = alpn_protocol_strings;
     options.num_alpn_protocols = static_cast<uint16_t>(num_alpn_protocols);
+    options.enable_kernel_tls = kernel_tls_;
     tsi_result result = tsi_create_ssl_server_handshaker_factory_with_options(
         &options, &new_handshaker_factory);
     gpr_free(alpn_protocol_strings);
@@ -410,6 +415,8 @@ class grpc_ssl_server_security_connector
 
   grpc_core::Mutex mu_;
   tsi_ssl_server_handshaker_factory* server_handshaker_factory_ = nullptr;
+  // Whether handshakes capture the secrets for kernel TLS offload.
+  bool kernel_tls_ = false;
 };
 }  // namespace
 
@@ -442,7 +449,8 @@ grpc_ssl_server_security_connector_create(
       grpc_core::MakeRefCounted<grpc_ssl_server_security_connector>(
           std::move(server_credentials));
   const grpc_security_status retval = c->InitializeHandshakerFactory(
-      args.GetOwnedString(GRPC_ARG_TRANSPORT_PROTOCOLS));
+      args.GetOwnedString(GRPC_ARG_TRANSPORT_PROTOCOLS),
+      args.GetBool(GRPC_ARG_SECURE_ENDPOINT_KERNEL_TLS).value_or(false));
   if (retval != GRPC_SECURITY_OK) {
     return nullptr;
   }
@@ -108,6 +108,7 @@ grpc_security_status grpc_ssl_tsi_server_handshaker_factory_init(
     const char* crl_directory, bool send_client_ca_list,
     std::shared_ptr<grpc_core::experimental::CrlProvider> crl_provider,
     const std::vector<grpc_tls_key_exchange_group>& key_exchange_groups,
+    bool enable_kernel_tls,
     tsi_ssl_server_handshaker_factory** handshaker_factory);
 
 // Exposed for testing only.
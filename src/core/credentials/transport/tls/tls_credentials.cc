@@ -31,6 +31,7 @@
 #include "src/core/credentials/transport/tls/grpc_tls_certificate_verifier.h"
 #include "src/core/credentials/transport/tls/grpc_tls_credentials_options.h"
 #include "src/core/credentials/transport/tls/tls_security_connector.h"
+#include "src/core/handshaker/security/secure_endpoint.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/tsi/ssl/session_cache/ssl_session_cache.h"
 #include "src/core/util/useful.h"
@@ -139,9 +140,11 @@ TlsServerCredentials::~TlsServerCredentials() {}
 
 grpc_core::RefCountedPtr<grpc_server_security_connector>
 TlsServerCredentials::create_security_connector(
-    const grpc_core::ChannelArgs& /* args */) {
+    const grpc_core::ChannelArgs& args) {
   return grpc_core::TlsServerSecurityConnector::
-      CreateTlsServerSecurityConnector(this->Ref(), options_);
+      CreateTlsServerSecurityConnector(
+          this->Ref(), options_,
+          args.GetBool(GRPC_ARG_SECURE_ENDPOINT_KERNEL_TLS).value_or(false));
 }
 
 grpc_core::UniqueTypeName TlsServerCredentials::Type() {
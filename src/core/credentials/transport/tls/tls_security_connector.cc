@@ -588,7 +588,7 @@ TlsChannelSecurityConnector::UpdateHandshakerFactoryLocked() {
 RefCountedPtr<grpc_server_security_connector>
 TlsServerSecurityConnector::CreateTlsServerSecurityConnector(
     RefCountedPtr<grpc_server_credentials> server_creds,
-    RefCountedPtr<grpc_tls_credentials_options> options) {
+    RefCountedPtr<grpc_tls_credentials_options> options, bool kernel_tls) {
   if (server_creds == nullptr) {
     LOG(ERROR) << "server_creds is nullptr in "
                   "TlsServerSecurityConnectorCreate()";
@@ -599,16 +599,17 @@ TlsServerSecurityConnector::CreateTlsServerSecurityConnector(
                   "TlsServerSecurityConnectorCreate()";
     return nullptr;
   }
-  return MakeRefCounted<TlsServerSecurityConnector>(std::move(server_creds),
-                                                    std::move(options));
+  return MakeRefCounted<TlsServerSecurityConnector>(
+      std::move(server_creds), std::move(options), kernel_tls);
 }
 
 TlsServerSecurityConnector::TlsServerSecurityConnector(
     RefCountedPtr<grpc_server_credentials> server_creds,
-    RefCountedPtr<grpc_tls_credentials_options> options)
+    RefCountedPtr<grpc_tls_credentials_options> options, bool kernel_tls)
     : grpc_server_security_connector(GRPC_SSL_URL_SCHEME,
                                      std::move(server_creds)),
-      options_(std::move(options)) {
+      options_(std::move(options)),
+      kernel_tls_(kernel_tls) {
   const std::string& tls_session_key_log_file_path =
       options_->tls_session_key_log_file_path();
   if (!tls_session_key_log_file_path.empty()) {
@@ -856,7 +857,8 @@ TlsServerSecurityConnector::UpdateHandshakerFactoryLocked() {
       grpc_get_tsi_tls_version(options_->max_tls_version()),
       tls_session_key_logger_.get(), options_->crl_directory().c_str(),
       options_->send_client_ca_list(), options_->crl_provider(),
-      options_->key_exchange_groups(), &server_handshaker_factory_);
+      options_->key_exchange_groups(), kernel_tls_,
+      &server_handshaker_factory_);
 }
 
 }  // namespace grpc_core
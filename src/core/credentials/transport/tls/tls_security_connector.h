@@ -193,11 +193,13 @@ class TlsServerSecurityConnector final : public grpc_server_security_connector {
   static RefCountedPtr<grpc_server_security_connector>
   CreateTlsServerSecurityConnector(
       RefCountedPtr<grpc_server_credentials> server_creds,
-      RefCountedPtr<grpc_tls_credentials_options> options);
+      RefCountedPtr<grpc_tls_credentials_options> options,
+      bool kernel_tls = false);
 
   TlsServerSecurityConnector(
       RefCountedPtr<grpc_server_credentials> server_creds,
-      RefCountedPtr<grpc_tls_credentials_options> options);
+      RefCountedPtr<grpc_tls_credentials_options> options,
+      bool kernel_tls = false);
   ~TlsServerSecurityConnector() override;
 
   void add_handshakers(const ChannelArgs& args,
@@ -301,6 +303,8 @@ class TlsServerSecurityConnector final : public grpc_server_security_connector {
       ABSL_GUARDED_BY(mu_);
   std::shared_ptr<tsi::RootCertInfo> root_cert_info_ ABSL_GUARDED_BY(mu_);
   RefCountedPtr<TlsSessionKeyLogger> tls_session_key_logger_;
+  // Whether handshakes capture the secrets for kernel TLS offload.
+  const bool kernel_tls_;
   std::map<grpc_closure* /*on_peer_checked*/, ServerPendingVerifierRequest*>
       pending_verifier_requests_ ABSL_GUARDED_BY(verifier_request_map_mu_);
 };
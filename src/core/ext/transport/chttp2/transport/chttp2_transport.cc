@@ -32,6 +32,7 @@
 
 #include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <limits>
@@ -73,6 +74,7 @@
 #include "src/core/ext/transport/chttp2/transport/write_size_policy.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/event_engine/extensions/channelz.h"
+#include "src/core/lib/event_engine/extensions/tcp_info_sampling.h"
 #include "src/core/lib/event_engine/extensions/tcp_trace.h"
 #include "src/core/lib/event_engine/query_extensions.h"
 #include "src/core/lib/experiments/experiments.h"
@@ -169,6 +171,8 @@ static void write_action_end(grpc_core::RefCountedPtr<grpc_chttp2_transport>,
                              grpc_error_handle error);
 static void write_action_end_locked(
     grpc_core::RefCountedPtr<grpc_chttp2_transport>, grpc_error_handle error);
+static void write_coalescing_pass_locked(
+    grpc_core::RefCountedPtr<grpc_chttp2_transport>, grpc_error_handle error);
 
 static void read_action(grpc_core::RefCountedPtr<grpc_chttp2_transport>,
                         grpc_error_handle error);
@@ -193,9 +197,16 @@ static void benign_reclaimer_locked(
     grpc_core::RefCountedPtr<grpc_chttp2_transport>, grpc_error_handle error);
 static void destructive_reclaimer_locked(
     grpc_core::RefCountedPtr<grpc_chttp2_transport>, grpc_error_handle error);
+static void idle_reclaimer_locked(
+    grpc_core::RefCountedPtr<grpc_chttp2_transport>, grpc_error_handle error);
+static void idle_memory_trim_timer_locked(
+    grpc_core::RefCountedPtr<grpc_chttp2_transport>, grpc_error_handle error);
 
 static void post_benign_reclaimer(grpc_chttp2_transport* t);
 static void post_destructive_reclaimer(grpc_chttp2_transport* t);
+static void post_idle_reclaimer(grpc_chttp2_transport* t);
+static void start_idle_memory_trim_timer(grpc_chttp2_transport* t);
+static void restore_trimmed_memory_locked(grpc_chttp2_transport* t);
 
 static void close_transport_locked(grpc_chttp2_transport* t,
                                    grpc_error_handle error);
@@ -210,6 +221,8 @@ static void start_bdp_ping_locked(
     grpc_core::RefCountedPtr<grpc_chttp2_transport>, grpc_error_handle error);
 static void finish_bdp_ping_locked(
     grpc_core::RefCountedPtr<grpc_chttp2_transport>, grpc_error_handle error);
+static void update_tcp_info_bdp_locked(
+    grpc_core::RefCountedPtr<grpc_chttp2_transport> t);
 static void next_bdp_ping_timer_expired(grpc_chttp2_transport* t);
 static void next_bdp_ping_timer_expired_locked(
     grpc_core::RefCountedPtr<grpc_chttp2_transport> tp,
@@ -414,6 +427,7 @@ grpc_chttp2_transport::~grpc_chttp2_transport() {
 
 using grpc_event_engine::experimental::ChannelzExtension;
 using grpc_event_engine::experimental::QueryExtension;
+using grpc_event_engine::experimental::TcpInfoSamplingExtension;
 using grpc_event_engine::experimental::TcpTraceExtension;
 
 static void read_channel_args(grpc_chttp2_transport* t,
@@ -437,6 +451,38 @@ static void read_channel_args(grpc_chttp2_transport* t,
     t->hpack_compressor.SetMaxUsableSize(max_hpack_table_size);
   }
 
+  if (channel_args.GetString(GRPC_ARG_HTTP2_BDP_ESTIMATOR) == "tcp_info") {
+    // Without a min_rtt metric from the endpoint keep timing BDP pings.
+    EventEngine::Endpoint* ee_ep =
+        grpc_event_engine::experimental::grpc_get_wrapped_event_engine_endpoint(
+            t->ep.get());
+    auto telemetry_info =
+        ee_ep == nullptr ? nullptr : ee_ep->GetTelemetryInfo();
+    std::optional<size_t> min_rtt_key =
+        telemetry_info == nullptr ? std::nullopt
+                                  : telemetry_info->GetMetricKey("min_rtt");
+    if (min_rtt_key.has_value()) {
+      t->tcp_info_min_rtt_key = *min_rtt_key;
+      t->flow_control.EnableTcpInfoBdpEstimator(
+          t->peer_string.as_string_view());
+    }
+  }
+
+  t->write_scheduler = grpc_core::Chttp2WriteScheduler(channel_args);
+  t->write_coalescing_policy = grpc_core::Chttp2WriteCoalescingPolicy(
+      std::chrono::microseconds(grpc_core::Clamp(
+          channel_args.GetInt(GRPC_ARG_HTTP2_WRITE_COALESCING_DELAY_US)
+              .value_or(0),
+          0, 1000)),
+      std::max(0, channel_args.GetInt(GRPC_ARG_HTTP2_WRITE_COALESCING_BYTES)
+                      .value_or(16384)));
+
+  t->idle_memory_trim_timeout = std::max(
+      grpc_core::Duration::Zero(),
+      channel_args
+          .GetDurationFromIntMillis(GRPC_ARG_HTTP2_IDLE_MEMORY_TRIM_TIMEOUT_MS)
+          .value_or(grpc_core::Duration::Infinity()));
+
   t->write_buffer_size =
       std::max(0, channel_args.GetInt(GRPC_ARG_HTTP2_WRITE_BUFFER_SIZE)
                       .value_or(grpc_core::chttp2::kDefaultWindow));
@@ -771,6 +817,28 @@ grpc_chttp2_transport::grpc_chttp2_transport(
     }
   }
 
+  const grpc_core::Duration tcp_info_sample_interval =
+      channel_args
+          .GetDurationFromIntMillis(GRPC_ARG_TCP_INFO_SAMPLE_INTERVAL_MS)
+          .value_or(grpc_core::Duration::Zero());
+  if (tcp_info_sample_interval > grpc_core::Duration::Zero() &&
+      grpc_event_engine::experimental::grpc_is_event_engine_endpoint(
+          ep.get())) {
+    auto* sampling_extension = QueryExtension<TcpInfoSamplingExtension>(
+        grpc_event_engine::experimental::grpc_get_wrapped_event_engine_endpoint(
+            ep.get()));
+    if (sampling_extension != nullptr) {
+      auto* stats_plugin_group = channel_args.GetObject<
+          grpc_core::GlobalStatsPluginRegistry::StatsPluginGroup>();
+      sampling_extension->EnableTcpInfoSampling(
+          stats_plugin_group != nullptr
+              ? stats_plugin_group->GetCollectionScope()
+              : grpc_core::GlobalCollectionScope(),
+          channel_args.GetString(GRPC_ARG_DEFAULT_AUTHORITY).value_or(""),
+          tcp_info_sample_interval);
+    }
+  }
+
   if (channel_args.GetBool(GRPC_ARG_SECURITY_FRAME_ALLOWED).value_or(false)) {
     transport_framing_endpoint_extension = QueryExtension<
         grpc_core::TransportFramingEndpointExtension>(
@@ -826,6 +894,8 @@ grpc_chttp2_transport::grpc_chttp2_transport(
 
   grpc_chttp2_initiate_write(this, GRPC_CHTTP2_INITIATE_WRITE_INITIAL_WRITE);
   post_benign_reclaimer(this);
+  post_idle_reclaimer(this);
+  start_idle_memory_trim_timer(this);
   if (grpc_core::test_only_init_callback != nullptr) {
     grpc_core::test_only_init_callback();
   }
@@ -929,6 +999,10 @@ static void close_transport_locked(grpc_chttp2_transport* t,
         t->event_engine->Cancel(t->next_bdp_ping_timer_handle)) {
       t->next_bdp_ping_timer_handle = TaskHandle::kInvalid;
     }
+    if (t->idle_memory_trim_timer_handle != TaskHandle::kInvalid &&
+        t->event_engine->Cancel(t->idle_memory_trim_timer_handle)) {
+      t->idle_memory_trim_timer_handle = TaskHandle::kInvalid;
+    }
     switch (t->keepalive_state) {
       case GRPC_CHTTP2_KEEPALIVE_STATE_WAITING:
         if (t->keepalive_ping_timer_handle != TaskHandle::kInvalid &&
@@ -1015,6 +1089,7 @@ grpc_chttp2_stream::grpc_chttp2_stream(grpc_chttp2_transport* t,
     *t->accepting_stream = this;
     t->stream_map.emplace(id, this);
     post_destructive_reclaimer(t);
+    restore_trimmed_memory_locked(t);
   }
 
   grpc_slice_buffer_init(&frame_storage);
@@ -1137,9 +1212,20 @@ static void set_write_state(grpc_chttp2_transport* t,
 void grpc_chttp2_initiate_write(grpc_chttp2_transport* t,
                                 grpc_chttp2_initiate_write_reason reason) {
   switch (t->write_state) {
-    case GRPC_CHTTP2_WRITE_STATE_IDLE:
+    case GRPC_CHTTP2_WRITE_STATE_IDLE: {
       set_write_state(t, GRPC_CHTTP2_WRITE_STATE_WRITING,
                       grpc_chttp2_initiate_write_reason_string(reason));
+      // On a busy connection, let the closures already queued on the combiner
+      // run first: frames they queue go out in the same write.
+      if (t->write_coalescing_policy.StartHold(
+              t->num_messages_in_next_write)) {
+        t->write_held_for_coalescing = true;
+        t->combiner->Run(
+            grpc_core::InitTransportClosure<write_coalescing_pass_locked>(
+                t->Ref(), &t->write_coalescing_pass_locked),
+            absl::OkStatus());
+        break;
+      }
       // Note that the 'write_action_begin_locked' closure is being scheduled
       // on the 'finally_scheduler' of t->combiner. This means that
       // 'write_action_begin_locked' is called only *after* all the other
@@ -1161,6 +1247,7 @@ void grpc_chttp2_initiate_write(grpc_chttp2_transport* t,
               t->Ref(), &t->write_action_begin_locked),
           absl::OkStatus());
       break;
+    }
     case GRPC_CHTTP2_WRITE_STATE_WRITING:
       set_write_state(t, GRPC_CHTTP2_WRITE_STATE_WRITING_WITH_MORE,
                       grpc_chttp2_initiate_write_reason_string(reason));
@@ -1185,11 +1272,36 @@ static const char* begin_writing_desc(bool partial) {
   }
 }
 
+// Runs once the closures that were queued on the combiner ahead of it have
+// run.  If they added messages to the held back write, takes another pass.
+static void write_coalescing_pass_locked(
+    grpc_core::RefCountedPtr<grpc_chttp2_transport> t,
+    GRPC_UNUSED grpc_error_handle error) {
+  GRPC_DCHECK(error.ok());
+  GRPC_CHECK(t->write_held_for_coalescing);
+  auto* tp = t.get();
+  if (tp->closed_with_error.ok() && tp->write_coalescing_policy.ContinueHold(
+                                        tp->num_messages_in_next_write)) {
+    tp->combiner->Run(
+        grpc_core::InitTransportClosure<write_coalescing_pass_locked>(
+            std::move(t), &tp->write_coalescing_pass_locked),
+        absl::OkStatus());
+    return;
+  }
+  tp->combiner->FinallyRun(
+      grpc_core::InitTransportClosure<write_action_begin_locked>(
+          std::move(t), &tp->write_action_begin_locked),
+      absl::OkStatus());
+}
+
 static void write_action_begin_locked(
     grpc_core::RefCountedPtr<grpc_chttp2_transport> t,
     grpc_error_handle /*error_ignored*/) {
   GRPC_LATENT_SEE_ALWAYS_ON_SCOPE("write_action_begin_locked");
   GRPC_CHECK(t->write_state != GRPC_CHTTP2_WRITE_STATE_IDLE);
+  t->write_coalescing_policy.BeginWrite(
+      std::exchange(t->write_held_for_coalescing, false),
+      t->num_messages_in_next_write);
   grpc_chttp2_begin_write_result r;
   if (!t->closed_with_error.ok()) {
     r.writing = false;
@@ -1253,24 +1365,51 @@ static void write_action(
     t->last_ztrace_time = now;
     trace_ztrace = t->http2_ztrace_collector.IsActive();
   }
-  if (!tcp_call_tracers.empty() || trace_ztrace) {
+  std::shared_ptr<grpc_core::TcpInfoBdpEstimator::Sampler> bdp_sampler;
+  if (auto* tcp_info_est = t->flow_control.tcp_info_bdp_estimator();
+      tcp_info_est != nullptr &&
+      now - t->last_tcp_info_sample_time >
+          grpc_core::Duration::Milliseconds(
+              grpc_core::kDefaultInterPingDelayMillis)) {
+    t->last_tcp_info_sample_time = now;
+    bdp_sampler = tcp_info_est->sampler();
+  }
+  if (!tcp_call_tracers.empty() || trace_ztrace || bdp_sampler != nullptr) {
     EventEngine::Endpoint* ee_ep =
         grpc_event_engine::experimental::grpc_get_wrapped_event_engine_endpoint(
             t->ep.get());
     if (ee_ep != nullptr) {
       auto telemetry_info = ee_ep->GetTelemetryInfo();
       if (telemetry_info != nullptr) {
-        auto metrics_set = telemetry_info->GetFullMetricsSet();
+        const size_t min_rtt_key = t->tcp_info_min_rtt_key;
+        // When only the BDP estimator is listening, ask for just the metric
+        // and the event it uses.
+        const bool bdp_only = tcp_call_tracers.empty() && !trace_ztrace;
+        auto metrics_set =
+            bdp_only ? telemetry_info->GetMetricsSet({min_rtt_key})
+                     : telemetry_info->GetFullMetricsSet();
         args.set_metrics_sink(WriteEventSink(
             std::move(metrics_set),
-            {WriteEvent::kSendMsg, WriteEvent::kScheduled, WriteEvent::kSent,
-             WriteEvent::kAcked, WriteEvent::kClosed},
+            bdp_only ? std::initializer_list<WriteEvent>{WriteEvent::kAcked}
+                     : std::initializer_list<WriteEvent>{
+                           WriteEvent::kSendMsg, WriteEvent::kScheduled,
+                           WriteEvent::kSent, WriteEvent::kAcked,
+                           WriteEvent::kClosed},
             [tcp_call_tracers = std::move(tcp_call_tracers),
              telemetry_info = std::move(telemetry_info),
              ztrace_collector =
-                 trace_ztrace ? &t->http2_ztrace_collector : nullptr](
+                 trace_ztrace ? &t->http2_ztrace_collector : nullptr,
+             bdp_sampler = std::move(bdp_sampler), min_rtt_key](
                 WriteEvent event, absl::Time timestamp,
                 std::vector<WriteMetric> metrics) {
+              if (bdp_sampler != nullptr && event == WriteEvent::kAcked) {
+                for (const auto& metric : metrics) {
+                  if (metric.key == min_rtt_key) {
+                    bdp_sampler->AddSample(
+                        static_cast<uint32_t>(metric.value));
+                  }
+                }
+              }
               if (!tcp_call_tracers.empty()) {
                 std::vector<grpc_core::TcpCallTracer::TcpEventMetric>
                     tcp_metrics;
@@ -1486,6 +1625,7 @@ static void maybe_start_some_streams(grpc_chttp2_transport* t) {
 
     t->stream_map.emplace(s->id, s);
     post_destructive_reclaimer(t);
+    restore_trimmed_memory_locked(t);
     grpc_chttp2_mark_stream_writable(t, s);
     grpc_chttp2_initiate_write(t, GRPC_CHTTP2_INITIATE_WRITE_START_NEW_STREAM);
   }
@@ -1743,6 +1883,8 @@ static void send_message_locked(
                                                   t->write_buffer_size)) {
       grpc_chttp2_mark_stream_writable(t, s);
       grpc_chttp2_initiate_write(t, GRPC_CHTTP2_INITIATE_WRITE_SEND_MESSAGE);
+      t->write_coalescing_policy.AddPendingBytes(GRPC_HEADER_SIZE_IN_BYTES +
+                                                 len);
     }
   }
 }
@@ -2471,6 +2613,7 @@ static grpc_chttp2_transport::RemovedStreamHandle remove_stream(
 
   if (t->stream_map.empty()) {
     post_benign_reclaimer(t);
+    start_idle_memory_trim_timer(t);
     if (t->sent_goaway_state == GRPC_CHTTP2_FINAL_GOAWAY_SENT) {
       close_transport_locked(
           t, GRPC_ERROR_CREATE_REFERENCING(
@@ -3176,6 +3319,10 @@ static void continue_read_action_locked(
 void schedule_bdp_ping_locked(
     grpc_core::RefCountedPtr<grpc_chttp2_transport> t) {
   auto* tp = t.get();
+  if (tp->flow_control.tcp_info_bdp_estimator() != nullptr) {
+    update_tcp_info_bdp_locked(std::move(t));
+    return;
+  }
   tp->flow_control.bdp_estimator()->SchedulePing();
   send_ping_locked(tp,
                    grpc_core::InitTransportClosure<start_bdp_ping>(
@@ -3246,6 +3393,22 @@ static void finish_bdp_ping_locked(
       });
 }
 
+// Takes the place of a BDP ping when the BDP comes from TCP_INFO samples.
+static void update_tcp_info_bdp_locked(
+    grpc_core::RefCountedPtr<grpc_chttp2_transport> t) {
+  if (!t->closed_with_error.ok()) return;
+  grpc_core::Timestamp next_update =
+      t->flow_control.tcp_info_bdp_estimator()->Update();
+  grpc_chttp2_act_on_flowctl_action(t->flow_control.PeriodicUpdate(), t.get(),
+                                    nullptr);
+  GRPC_CHECK(t->next_bdp_ping_timer_handle == TaskHandle::kInvalid);
+  t->next_bdp_ping_timer_handle =
+      t->event_engine->RunAfter(next_update - grpc_core::Timestamp::Now(), [t] {
+        grpc_core::ExecCtx exec_ctx;
+        next_bdp_ping_timer_expired(t.get());
+      });
+}
+
 static void next_bdp_ping_timer_expired(grpc_chttp2_transport* t) {
   t->combiner->Run(
       grpc_core::InitTransportClosure<next_bdp_ping_timer_expired_locked>(
@@ -3258,7 +3421,7 @@ static void next_bdp_ping_timer_expired_locked(
     GRPC_UNUSED grpc_error_handle error) {
   GRPC_DCHECK(error.ok());
   t->next_bdp_ping_timer_handle = TaskHandle::kInvalid;
-  if (t->flow_control.bdp_estimator()->accumulator() == 0) {
+  if (t->flow_control.bdp_accumulator() == 0) {
     // Block the bdp ping till we receive more data.
     t->bdp_ping_blocked = true;
   } else {
@@ -3563,6 +3726,109 @@ static void destructive_reclaimer_locked(
   }
 }
 
+// Gives back the memory an idle connection keeps around for traffic it is
+// not carrying: the peer is asked to stop using the HPACK table we decode
+// with (its entries are dropped, and the table's storage released, once the
+// SETTINGS are acked), our own HPACK value caches are cleared, and the write
+// buffers are reset if nothing is queued in them.
+static void trim_memory_locked(grpc_chttp2_transport* t) {
+  if (t->memory_trimmed || !t->closed_with_error.ok() ||
+      t->sent_goaway_state != GRPC_CHTTP2_NO_GOAWAY_SEND) {
+    return;
+  }
+  GRPC_TRACE_LOG(resource_quota, INFO)
+      << "HTTP2: " << t->peer_string.as_string_view()
+      << " - trim memory of idle connection";
+  t->memory_trimmed = true;
+  t->header_table_size_before_trim = t->settings.local().header_table_size();
+  t->hpack_compressor.ReleaseCachedValues();
+  if (t->write_state == GRPC_CHTTP2_WRITE_STATE_IDLE) {
+    if (t->outbuf.Length() == 0) t->outbuf = grpc_core::SliceBuffer();
+    if (t->qbuf.length == 0) {
+      grpc_slice_buffer_destroy(&t->qbuf);
+      grpc_slice_buffer_init(&t->qbuf);
+    }
+  }
+  if (t->header_table_size_before_trim != 0) {
+    t->settings.mutable_local().SetHeaderTableSize(0);
+    grpc_chttp2_initiate_write(t, GRPC_CHTTP2_INITIATE_WRITE_SEND_SETTINGS);
+  }
+}
+
+static void restore_trimmed_memory_locked(grpc_chttp2_transport* t) {
+  if (t->idle_memory_trim_timer_handle != TaskHandle::kInvalid &&
+      t->event_engine->Cancel(t->idle_memory_trim_timer_handle)) {
+    t->idle_memory_trim_timer_handle = TaskHandle::kInvalid;
+  }
+  if (!t->memory_trimmed) return;
+  t->memory_trimmed = false;
+  if (t->header_table_size_before_trim != 0) {
+    t->settings.mutable_local().SetHeaderTableSize(
+        t->header_table_size_before_trim);
+    grpc_chttp2_initiate_write(t, GRPC_CHTTP2_INITIATE_WRITE_SEND_SETTINGS);
+  }
+  post_idle_reclaimer(t);
+}
+
+static void post_idle_reclaimer(grpc_chttp2_transport* t) {
+  if (!t->idle_reclaimer_registered) {
+    t->idle_reclaimer_registered = true;
+    t->memory_owner.PostReclaimer(
+        grpc_core::ReclamationPass::kIdle,
+        [t = t->Ref()](
+            std::optional<grpc_core::ReclamationSweep> sweep) mutable {
+          if (sweep.has_value()) {
+            auto* tp = t.get();
+            tp->active_reclamation = std::move(*sweep);
+            tp->combiner->Run(
+                grpc_core::InitTransportClosure<idle_reclaimer_locked>(
+                    std::move(t), &tp->idle_reclaimer_locked),
+                absl::OkStatus());
+          }
+        });
+  }
+}
+
+static void idle_reclaimer_locked(
+    grpc_core::RefCountedPtr<grpc_chttp2_transport> t,
+    grpc_error_handle error) {
+  t->idle_reclaimer_registered = false;
+  if (error.ok()) {
+    // Costs the peer some header compression until the next stream restores
+    // the table, but loses no work; connections without streams have
+    // already been asked to go away by the benign reclaimer.
+    trim_memory_locked(t.get());
+  }
+  if (error != absl::CancelledError()) {
+    t->active_reclamation.Finish();
+  }
+}
+
+static void start_idle_memory_trim_timer(grpc_chttp2_transport* t) {
+  if (t->idle_memory_trim_timeout == grpc_core::Duration::Infinity() ||
+      t->memory_trimmed ||
+      t->idle_memory_trim_timer_handle != TaskHandle::kInvalid) {
+    return;
+  }
+  t->idle_memory_trim_timer_handle = t->event_engine->RunAfter(
+      t->idle_memory_trim_timeout, [t = t->Ref()]() mutable {
+        grpc_core::ExecCtx exec_ctx;
+        auto* tp = t.get();
+        tp->combiner->Run(
+            grpc_core::InitTransportClosure<idle_memory_trim_timer_locked>(
+                std::move(t), &tp->idle_memory_trim_timer_locked),
+            absl::OkStatus());
+      });
+}
+
+static void idle_memory_trim_timer_locked(
+    grpc_core::RefCountedPtr<grpc_chttp2_transport> t,
+    GRPC_UNUSED grpc_error_handle error) {
+  GRPC_DCHECK(error.ok());
+  t->idle_memory_trim_timer_handle = TaskHandle::kInvalid;
+  if (t->stream_map.empty()) trim_memory_locked(t.get());
+}
+
 //
 // MONITORING
 //
@@ -199,7 +199,7 @@ FlowControlAction TransportFlowControl::UpdateAction(FlowControlAction action) {
 double
 TransportFlowControl::TargetInitialWindowSizeBasedOnMemoryPressureAndBdp()
     const {
-  const double bdp = bdp_estimator_.EstimateBdp() * 2.0;
+  const double bdp = bdp_estimate() * 2.0;
   const double memory_pressure =
       memory_owner_->GetPressureInfo().pressure_control_value;
   // Linear interpolation between two values.
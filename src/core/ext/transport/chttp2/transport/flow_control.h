@@ -36,6 +36,7 @@
 #include "src/core/lib/debug/trace.h"
 #include "src/core/lib/resource_quota/memory_quota.h"
 #include "src/core/lib/transport/bdp_estimator.h"
+#include "src/core/lib/transport/tcp_info_bdp_estimator.h"
 #include "src/core/util/grpc_check.h"
 #include "src/core/util/time.h"
 #include "absl/container/flat_hash_set.h"
@@ -208,6 +209,23 @@ class TransportFlowControl final {
   ~TransportFlowControl() {}
 
   bool bdp_probe() const { return enable_bdp_probe_; }
+
+  // Estimates the BDP from TCP_INFO samples instead of BDP pings.  Must be
+  // called before the first PeriodicUpdate().
+  void EnableTcpInfoBdpEstimator(absl::string_view peer_name) {
+    tcp_info_bdp_estimator_.emplace(peer_name);
+  }
+  // Returns nullptr unless EnableTcpInfoBdpEstimator() was called.
+  TcpInfoBdpEstimator* tcp_info_bdp_estimator() {
+    return tcp_info_bdp_estimator_.has_value() ? &*tcp_info_bdp_estimator_
+                                               : nullptr;
+  }
+  // Bytes received since the active estimator last took a sample.
+  int64_t bdp_accumulator() const {
+    return tcp_info_bdp_estimator_.has_value()
+               ? tcp_info_bdp_estimator_->accumulator()
+               : bdp_estimator_.accumulator();
+  }
   bool ph2_enable_rx_crypto() const { return ph2_enable_rx_crypto_; }
   void set_ph2_enable_rx_crypto(const bool enable) {
     ph2_enable_rx_crypto_ = enable;
@@ -407,10 +425,12 @@ class TransportFlowControl final {
     stats.announced_window = announced_window();
     stats.announced_stream_total_over_incoming_window =
         announced_stream_total_over_incoming_window();
-    stats.bdp_accumulator = bdp_estimator_.accumulator();
+    stats.bdp_accumulator = bdp_accumulator();
     stats.bdp_ping_blocked = bdp_ping_blocked_;
-    stats.bdp_estimate = bdp_estimator_.EstimateBdp();
-    stats.bdp_bw_est = bdp_estimator_.EstimateBandwidth();
+    stats.bdp_estimate = bdp_estimate();
+    stats.bdp_bw_est = tcp_info_bdp_estimator_.has_value()
+                           ? tcp_info_bdp_estimator_->EstimateBandwidth()
+                           : bdp_estimator_.EstimateBandwidth();
     return stats;
   }
 
@@ -492,6 +512,11 @@ class TransportFlowControl final {
     }
   }
 
+  int64_t bdp_estimate() const {
+    return tcp_info_bdp_estimator_.has_value()
+               ? tcp_info_bdp_estimator_->EstimateBdp()
+               : bdp_estimator_.EstimateBdp();
+  }
   double TargetInitialWindowSizeBasedOnMemoryPressureAndBdp() const;
   int64_t target_window() const;
   int64_t target_frame_size() const { return target_frame_size_; }
@@ -533,6 +558,9 @@ class TransportFlowControl final {
   bool bdp_ping_blocked_;
   Waker bdp_waker_;
   BdpEstimator bdp_estimator_;
+  // Set when the channel selects the TCP_INFO based estimator, in which case
+  // it replaces bdp_estimator_.
+  std::optional<TcpInfoBdpEstimator> tcp_info_bdp_estimator_;
 
   int64_t remote_window_ = kDefaultWindow;
   int64_t target_initial_window_size_ = kDefaultWindow;
@@ -364,6 +364,11 @@ class HPackCompressor {
   void SetMaxTableSize(uint32_t max_table_size);
   void SetMaxUsableSize(uint32_t max_table_size);
 
+  // Forget which values the dynamic table holds, releasing the copies kept to
+  // recognize them.  Later headers are encoded as though the table started
+  // empty; the entries the peer already holds age out as new ones arrive.
+  void ReleaseCachedValues() { compression_state_ = {}; }
+
   uint32_t test_only_table_size() const {
     return table_.test_only_table_size();
   }
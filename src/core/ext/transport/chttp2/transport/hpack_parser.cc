@@ -739,7 +739,8 @@ class HPackParser::Parser {
     }
   }
 
-  bool FinishHeaderAndAddToTable(HPackTable::Memento md) {
+  bool FinishHeaderAndAddToTable(HPackTable::Memento md,
+                                 absl::string_view value) {
     // Log if desired
     if (GRPC_TRACE_FLAG_ENABLED(chttp2_hpack_parser)) {
       LogHeader(md);
@@ -747,7 +748,7 @@ class HPackParser::Parser {
     // Emit whilst we own the metadata.
     EmitHeader(md);
     // Add to the hpack table
-    if (GPR_UNLIKELY(!state_.hpack_table.Add(std::move(md)))) {
+    if (GPR_UNLIKELY(!state_.hpack_table.Add(std::move(md), value))) {
       input_->SetErrorAndStopParsing(
           HpackParseResult::AddBeforeTableSizeUpdated(
               state_.hpack_table.current_table_bytes(),
@@ -1036,7 +1037,9 @@ class HPackParser::Parser {
     input_->UpdateFrontier();
     state_.parse_state = ParseState::kTop;
     if (state_.add_to_table) {
-      return FinishHeaderAndAddToTable(std::move(memento));
+      // Take() copied the value, so it is still available to the table.
+      return FinishHeaderAndAddToTable(std::move(memento),
+                                       value.value.string_view());
     } else {
       FinishHeaderOmitFromTable(memento);
       return true;
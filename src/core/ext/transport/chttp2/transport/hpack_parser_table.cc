@@ -24,6 +24,8 @@
 #include <algorithm>
 #include <cstddef>
 #include <cstring>
+#include <memory>
+#include <string>
 #include <utility>
 
 #include "src/core/ext/transport/chttp2/transport/hpack_constants.h"
@@ -40,59 +42,192 @@
 
 namespace grpc_core {
 
-void HPackTable::MementoRingBuffer::Put(Memento m) {
+void HPackTable::EntryRingBuffer::Put(Memento m, absl::string_view value) {
   GRPC_CHECK_LT(num_entries_, max_entries_);
+  const absl::string_view key = m.md.key();
+  const uint32_t length = key.size() + value.size();
+  ReserveBytes(length);
+  uint32_t offset = (bytes_begin_ + bytes_used_) % bytes_capacity_;
+  Entry entry{offset, static_cast<uint32_t>(key.size()),
+              static_cast<uint32_t>(value.size()), m.md.transport_size(),
+              UniquePtrWithBitset<HpackParseResult, 1>(
+                  m.parse_status == nullptr
+                      ? nullptr
+                      : std::make_unique<HpackParseResult>(*m.parse_status))};
+  for (absl::string_view part : {key, value}) {
+    if (part.empty()) continue;
+    const uint32_t first_part =
+        std::min<uint32_t>(part.size(), bytes_capacity_ - offset);
+    memcpy(bytes_.get() + offset, part.data(), first_part);
+    memcpy(bytes_.get(), part.data() + first_part, part.size() - first_part);
+    offset = (offset + part.size()) % bytes_capacity_;
+  }
+  bytes_used_ += length;
+  // m itself is dropped: most entries are looked up on later requests, if at
+  // all, and the memento is rebuilt then.
   if (entries_.size() < max_entries_) {
     ++num_entries_;
-    return entries_.push_back(std::move(m));
+    return entries_.push_back(std::move(entry));
   }
   size_t index = (first_entry_ + num_entries_) % max_entries_;
-  if (timestamp_index_ == kNoTimestamp) {
-    timestamp_index_ = index;
+  if (timestamp_id_ == kNoEntry) {
+    timestamp_id_ = first_id_ + num_entries_;
     timestamp_ = Timestamp::Now();
   }
-  entries_[index] = std::move(m);
+  entries_[index] = std::move(entry);
   ++num_entries_;
 }
 
-auto HPackTable::MementoRingBuffer::PopOne() -> Memento {
+uint32_t HPackTable::EntryRingBuffer::PopOne() {
   GRPC_CHECK_GT(num_entries_, 0u);
-  size_t index = first_entry_ % max_entries_;
-  if (index == timestamp_index_) {
+  const uint64_t id = first_id_;
+  if (id == timestamp_id_) {
     http2_stats_collector_->IncrementHttp2HpackEntryLifetime(
         (Timestamp::Now() - timestamp_).millis());
-    timestamp_index_ = kNoTimestamp;
+    timestamp_id_ = kNoEntry;
   }
-  ++first_entry_;
-  --num_entries_;
-  auto& entry = entries_[index];
-  if (!entry.parse_status.TestBit(Memento::kUsedBit)) {
+  if (materialized_ != nullptr) {
+    auto& materialized = materialized_[id % kMaterializedEntries];
+    if (materialized.id == id) materialized = {};
+  }
+  Entry& entry = EntryAt(0);
+  entry.memento.reset();
+  if (!entry.parse_status.TestBit(Entry::kUsedBit)) {
     http2_stats_collector_->IncrementHttp2HpackMisses();
   }
-  return std::move(entry);
+  const uint32_t length = entry.key_length + entry.value_length;
+  bytes_used_ -= length;
+  bytes_begin_ =
+      bytes_used_ == 0 ? 0 : (bytes_begin_ + length) % bytes_capacity_;
+  entry.parse_status = nullptr;
+  ++first_entry_;
+  ++first_id_;
+  --num_entries_;
+  return entry.transport_size;
 }
 
-auto HPackTable::MementoRingBuffer::Lookup(uint32_t index) -> const Memento* {
+auto HPackTable::EntryRingBuffer::Lookup(uint32_t index) -> const Memento* {
   if (index >= num_entries_) return nullptr;
-  uint32_t offset = (num_entries_ - 1u - index + first_entry_) % max_entries_;
-  auto& entry = entries_[offset];
-  const bool was_used = entry.parse_status.TestBit(Memento::kUsedBit);
-  entry.parse_status.SetBit(Memento::kUsedBit);
+  const uint32_t position = num_entries_ - 1u - index;
+  Entry& entry = EntryAt(position);
+  if (entry.memento != nullptr) return entry.memento.get();
+  const bool was_used = entry.parse_status.TestBit(Entry::kUsedBit);
+  entry.parse_status.SetBit(Entry::kUsedBit);
   if (!was_used) http2_stats_collector_->IncrementHttp2HpackHits();
-  return &entry;
+  const uint64_t id = first_id_ + position;
+  if (materialized_ == nullptr) {
+    materialized_ = std::make_unique<MaterializedEntry[]>(kMaterializedEntries);
+  }
+  auto& materialized = materialized_[id % kMaterializedEntries];
+  if (was_used) {
+    // The entry is being reused: keep its memento so that later lookups do
+    // not parse it again.
+    if (materialized.id == id) {
+      entry.memento =
+          std::make_unique<Memento>(std::move(materialized.memento));
+      materialized = {};
+    } else {
+      entry.memento = std::make_unique<Memento>(Materialize(entry));
+    }
+    return entry.memento.get();
+  }
+  if (materialized.id != id) materialized = {id, Materialize(entry)};
+  return &materialized.memento;
 }
 
-auto HPackTable::MementoRingBuffer::Peek(uint32_t index) const
-    -> const Memento* {
-  if (index >= num_entries_) return nullptr;
-  uint32_t offset = (num_entries_ - 1u - index + first_entry_) % max_entries_;
-  return &entries_[offset];
+size_t HPackTable::EntryRingBuffer::num_kept_mementos() const {
+  size_t n = 0;
+  for (uint32_t i = 0; i < num_entries_; i++) {
+    if (EntryAt(i).memento != nullptr) ++n;
+  }
+  return n;
+}
+
+auto HPackTable::EntryRingBuffer::Materialize(const Entry& entry) const
+    -> Memento {
+  // Keys are short, and rarely wrap around the end of the ring.
+  std::string wrapped_key;
+  absl::string_view key;
+  if (entry.offset + entry.key_length <= bytes_capacity_) {
+    key = absl::string_view(
+        reinterpret_cast<const char*>(bytes_.get()) + entry.offset,
+        entry.key_length);
+  } else {
+    wrapped_key.resize(entry.key_length);
+    CopyBytes(entry.offset, entry.key_length,
+              reinterpret_cast<uint8_t*>(wrapped_key.data()));
+    key = wrapped_key;
+  }
+  auto value = MutableSlice::CreateUninitialized(entry.value_length);
+  CopyBytes((entry.offset + entry.key_length) % std::max(bytes_capacity_, 1u),
+            entry.value_length, value.data());
+  return Memento{
+      grpc_metadata_batch::Parse(
+          key, Slice(std::move(value)), true, entry.transport_size,
+          // Any error was recorded in parse_status when the entry was added.
+          [](absl::string_view, const Slice&) {}),
+      entry.parse_status == nullptr
+          ? nullptr
+          : std::make_unique<HpackParseResult>(*entry.parse_status)};
 }
 
-void HPackTable::MementoRingBuffer::Rebuild(uint32_t max_entries) {
+void HPackTable::EntryRingBuffer::CopyBytes(uint32_t offset, uint32_t length,
+                                            uint8_t* out) const {
+  if (length == 0) return;
+  const uint32_t first_part = std::min(length, bytes_capacity_ - offset);
+  memcpy(out, bytes_.get() + offset, first_part);
+  memcpy(out + first_part, bytes_.get(), length - first_part);
+}
+
+void HPackTable::EntryRingBuffer::ReserveBytes(uint32_t length) {
+  const uint32_t needed = bytes_used_ + length;
+  if (needed <= bytes_capacity_ && bytes_capacity_ != 0) return;
+  // Grow geometrically up to the table size; only entries whose values were
+  // longer than their size on the wire need more than that.
+  ReallocateBytes(std::max(
+      {needed, std::min(std::max(2 * bytes_capacity_, kMinBytesCapacity),
+                        max_bytes_),
+       1u}));
+}
+
+void HPackTable::EntryRingBuffer::ReallocateBytes(uint32_t capacity) {
+  GRPC_DCHECK_GE(capacity, bytes_used_);
+  std::unique_ptr<uint8_t[]> bytes;
+  if (capacity != 0) {
+    bytes.reset(new uint8_t[capacity]);
+    // Entries are laid out in order from the start of the new storage.
+    uint32_t offset = 0;
+    for (uint32_t i = 0; i < num_entries_; i++) {
+      Entry& entry = EntryAt(i);
+      const uint32_t length = entry.key_length + entry.value_length;
+      CopyBytes(entry.offset, length, bytes.get() + offset);
+      entry.offset = offset;
+      offset += length;
+    }
+  }
+  bytes_ = std::move(bytes);
+  bytes_capacity_ = capacity;
+  bytes_begin_ = 0;
+}
+
+void HPackTable::EntryRingBuffer::Rebuild(uint32_t max_entries,
+                                          uint32_t max_bytes) {
+  max_bytes_ = max_bytes;
   if (max_entries == max_entries_) return;
   max_entries_ = max_entries;
-  std::vector<Memento> entries;
+  Compact();
+}
+
+void HPackTable::EntryRingBuffer::ShrinkToFit() {
+  materialized_.reset();
+  for (uint32_t i = 0; i < num_entries_; i++) EntryAt(i).memento.reset();
+  if (bytes_capacity_ != bytes_used_) ReallocateBytes(bytes_used_);
+  if (entries_.capacity() == num_entries_) return;
+  Compact();
+}
+
+void HPackTable::EntryRingBuffer::Compact() {
+  std::vector<Entry> entries;
   entries.reserve(num_entries_);
   for (size_t i = 0; i < num_entries_; i++) {
     entries.push_back(
@@ -103,26 +238,25 @@ void HPackTable::MementoRingBuffer::Rebuild(uint32_t max_entries) {
 }
 
 template <typename F>
-void HPackTable::MementoRingBuffer::ForEach(F f) const {
-  uint32_t index = 0;
-  while (auto* m = Peek(index++)) {
-    f(index, *m);
+void HPackTable::EntryRingBuffer::ForEach(F f) const {
+  for (uint32_t index = 0; index < num_entries_; index++) {
+    f(index + 1, Materialize(EntryAt(num_entries_ - 1u - index)));
   }
 }
 
-HPackTable::MementoRingBuffer::~MementoRingBuffer() {
-  ForEach([this](uint32_t, const Memento& m) {
-    if (!m.parse_status.TestBit(Memento::kUsedBit)) {
+HPackTable::EntryRingBuffer::~EntryRingBuffer() {
+  for (uint32_t i = 0; i < num_entries_; i++) {
+    if (!EntryAt(i).parse_status.TestBit(Entry::kUsedBit)) {
       http2_stats_collector_->IncrementHttp2HpackMisses();
     }
-  });
+  }
 }
 
 // Evict one element from the table
 void HPackTable::EvictOne() {
-  auto first_entry = entries_.PopOne();
-  GRPC_CHECK(first_entry.md.transport_size() <= mem_used_);
-  mem_used_ -= first_entry.md.transport_size();
+  const uint32_t transport_size = entries_.PopOne();
+  GRPC_CHECK(transport_size <= mem_used_);
+  mem_used_ -= transport_size;
 }
 
 void HPackTable::SetHttp2StatsCollector(
@@ -135,10 +269,14 @@ void HPackTable::SetMaxBytes(uint32_t max_bytes) {
     return;
   }
   GRPC_TRACE_LOG(http, INFO) << "Update hpack parser max size to " << max_bytes;
+  const bool shrinking = max_bytes < max_bytes_;
   while (mem_used_ > max_bytes) {
     EvictOne();
   }
   max_bytes_ = max_bytes;
+  // A smaller limit is usually a request to save memory, so give back the
+  // storage the evicted entries were using.
+  if (shrinking) entries_.ShrinkToFit();
 }
 
 bool HPackTable::SetCurrentTableSize(uint32_t bytes) {
@@ -151,11 +289,11 @@ bool HPackTable::SetCurrentTableSize(uint32_t bytes) {
   current_table_bytes_ = bytes;
   uint32_t new_cap = std::max(hpack_constants::EntriesForBytes(bytes),
                               hpack_constants::kInitialTableEntries);
-  entries_.Rebuild(new_cap);
+  entries_.Rebuild(new_cap, bytes);
   return true;
 }
 
-bool HPackTable::Add(Memento md) {
+bool HPackTable::Add(Memento md, absl::string_view value) {
   if (current_table_bytes_ > max_bytes_) return false;
 
   // we can't add elements bigger than the max table size
@@ -172,7 +310,7 @@ bool HPackTable::Add(Memento md) {
 
   // copy the finalized entry in
   mem_used_ += md.md.transport_size();
-  entries_.Put(std::move(md));
+  entries_.Put(std::move(md), value);
   return true;
 }
 
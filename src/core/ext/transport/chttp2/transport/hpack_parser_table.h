@@ -36,6 +36,7 @@
 #include "src/core/util/no_destruct.h"
 #include "src/core/util/unique_ptr_with_bitset.h"
 #include "absl/functional/function_ref.h"
+#include "absl/strings/string_view.h"
 
 namespace grpc_core {
 
@@ -58,10 +59,7 @@ class HPackTable {
 
   struct Memento {
     ParsedMetadata<grpc_metadata_batch> md;
-    // Alongside parse_status we store one bit indicating whether this memento
-    // has been looked up (and therefore consumed) or not.
-    UniquePtrWithBitset<HpackParseResult, 1> parse_status;
-    static const int kUsedBit = 0;
+    std::unique_ptr<HpackParseResult> parse_status;
   };
 
   // Lookup, but don't ref.
@@ -79,8 +77,9 @@ class HPackTable {
     }
   }
 
-  // add a table entry to the index
-  GRPC_MUST_USE_RESULT bool Add(Memento md);
+  // add a table entry to the index; value is the value of md as it is to be
+  // handed to grpc_metadata_batch::Parse when the entry is looked up again
+  GRPC_MUST_USE_RESULT bool Add(Memento md, absl::string_view value);
   void AddLargerThanCurrentTableSize();
 
   // Current entry count in the table.
@@ -89,6 +88,22 @@ class HPackTable {
   // Current size of the table.
   uint32_t test_only_table_size() const { return mem_used_; }
 
+  // Number of entries the table has storage for.
+  size_t test_only_capacity() const { return entries_.capacity(); }
+
+  // Number of key and value bytes the table has storage for.
+  size_t test_only_bytes_capacity() const { return entries_.bytes_capacity(); }
+
+  // Number of first lookups the table keeps mementos for.
+  size_t test_only_materialized_capacity() const {
+    return entries_.materialized_capacity();
+  }
+
+  // Number of entries whose mementos are kept until they are evicted.
+  size_t test_only_num_kept_mementos() const {
+    return entries_.num_kept_mementos();
+  }
+
   // Maximum allowed size of the table currently
   uint32_t max_bytes() const { return max_bytes_; }
   uint32_t current_table_bytes() const { return current_table_bytes_; }
@@ -102,44 +117,109 @@ class HPackTable {
     Memento memento[hpack_constants::kLastStaticEntry];
   };
 
-  class MementoRingBuffer {
+  // Dynamic table entries.  The key and value bytes of every entry are packed
+  // into one ring of bytes, with a small fixed size record per entry to find
+  // them.  Mementos are built from those bytes when an entry is first looked
+  // up, and kept with the entry once it is looked up again, so that entries
+  // reused across requests are parsed once and entries never reused cost no
+  // more than their bytes.
+  class EntryRingBuffer {
    public:
-    MementoRingBuffer()
+    EntryRingBuffer()
         : http2_stats_collector_(CreateHttp2StatsCollector(nullptr)) {}
-    ~MementoRingBuffer();
+    ~EntryRingBuffer();
 
-    MementoRingBuffer(const MementoRingBuffer&) = delete;
-    MementoRingBuffer& operator=(const MementoRingBuffer&) = delete;
-    MementoRingBuffer(MementoRingBuffer&&) = default;
-    MementoRingBuffer& operator=(MementoRingBuffer&&) = default;
+    EntryRingBuffer(const EntryRingBuffer&) = delete;
+    EntryRingBuffer& operator=(const EntryRingBuffer&) = delete;
+    EntryRingBuffer(EntryRingBuffer&&) = default;
+    EntryRingBuffer& operator=(EntryRingBuffer&&) = default;
 
     void SetHttp2StatsCollector(
         std::shared_ptr<Http2StatsCollector> http2_stats_collector) {
       http2_stats_collector_ = http2_stats_collector;
     }
 
-    // Rebuild this buffer with a new max_entries_ size.
-    void Rebuild(uint32_t max_entries);
+    // Rebuild this buffer with a new max_entries_ size, and a new limit on
+    // the bytes its entries may hold.
+    void Rebuild(uint32_t max_entries, uint32_t max_bytes);
+
+    // Release storage not needed by the current entries.
+    void ShrinkToFit();
 
-    // Put a new memento.
+    // Put a new entry, whose key and parse status come from md and whose
+    // value bytes are value.
     // REQUIRES: num_entries < max_entries
-    void Put(Memento m);
+    void Put(Memento md, absl::string_view value);
 
-    // Pop the oldest memento.
+    // Pop the oldest entry, returning its transport size.
     // REQUIRES: num_entries > 0
-    Memento PopOne();
+    uint32_t PopOne();
 
     // Lookup the entry at index, or return nullptr if none exists.
+    // The result is valid until the next call that changes this buffer.
     const Memento* Lookup(uint32_t index);
-    const Memento* Peek(uint32_t index) const;
 
     template <typename F>
     void ForEach(F f) const;
 
     uint32_t max_entries() const { return max_entries_; }
     uint32_t num_entries() const { return num_entries_; }
+    size_t capacity() const { return entries_.capacity(); }
+    size_t bytes_capacity() const { return bytes_capacity_; }
+    size_t materialized_capacity() const {
+      return materialized_ == nullptr ? 0 : kMaterializedEntries;
+    }
+    size_t num_kept_mementos() const;
 
    private:
+    struct Entry {
+      // Offset in bytes_ of the key, which the value directly follows.
+      // Either may wrap around the end of bytes_.
+      uint32_t offset;
+      uint32_t key_length;
+      uint32_t value_length;
+      uint32_t transport_size;
+      // Alongside parse_status we store one bit indicating whether this entry
+      // has been looked up (and therefore consumed) or not.
+      UniquePtrWithBitset<HpackParseResult, 1> parse_status;
+      static const int kUsedBit = 0;
+      // Set on the second lookup, and kept until the entry is evicted or the
+      // table is trimmed.
+      std::unique_ptr<Memento> memento;
+    };
+
+    // A memento built from an entry, tagged with the id of that entry.
+    struct MaterializedEntry {
+      uint64_t id = kNoEntry;
+      Memento memento;
+    };
+
+    // Mementos kept for entries looked up once: enough for an entry to be
+    // looked up and used before the next few lookups replace it.
+    static constexpr uint32_t kMaterializedEntries = 4;
+    // Ids count up from zero, and 64 bits of them never run out.
+    static constexpr uint64_t kNoEntry = std::numeric_limits<uint64_t>::max();
+    // Smallest ring of bytes worth allocating.
+    static constexpr uint32_t kMinBytesCapacity = 256;
+
+    // Entry at position i, counting from the oldest.
+    Entry& EntryAt(uint32_t i) {
+      return entries_[(first_entry_ + i) % max_entries_];
+    }
+    const Entry& EntryAt(uint32_t i) const {
+      return entries_[(first_entry_ + i) % max_entries_];
+    }
+
+    Memento Materialize(const Entry& entry) const;
+    // Copy length bytes starting at offset out of the ring.
+    void CopyBytes(uint32_t offset, uint32_t length, uint8_t* out) const;
+    // Make room for length more bytes.
+    void ReserveBytes(uint32_t length);
+    // Move the live bytes into storage of the given capacity.
+    void ReallocateBytes(uint32_t capacity);
+    // Move the live entries into storage sized for exactly them.
+    void Compact();
+
     // The index of the first entry in the buffer. May be greater than
     // max_entries_, in which case a wraparound has occurred.
     uint32_t first_entry_ = 0;
@@ -148,16 +228,30 @@ class HPackTable {
     // Maximum number of entries we could possibly fit in the table, given
     // defined overheads.
     uint32_t max_entries_ = hpack_constants::kInitialTableEntries;
-    // Which index holds a timestamp (or kNoTimestamp if none do).
-    static constexpr uint32_t kNoTimestamp =
-        std::numeric_limits<uint32_t>::max();
-    uint32_t timestamp_index_ = kNoTimestamp;
-    // The timestamp associated with timestamp_entry_.
+    // Id of the oldest entry: ids count every entry ever added, and key the
+    // materialized entries.
+    uint64_t first_id_ = 0;
+    // Which entry id holds a timestamp (or kNoEntry if none do).
+    uint64_t timestamp_id_ = kNoEntry;
+    // The timestamp associated with timestamp_id_.
     Timestamp timestamp_;
 
     std::shared_ptr<Http2StatsCollector> http2_stats_collector_ = nullptr;
 
-    std::vector<Memento> entries_;
+    std::vector<Entry> entries_;
+
+    // Ring of key and value bytes, starting at bytes_begin_.
+    std::unique_ptr<uint8_t[]> bytes_;
+    uint32_t bytes_capacity_ = 0;
+    uint32_t bytes_begin_ = 0;
+    uint32_t bytes_used_ = 0;
+    // Limit on bytes_capacity_ when growing; entries holding more than this
+    // are still stored.
+    uint32_t max_bytes_ = hpack_constants::kInitialTableSize;
+
+    // Mementos of entries looked up once, in a slot picked by id.  Not
+    // allocated until the first lookup.
+    std::unique_ptr<MaterializedEntry[]> materialized_;
   };
 
   const Memento* LookupDynamic(uint32_t index) {
@@ -181,7 +275,7 @@ class HPackTable {
   // The currently agreed size of the table, according to the hpack algorithm.
   uint32_t current_table_bytes_ = hpack_constants::kInitialTableSize;
   // HPack table entries
-  MementoRingBuffer entries_;
+  EntryRingBuffer entries_;
   // Static mementos
   const StaticMementos* static_mementos_ = GetStaticMementos();
 };
@@ -23,6 +23,7 @@
 #include <grpc/support/port_platform.h>
 #include <limits.h>
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
@@ -932,9 +933,11 @@ absl::Status Http2ClientTransport::DequeueStreamFrames(
   // available transport tokens can only range from 0 to 2^31 - 1,
   // we are clamping the write_bytes_remaining_ to that range.
   FrameSender frame_sender = write_cycle.GetFrameSender();
-  const uint32_t tokens = GetMaxPermittedDequeue(
-      flow_control_, stream->GetStreamFlowControl(),
-      write_cycle.GetWriteBytesRemaining(), settings_->peer());
+  const uint32_t tokens = std::min(
+      GetMaxPermittedDequeue(flow_control_, stream->GetStreamFlowControl(),
+                             write_cycle.GetWriteBytesRemaining(),
+                             settings_->peer()),
+      write_scheduler_.BeginTurn(stream->write_scheduler_state()));
   const uint32_t stream_flow_control_tokens =
       static_cast<uint32_t>(GetStreamFlowControlTokens(
           stream->GetStreamFlowControl(), settings_->peer()));
@@ -946,6 +949,9 @@ absl::Status Http2ClientTransport::DequeueStreamFrames(
                             frame_sender);
   ProcessOutgoingDataFrameFlowControl(stream->GetStreamFlowControl(),
                                       result.flow_control_tokens_consumed);
+  write_scheduler_.EndTurn(result.flow_control_tokens_consumed,
+                           result.is_writable,
+                           stream->write_scheduler_state());
   if (result.is_writable) {
     // Stream is still writable. Enqueue it back to the writable
     // stream list.
@@ -1278,6 +1284,7 @@ void Http2ClientTransport::ReadChannelArgs(const ChannelArgs& channel_args,
   read_context_.set_soft_limit(args.max_header_list_size_soft_limit);
   keepalive_permit_without_calls_ = args.keepalive_permit_without_calls;
   test_only_ack_pings_ = args.test_only_ack_pings;
+  write_scheduler_ = Chttp2WriteScheduler(channel_args);
 
   if (args.initial_sequence_number > 0) {
     next_stream_id_ = args.initial_sequence_number;
@@ -1754,6 +1761,8 @@ auto Http2ClientTransport::CallOutboundLoop(RefCountedPtr<Stream> stream) {
 
   auto send_initial_metadata =
       [this, stream](ClientMetadataHandle&& metadata) mutable {
+        write_scheduler_.SetWeightFromMetadata(
+            *metadata, stream->write_scheduler_state());
         absl::StatusOr<StreamWritabilityUpdate> enqueue_result =
             stream->EnqueueInitialMetadata(
                 std::forward<ClientMetadataHandle>(metadata));
@@ -49,6 +49,7 @@
 #include "src/core/ext/transport/chttp2/transport/stream_data_queue.h"
 #include "src/core/ext/transport/chttp2/transport/writable_streams.h"
 #include "src/core/ext/transport/chttp2/transport/write_cycle.h"
+#include "src/core/ext/transport/chttp2/transport/write_scheduler.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/iomgr/iomgr_fwd.h"
 #include "src/core/lib/promise/activity.h"
@@ -716,6 +717,9 @@ class Http2ClientTransport final : public ClientTransport,
   MemoryOwner memory_owner_;
   chttp2::TransportFlowControl flow_control_;
   WritableStreams<RefCountedPtr<Stream>> writable_stream_list_;
+  // Limits how much data a stream may write each time it is dequeued from
+  // writable_stream_list_.
+  Chttp2WriteScheduler write_scheduler_;
 
   RefCountedPtr<SecurityFrameHandler> security_frame_handler_;
   std::shared_ptr<PromiseHttp2ZTraceCollector> ztrace_collector_;
@@ -39,6 +39,8 @@ class Http2SettingsManager {
   Http2Settings& mutable_peer() { return peer_; }
 
   const Http2Settings& local() const { return local_; }
+  // The settings last handed out by MaybeSendUpdate(), acked or not.
+  const Http2Settings& sent() const { return sent_; }
   // Before the first SETTINGS ACK frame is received acked_ will hold the
   // default values.
   const Http2Settings& acked() const { return acked_; }
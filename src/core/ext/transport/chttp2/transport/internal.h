@@ -55,6 +55,7 @@
 #include "src/core/ext/transport/chttp2/transport/ping_callbacks.h"
 #include "src/core/ext/transport/chttp2/transport/ping_rate_policy.h"
 #include "src/core/ext/transport/chttp2/transport/transport_common.h"
+#include "src/core/ext/transport/chttp2/transport/write_scheduler.h"
 #include "src/core/ext/transport/chttp2/transport/write_size_policy.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/debug/trace.h"
@@ -378,6 +379,7 @@ struct grpc_chttp2_transport final : public grpc_core::FilterStackTransport,
 
   grpc_closure write_action_begin_locked;
   grpc_closure write_action_end_locked;
+  grpc_closure write_coalescing_pass_locked;
 
   grpc_closure read_action_locked;
 
@@ -518,6 +520,22 @@ struct grpc_chttp2_transport final : public grpc_core::FilterStackTransport,
   grpc_closure benign_reclaimer_locked;
   /// destructive cleanup closure
   grpc_closure destructive_reclaimer_locked;
+  /// idle cleanup closure
+  grpc_closure idle_reclaimer_locked;
+
+  // idle memory trimming
+  /// Closure to run when the connection has been idle for
+  /// idle_memory_trim_timeout
+  grpc_closure idle_memory_trim_timer_locked;
+  grpc_event_engine::experimental::EventEngine::TaskHandle
+      idle_memory_trim_timer_handle =
+          grpc_event_engine::experimental::EventEngine::TaskHandle::kInvalid;
+  /// how long the connection must have no streams before it trims its memory
+  grpc_core::Duration idle_memory_trim_timeout =
+      grpc_core::Duration::Infinity();
+  /// local header table size to restore once the trimmed connection is used
+  /// again
+  uint32_t header_table_size_before_trim = 0;
 
   // next bdp ping timer handle
   grpc_event_engine::experimental::EventEngine::TaskHandle
@@ -576,6 +594,12 @@ struct grpc_chttp2_transport final : public grpc_core::FilterStackTransport,
 
   /// policy for how much data we're willing to put into one http2 write
   grpc_core::Chttp2WriteSizePolicy write_size_policy;
+  /// how writes are shared between streams
+  grpc_core::Chttp2WriteScheduler write_scheduler;
+  /// policy for holding back writes so that several streams share one
+  grpc_core::Chttp2WriteCoalescingPolicy write_coalescing_policy;
+  /// was the write about to begin held back by write_coalescing_policy?
+  bool write_held_for_coalescing = false;
 
   bool reading_paused_on_pending_induced_frames = false;
   /// Based on channel args, preferred_rx_crypto_frame_sizes are advertised to
@@ -590,6 +614,10 @@ struct grpc_chttp2_transport final : public grpc_core::FilterStackTransport,
   bool benign_reclaimer_registered = false;
   /// have we scheduled a destructive cleanup?
   bool destructive_reclaimer_registered = false;
+  /// have we scheduled an idle cleanup?
+  bool idle_reclaimer_registered = false;
+  /// has memory been trimmed since the last stream ended?
+  bool memory_trimmed = false;
 
   /// if keepalive pings are allowed when there's no outstanding streams
   bool keepalive_permit_without_calls = false;
@@ -626,6 +654,13 @@ struct grpc_chttp2_transport final : public grpc_core::FilterStackTransport,
   std::shared_ptr<grpc_core::Http2StatsCollector> http2_stats;
   grpc_core::Http2ZTraceCollector http2_ztrace_collector;
   grpc_core::Timestamp last_ztrace_time = grpc_core::Timestamp::InfPast();
+  // The last write that asked the endpoint for TCP_INFO samples for the BDP
+  // estimator.
+  grpc_core::Timestamp last_tcp_info_sample_time =
+      grpc_core::Timestamp::InfPast();
+  // Telemetry key of the endpoint's min_rtt metric, resolved once when the
+  // TCP_INFO BDP estimator is enabled.
+  size_t tcp_info_min_rtt_key = 0;
 
   GPR_NO_UNIQUE_ADDRESS grpc_core::latent_see::Flow write_flow;
 
@@ -727,6 +762,7 @@ struct grpc_chttp2_stream {
   int64_t received_bytes = 0;
 
   grpc_core::chttp2::StreamFlowControl flow_control;
+  grpc_core::Chttp2WriteScheduler::StreamState write_scheduler_state;
 
   grpc_slice_buffer flow_controlled_buffer;
 
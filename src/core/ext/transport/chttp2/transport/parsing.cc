@@ -579,7 +579,12 @@ static grpc_error_handle init_data_frame_parser(grpc_chttp2_transport* t) {
       t->bdp_ping_blocked = false;
       schedule_bdp_ping_locked(t->Ref());
     }
-    bdp_est->AddIncomingBytes(t->incoming_frame_size);
+    if (auto* tcp_info_est = t->flow_control.tcp_info_bdp_estimator();
+        tcp_info_est != nullptr) {
+      tcp_info_est->AddIncomingBytes(t->incoming_frame_size);
+    } else {
+      bdp_est->AddIncomingBytes(t->incoming_frame_size);
+    }
   }
   grpc_chttp2_stream* s =
       grpc_chttp2_parsing_lookup_stream(t, t->incoming_stream_id);
@@ -985,6 +990,12 @@ static grpc_error_handle init_settings_frame_parser(grpc_chttp2_transport* t) {
     // effictively removes the limit for the rest of the connection.
     t->num_incoming_streams_before_settings_ack =
         std::numeric_limits<uint32_t>::max();
+    // Settings changed while the last ones were in flight (e.g. a header
+    // table size restored before the trim to 0 was acked) could not be sent
+    // then; send them now rather than waiting for some other write.
+    if (t->settings.local() != t->settings.sent()) {
+      grpc_chttp2_initiate_write(t, GRPC_CHTTP2_INITIATE_WRITE_SEND_SETTINGS);
+    }
   }
   t->parser = grpc_chttp2_transport::Parser{
       "settings", grpc_chttp2_settings_parser_parse, &t->simple.settings};
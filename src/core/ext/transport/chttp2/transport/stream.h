@@ -38,6 +38,7 @@
 #include "src/core/ext/transport/chttp2/transport/message_assembler.h"
 #include "src/core/ext/transport/chttp2/transport/stream_data_queue.h"
 #include "src/core/ext/transport/chttp2/transport/write_cycle.h"
+#include "src/core/ext/transport/chttp2/transport/write_scheduler.h"
 #include "src/core/lib/resource_quota/arena.h"
 #include "src/core/util/grpc_check.h"
 #include "src/core/util/ref_counted.h"
@@ -488,6 +489,10 @@ class Stream : public RefCounted<Stream> {
     return flow_control_;
   }
 
+  Chttp2WriteScheduler::StreamState& write_scheduler_state() {
+    return write_scheduler_state_;
+  }
+
   bool is_client() const { return std::holds_alternative<CallHandler>(call_); }
   bool is_server() const {
     return std::holds_alternative<CallInitiator>(call_);
@@ -503,6 +508,7 @@ class Stream : public RefCounted<Stream> {
 
   GrpcMessageAssembler assembler_;
   chttp2::StreamFlowControl flow_control_;
+  Chttp2WriteScheduler::StreamState write_scheduler_state_;
   std::variant<CallInitiator, CallHandler> call_;
 
   // This function is idempotent.
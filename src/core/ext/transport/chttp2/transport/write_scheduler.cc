@@ -0,0 +1,74 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/transport/chttp2/transport/write_scheduler.h"
+
+#include <grpc/impl/channel_arg_names.h>
+#include <grpc/support/port_platform.h>
+
+#include <algorithm>
+#include <limits>
+
+#include "src/core/util/useful.h"
+#include "absl/strings/numbers.h"
+
+namespace grpc_core {
+
+namespace {
+// How many turns' worth of grant a stream may hold on to.
+constexpr uint64_t kMaxDeficitTurns = 2;
+}  // namespace
+
+Chttp2WriteScheduler::Chttp2WriteScheduler(const ChannelArgs& args) {
+  if (args.GetString(GRPC_ARG_HTTP2_WRITE_SCHEDULER) != "drr") return;
+  quantum_ = static_cast<uint32_t>(
+      Clamp(args.GetInt(GRPC_ARG_HTTP2_WRITE_SCHEDULER_QUANTUM)
+                .value_or(kDefaultQuantum),
+            1, std::numeric_limits<int>::max()));
+  weight_key_ = std::string(
+      args.GetString(GRPC_ARG_HTTP2_WRITE_WEIGHT_METADATA_KEY).value_or(""));
+}
+
+void Chttp2WriteScheduler::SetWeightFromMetadata(
+    const grpc_metadata_batch& metadata, StreamState& stream) const {
+  if (weight_key_.empty()) return;
+  std::string buffer;
+  auto value = metadata.GetStringValue(weight_key_, &buffer);
+  uint32_t weight;
+  if (!value.has_value() || !absl::SimpleAtoi(*value, &weight) ||
+      weight == 0) {
+    return;
+  }
+  stream.weight_ = std::min(weight, kMaxWeight);
+}
+
+uint32_t Chttp2WriteScheduler::BeginTurn(StreamState& stream) const {
+  if (!enabled()) return std::numeric_limits<uint32_t>::max();
+  const uint64_t grant = uint64_t{quantum_} * stream.weight_;
+  stream.deficit_ = std::min(stream.deficit_ + grant, grant * kMaxDeficitTurns);
+  return static_cast<uint32_t>(std::min<uint64_t>(
+      stream.deficit_, std::numeric_limits<uint32_t>::max()));
+}
+
+void Chttp2WriteScheduler::EndTurn(uint32_t bytes, bool has_more_data,
+                                   StreamState& stream) const {
+  if (!enabled()) return;
+  if (!has_more_data) {
+    stream.deficit_ = 0;
+    return;
+  }
+  stream.deficit_ -= std::min<uint64_t>(bytes, stream.deficit_);
+}
+
+}  // namespace grpc_core
@@ -0,0 +1,81 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_WRITE_SCHEDULER_H
+#define GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_WRITE_SCHEDULER_H
+
+#include <grpc/support/port_platform.h>
+#include <stdint.h>
+
+#include <string>
+
+#include "src/core/call/metadata_batch.h"
+#include "src/core/lib/channel/channel_args.h"
+
+namespace grpc_core {
+
+// Decides how much data each writable stream may send when its turn comes
+// in a write cycle.
+//
+// By default a stream sends everything that flow control and the write
+// size allow, so a large transfer at the front of the writable list can
+// fill whole writes while small RPCs behind it wait.  With
+// GRPC_ARG_HTTP2_WRITE_SCHEDULER set to "drr" streams are served by
+// deficit round robin instead: each turn a stream is granted a quantum of
+// bytes scaled by its weight, and a stream whose turn was cut short keeps
+// the unused part for its next turn.  The transports already put a stream
+// that still has data back at the end of the writable list, so no stream
+// sends more than its grant while others are waiting.
+class Chttp2WriteScheduler {
+ public:
+  static constexpr uint32_t kDefaultQuantum = 16 * 1024;
+  static constexpr uint32_t kMaxWeight = 64;
+
+  // Scheduling state kept with each stream.
+  class StreamState {
+   public:
+    uint32_t weight() const { return weight_; }
+
+   private:
+    friend class Chttp2WriteScheduler;
+
+    uint32_t weight_ = 1;
+    uint64_t deficit_ = 0;
+  };
+
+  Chttp2WriteScheduler() = default;
+  explicit Chttp2WriteScheduler(const ChannelArgs& args);
+
+  bool enabled() const { return quantum_ > 0; }
+  uint32_t quantum() const { return quantum_; }
+
+  // Sets a stream's weight from its initial metadata, if the channel names
+  // a weight metadata key and the metadata carries a valid weight.
+  void SetWeightFromMetadata(const grpc_metadata_batch& metadata,
+                             StreamState& stream) const;
+
+  // Starts a stream's turn.  Returns how many bytes of data it may send.
+  uint32_t BeginTurn(StreamState& stream) const;
+  // Ends a stream's turn after it sent `bytes` of data.  A stream that has
+  // no more data to send loses whatever it did not use.
+  void EndTurn(uint32_t bytes, bool has_more_data, StreamState& stream) const;
+
+ private:
+  uint32_t quantum_ = 0;
+  std::string weight_key_;
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_WRITE_SCHEDULER_H
@@ -57,4 +57,49 @@ void Chttp2WriteSizePolicy::EndWrite(bool success) {
   }
 }
 
+Chttp2WriteCoalescingPolicy::Chttp2WriteCoalescingPolicy(
+    std::chrono::microseconds max_delay, size_t flush_bytes)
+    : max_delay_(max_delay), flush_bytes_(flush_bytes) {}
+
+bool Chttp2WriteCoalescingPolicy::StartHold(size_t messages) {
+  if (!enabled() || Timestamp::Now() - last_write_ > IdleTimeout()) {
+    return false;
+  }
+  if (writes_to_skip_ > 0) {
+    --writes_to_skip_;
+    return false;
+  }
+  if (pending_bytes_ >= flush_bytes_) return false;
+  held_messages_ = messages;
+  hold_start_ = std::chrono::steady_clock::now();
+  return true;
+}
+
+bool Chttp2WriteCoalescingPolicy::ContinueHold(size_t messages) {
+  if (messages <= held_messages_ || pending_bytes_ >= flush_bytes_ ||
+      std::chrono::steady_clock::now() - hold_start_ >= max_delay_) {
+    return false;
+  }
+  held_messages_ = messages;
+  return true;
+}
+
+void Chttp2WriteCoalescingPolicy::AddPendingBytes(size_t bytes) {
+  if (!enabled()) return;
+  pending_bytes_ += bytes;
+}
+
+void Chttp2WriteCoalescingPolicy::BeginWrite(bool held, size_t messages) {
+  if (!enabled()) return;
+  last_write_ = Timestamp::Now();
+  pending_bytes_ = 0;
+  if (!held) return;
+  if (messages <= 1) {
+    backoff_ = std::min(std::max<uint32_t>(backoff_ * 2, 1), MaxBackoff());
+    writes_to_skip_ = backoff_;
+  } else {
+    backoff_ = 0;
+  }
+}
+
 }  // namespace grpc_core
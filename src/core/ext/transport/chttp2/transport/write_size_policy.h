@@ -19,6 +19,8 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include <chrono>
+
 #include "src/core/util/time.h"
 
 namespace grpc_core {
@@ -60,6 +62,54 @@ class Chttp2WriteSizePolicy {
   int8_t state_ = 0;
 };
 
+// Decides whether a write that has just become necessary should be held back
+// while the transport's combiner still has work queued, so that frames other
+// streams are about to queue go out in the same syscall.  Holding never waits
+// on a timer: a held back write starts as soon as a pass over the combiner
+// queue adds no messages to it.
+class Chttp2WriteCoalescingPolicy {
+ public:
+  // A connection that has not started a write for this long is idle, and
+  // its writes are never held back.
+  static constexpr Duration IdleTimeout() { return Duration::Milliseconds(1); }
+  // Most writes that go out without being held back after holding back a
+  // write gathered nothing.
+  static constexpr uint32_t MaxBackoff() { return 64; }
+
+  Chttp2WriteCoalescingPolicy() = default;
+  Chttp2WriteCoalescingPolicy(std::chrono::microseconds max_delay,
+                              size_t flush_bytes);
+
+  bool enabled() const { return max_delay_.count() > 0; }
+
+  // Whether to hold back a write that has just become necessary.  `messages`
+  // is how many messages the write would carry now.
+  bool StartHold(size_t messages);
+  // Whether a held back write, which would now carry `messages` messages,
+  // should wait for another pass over the combiner queue.
+  bool ContinueHold(size_t messages);
+  // Notify the policy that `bytes` of messages were queued.
+  void AddPendingBytes(size_t bytes);
+  // Notify the policy that a write is being put together from `messages`
+  // messages.  `held` says whether the write was held back.
+  void BeginWrite(bool held, size_t messages);
+
+ private:
+  std::chrono::microseconds max_delay_{0};
+  size_t flush_bytes_ = 0;
+  size_t pending_bytes_ = 0;
+  Timestamp last_write_ = Timestamp::InfPast();
+  // Messages the held back write carried after the last pass.
+  size_t held_messages_ = 0;
+  std::chrono::steady_clock::time_point hold_start_;
+  // Each time holding back a write gathers no more than one message, the
+  // next `backoff_` writes go out immediately; backoff_ doubles up to
+  // MaxBackoff() while that keeps happening, and resets once a held back
+  // write gathers several messages.
+  uint32_t backoff_ = 0;
+  uint32_t writes_to_skip_ = 0;
+};
+
 }  // namespace grpc_core
 
 #endif  // GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_WRITE_SIZE_POLICY_H
@@ -394,7 +394,9 @@ class DataSendContext {
       : write_context_(write_context),
         t_(t),
         s_(s),
-        sending_bytes_before_(s_->sending_bytes) {}
+        sending_bytes_before_(s_->sending_bytes),
+        turn_allowance_(
+            t_->write_scheduler.BeginTurn(s_->write_scheduler_state)) {}
 
   uint32_t stream_remote_window() const {
     return static_cast<uint32_t>(std::max(
@@ -407,7 +409,7 @@ class DataSendContext {
     return grpc_core::Clamp<int64_t>(
         std::min<int64_t>(
             {t_->settings.peer().max_frame_size(), stream_remote_window(),
-             t_->flow_control.remote_window(),
+             t_->flow_control.remote_window(), int64_t{turn_allowance_},
              static_cast<int64_t>(write_context_->target_write_size()) -
                  static_cast<int64_t>(t_->outbuf.Length())}),
         0, std::numeric_limits<uint32_t>::max());
@@ -428,10 +430,18 @@ class DataSendContext {
                             t_->outbuf.c_slice_buffer());
     sfc_upd_.SentData(send_bytes);
     s_->sending_bytes += send_bytes;
+    turn_allowance_ -= send_bytes;
   }
 
   bool is_last_frame() const { return is_last_frame_; }
 
+  // Tells the write scheduler how much of its turn the stream used.
+  void EndTurn() {
+    t_->write_scheduler.EndTurn(
+        static_cast<uint32_t>(s_->sending_bytes - sending_bytes_before_),
+        s_->flow_controlled_buffer.length > 0, s_->write_scheduler_state);
+  }
+
   void CallCallbacks() {
     if (update_list(
             t_, static_cast<int64_t>(s_->sending_bytes - sending_bytes_before_),
@@ -448,6 +458,7 @@ class DataSendContext {
   grpc_core::chttp2::StreamFlowControl::OutgoingUpdateContext sfc_upd_{
       &s_->flow_control};
   const size_t sending_bytes_before_;
+  uint32_t turn_allowance_;
   bool is_last_frame_ = false;
 };
 
@@ -466,6 +477,9 @@ class StreamWriteContext {
     if (s_->sent_initial_metadata) return;
     if (s_->send_initial_metadata == nullptr) return;
 
+    t_->write_scheduler.SetWeightFromMetadata(*s_->send_initial_metadata,
+                                              s_->write_scheduler_state);
+
     // We skip this on the server side if there is no custom initial
     // metadata, there are no messages to send, and we are also sending
     // trailing metadata.  This results in a Trailers-Only response,
@@ -562,6 +576,7 @@ class StreamWriteContext {
       data_send_context.FlushBytes();
     }
     grpc_chttp2_reset_ping_clock(t_);
+    data_send_context.EndTurn();
     if (data_send_context.is_last_frame()) {
       SentLastFrame();
     }
@@ -27,6 +27,7 @@
 
 #include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
@@ -564,7 +565,8 @@ class PipelinedSecureEndpoint final : public EventEngine::Endpoint {
                            leftover_nslices, channel_args),
           wrapped_ep_(std::move(wrapped_ep)),
           event_engine_(channel_args.GetObjectRef<
-                        grpc_event_engine::experimental::EventEngine>()) {
+                        grpc_event_engine::experimental::EventEngine>()),
+          heuristic_selector_(HeuristicTypeFromChannelArgs(channel_args)) {
       if (event_engine_ == nullptr) {
         event_engine_ = GetDefaultEventEngine();
       }
@@ -690,6 +692,21 @@ class PipelinedSecureEndpoint final : public EventEngine::Endpoint {
     }
 
    private:
+    static grpc_core::PipeliningHeuristicSelector::HeuristicType
+    HeuristicTypeFromChannelArgs(const grpc_core::ChannelArgs& channel_args) {
+      auto name =
+          channel_args.GetString(GRPC_ARG_SECURE_ENDPOINT_PIPELINING_HEURISTIC);
+      if (name.has_value()) {
+        auto type =
+            grpc_core::PipeliningHeuristicSelector::ParseHeuristicType(*name);
+        if (type.has_value()) return *type;
+        LOG(ERROR) << "Unknown secure endpoint pipelining heuristic \""
+                   << *name << "\"; using default";
+      }
+      return grpc_core::PipeliningHeuristicSelector::HeuristicType::
+          kMovingAverage;
+    }
+
     // Called from the constructor to kick off the first read on the wrapped
     // endpoint.
     void StartFirstRead() ABSL_LOCKS_EXCLUDED(read_queue_mu_) {
@@ -854,6 +871,9 @@ class PipelinedSecureEndpoint final : public EventEngine::Endpoint {
       absl::Status unprotect_status;
       absl::AnyInvocable<void(absl::Status)> on_read;
       bool enable_pipelining = false;
+      bool measure_timings = false;
+      size_t source_length = 0;
+      std::optional<std::chrono::steady_clock::time_point> unprotect_start;
       bool exit_loop = false;
 
       /*
@@ -908,17 +928,34 @@ class PipelinedSecureEndpoint final : public EventEngine::Endpoint {
             args.set_read_hint_bytes(1);
           }
 
-          impl->heuristic_selector_.RecordRead(source_buffer->Length());
+          source_length = source_buffer->Length();
+          if (impl->heuristic_selector_.RecordRead(source_length)) {
+            GRPC_TRACE_LOG(secure_endpoint, INFO)
+                << "PipelinedSecureEndpoint " << impl.get() << " pipelining "
+                << (impl->heuristic_selector_.IsPipeliningEnabled()
+                        ? "enabled"
+                        : "disabled")
+                << ": " << impl->heuristic_selector_.GetTelemetry().ToString();
+          }
           enable_pipelining = impl->heuristic_selector_.IsPipeliningEnabled();
+          measure_timings = impl->heuristic_selector_.WantsTimings();
         }
 
         // If pipelining is enabled, kick off the next read in another thread
         // while we unprotect in this thread.
         if (enable_pipelining) {
-          impl->event_engine_->Run([impl = impl->Ref(), args = args]() mutable {
-            grpc_core::ExecCtx exec_ctx;
-            StartPipelinedRead(std::move(impl), args);
-          });
+          std::optional<std::chrono::steady_clock::time_point> scheduled;
+          if (measure_timings) scheduled = std::chrono::steady_clock::now();
+          impl->event_engine_->Run(
+              [impl = impl->Ref(), args = args, scheduled]() mutable {
+                grpc_core::ExecCtx exec_ctx;
+                if (scheduled.has_value()) {
+                  grpc_core::MutexLock lock(&impl->read_queue_mu_);
+                  impl->heuristic_selector_.RecordOffloadDelay(
+                      std::chrono::steady_clock::now() - *scheduled);
+                }
+                StartPipelinedRead(std::move(impl), args);
+              });
         }
 
         {
@@ -928,6 +965,9 @@ class PipelinedSecureEndpoint final : public EventEngine::Endpoint {
           impl->frame_protector_.SetSourceBuffer(std::move(source_buffer));
           read_buffer = std::make_unique<SliceBuffer>();
           impl->frame_protector_.BeginRead(read_buffer->c_slice_buffer());
+          if (measure_timings) {
+            unprotect_start = std::chrono::steady_clock::now();
+          }
           unprotect_status = impl->frame_protector_.Unprotect(absl::OkStatus());
           impl->frame_protector_.FinishRead(unprotect_status.ok());
           if (!unprotect_status.ok()) {
@@ -938,6 +978,12 @@ class PipelinedSecureEndpoint final : public EventEngine::Endpoint {
         }
 
         impl->read_queue_mu_.Lock();
+        if (unprotect_start.has_value()) {
+          impl->heuristic_selector_.RecordUnprotect(
+              source_length,
+              std::chrono::steady_clock::now() - *unprotect_start);
+          unprotect_start.reset();
+        }
         impl->unprotected_data_buffer_ = std::move(read_buffer);
         if (impl->on_read_ != nullptr) {
           // We have a transport read waiting on this unprotected data - either
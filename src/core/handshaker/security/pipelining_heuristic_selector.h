@@ -19,17 +19,64 @@
 #ifndef GRPC_SRC_CORE_HANDSHAKER_SECURITY_PIPELINING_HEURISTIC_SELECTOR_H
 #define GRPC_SRC_CORE_HANDSHAKER_SECURITY_PIPELINING_HEURISTIC_SELECTOR_H
 
+#include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <optional>
+#include <string>
+
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
 
 namespace grpc_core {
 
+// Per-connection view of the inputs and decisions of a pipelining heuristic.
+struct PipeliningTelemetry {
+  // Number of reads and bytes handed to the heuristic.
+  uint64_t reads = 0;
+  uint64_t bytes_read = 0;
+  // Number of reads for which pipelining was enabled.
+  uint64_t pipelined_reads = 0;
+  // Number of times pipelining was switched on or off.
+  uint64_t transitions = 0;
+  // Smoothed unprotect cost and offload queue delay, if the heuristic
+  // measures them.
+  std::optional<double> unprotect_nanos_per_byte;
+  std::optional<double> offload_delay_nanos;
+
+  std::string ToString() const {
+    return absl::StrCat(
+        "reads=", reads, " bytes_read=", bytes_read,
+        " pipelined_reads=", pipelined_reads, " transitions=", transitions,
+        unprotect_nanos_per_byte.has_value()
+            ? absl::StrCat(" unprotect_ns_per_byte=", *unprotect_nanos_per_byte)
+            : "",
+        offload_delay_nanos.has_value()
+            ? absl::StrCat(" offload_delay_ns=", *offload_delay_nanos)
+            : "");
+  }
+};
+
 class PipeliningHeuristic {
  public:
   virtual ~PipeliningHeuristic() = default;
   virtual void RecordRead(size_t read_size) = 0;
   virtual bool IsPipeliningEnabled() const = 0;
+  // Returns true if the heuristic wants RecordUnprotect() and
+  // RecordOffloadDelay() to be called. Timings are only collected when this
+  // returns true, so that heuristics that do not use them pay nothing.
+  virtual bool WantsTimings() const { return false; }
+  // Records the time it took to unprotect `bytes` bytes.
+  virtual void RecordUnprotect(size_t /*bytes*/,
+                               std::chrono::nanoseconds /*duration*/) {}
+  // Records the time between scheduling an offloaded read on the event engine
+  // and that read starting to run.
+  virtual void RecordOffloadDelay(std::chrono::nanoseconds /*delay*/) {}
+  // Fills in the heuristic-specific fields of the telemetry.
+  virtual void FillTelemetry(PipeliningTelemetry& /*telemetry*/) const {}
 };
 
 // Always-off heuristic.
@@ -104,6 +151,91 @@ class MovingAverageHeuristic : public PipeliningHeuristic {
   double moving_average_ = 0.0;
 };
 
+// Cost-based heuristic. Rather than relying on fixed read size thresholds, it
+// measures how long it takes to unprotect each byte and how long an offloaded
+// read waits in the event engine queue before it runs. Pipelining lets the
+// next endpoint read overlap with unprotecting the current one, so it is
+// enabled only when the expected unprotect time of a read is large enough to
+// pay for handing the read off to another thread.
+class AdaptiveCostHeuristic : public PipeliningHeuristic {
+ public:
+  void RecordRead(size_t source_buffer_length) override {
+    avg_read_size_ = Smooth(avg_read_size_, source_buffer_length);
+    // Offload delays are only measured while pipelining is on. While it is
+    // off, let the estimate drift back to the default, so that one congested
+    // period does not keep pipelining off for good: once it is back on, fresh
+    // samples confirm or undo the decision.
+    if (!enable_pipelining_) {
+      offload_delay_nanos_ +=
+          (kDefaultOffloadDelayNanos - offload_delay_nanos_) *
+          kOffloadDelayDecay;
+    }
+    if (samples_ < kMinSamples) return;
+    // Expected time saved per read by unprotecting in parallel with the next
+    // read, versus the expected cost of the thread handoff. Hysteresis keeps
+    // the decision from flapping around the break-even point.
+    const double expected_savings = avg_read_size_ * nanos_per_byte_;
+    const double handoff_cost = offload_delay_nanos_ + kFixedHandoffCostNanos;
+    if (!enable_pipelining_ && expected_savings > kEnableRatio * handoff_cost) {
+      enable_pipelining_ = true;
+    } else if (enable_pipelining_ && expected_savings < handoff_cost) {
+      enable_pipelining_ = false;
+    }
+  }
+
+  bool IsPipeliningEnabled() const override { return enable_pipelining_; }
+
+  bool WantsTimings() const override { return true; }
+
+  void RecordUnprotect(size_t bytes,
+                       std::chrono::nanoseconds duration) override {
+    if (bytes == 0) return;
+    nanos_per_byte_ = Smooth(nanos_per_byte_,
+                             static_cast<double>(duration.count()) / bytes);
+    ++samples_;
+  }
+
+  void RecordOffloadDelay(std::chrono::nanoseconds delay) override {
+    offload_delay_nanos_ =
+        Smooth(offload_delay_nanos_, static_cast<double>(delay.count()));
+  }
+
+  void FillTelemetry(PipeliningTelemetry& telemetry) const override {
+    telemetry.unprotect_nanos_per_byte = nanos_per_byte_;
+    telemetry.offload_delay_nanos = offload_delay_nanos_;
+  }
+
+ private:
+  static double Smooth(double average, double sample) {
+    return average == 0.0 ? sample
+                          : average * (1 - kSmoothingFactor) +
+                                sample * kSmoothingFactor;
+  }
+
+  // Weight given to each new sample in the moving averages.
+  static constexpr double kSmoothingFactor = 0.1;
+  // Number of unprotect samples needed before the heuristic makes decisions.
+  static constexpr uint64_t kMinSamples = 8;
+  // Cost of a thread handoff beyond the measured queue delay, covering
+  // closure allocation and cache misses on the other thread.
+  static constexpr double kFixedHandoffCostNanos = 5000;
+  // Expected savings must exceed the handoff cost by this factor before
+  // pipelining is enabled.
+  static constexpr double kEnableRatio = 2.0;
+  // Until an offloaded read has been observed, assume a queue delay typical
+  // of a lightly loaded event engine.
+  static constexpr double kDefaultOffloadDelayNanos = 20000;
+  // Fraction of the distance to kDefaultOffloadDelayNanos that the offload
+  // delay estimate covers on each read while pipelining is off.
+  static constexpr double kOffloadDelayDecay = 0.02;
+  double offload_delay_nanos_ = kDefaultOffloadDelayNanos;
+  double nanos_per_byte_ = 0.0;
+  double avg_read_size_ = 0.0;
+  uint64_t samples_ = 0;
+  // We disable pipelining initially.
+  bool enable_pipelining_ = false;
+};
+
 class PipeliningHeuristicSelector {
  public:
   enum class HeuristicType {
@@ -111,8 +243,22 @@ class PipeliningHeuristicSelector {
     kMovingAverage,
     kAlwaysOff,
     kAlwaysOn,
+    kAdaptiveCost,
   };
 
+  // Parses the value of GRPC_ARG_SECURE_ENDPOINT_PIPELINING_HEURISTIC.
+  static std::optional<HeuristicType> ParseHeuristicType(
+      absl::string_view name) {
+    if (name == "consecutive_small_reads") {
+      return HeuristicType::kConsecutiveSmallReads;
+    }
+    if (name == "moving_average") return HeuristicType::kMovingAverage;
+    if (name == "always_off") return HeuristicType::kAlwaysOff;
+    if (name == "always_on") return HeuristicType::kAlwaysOn;
+    if (name == "adaptive_cost") return HeuristicType::kAdaptiveCost;
+    return std::nullopt;
+  }
+
   // Default to kMovingAverage.
   explicit PipeliningHeuristicSelector(
       HeuristicType type = HeuristicType::kMovingAverage) {
@@ -133,17 +279,45 @@ class PipeliningHeuristicSelector {
       case HeuristicType::kAlwaysOn:
         heuristic_ = std::make_unique<AlwaysOnHeuristic>();
         break;
+      case HeuristicType::kAdaptiveCost:
+        heuristic_ = std::make_unique<AdaptiveCostHeuristic>();
+        break;
     }
   }
 
-  void RecordRead(size_t source_buffer_length) {
+  // Returns true if the read flipped the pipelining decision.
+  bool RecordRead(size_t source_buffer_length) {
+    const bool was_enabled = heuristic_->IsPipeliningEnabled();
     heuristic_->RecordRead(source_buffer_length);
+    const bool enabled = heuristic_->IsPipeliningEnabled();
+    ++telemetry_.reads;
+    telemetry_.bytes_read += source_buffer_length;
+    if (enabled) ++telemetry_.pipelined_reads;
+    if (enabled != was_enabled) ++telemetry_.transitions;
+    return enabled != was_enabled;
   }
 
   bool IsPipeliningEnabled() const { return heuristic_->IsPipeliningEnabled(); }
 
+  bool WantsTimings() const { return heuristic_->WantsTimings(); }
+
+  void RecordUnprotect(size_t bytes, std::chrono::nanoseconds duration) {
+    heuristic_->RecordUnprotect(bytes, duration);
+  }
+
+  void RecordOffloadDelay(std::chrono::nanoseconds delay) {
+    heuristic_->RecordOffloadDelay(delay);
+  }
+
+  PipeliningTelemetry GetTelemetry() const {
+    PipeliningTelemetry telemetry = telemetry_;
+    heuristic_->FillTelemetry(telemetry);
+    return telemetry;
+  }
+
  private:
   std::unique_ptr<PipeliningHeuristic> heuristic_;
+  PipeliningTelemetry telemetry_;
 };
 
 }  // namespace grpc_core
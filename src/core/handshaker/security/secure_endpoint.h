@@ -37,6 +37,23 @@
   "grpc.secure_endpoint.encryption_offload_threshold"
 #define GRPC_ARG_ENCRYPTION_OFFLOAD_MAX_BUFFERED_WRITES \
   "grpc.secure_endpoint.encryption_offload_max_buffered_writes"
+// String. Selects the heuristic the pipelined secure endpoint uses to decide
+// whether to overlap endpoint reads with unprotecting: one of
+// "moving_average" (default), "consecutive_small_reads", "adaptive_cost",
+// "always_on" or "always_off".
+#define GRPC_ARG_SECURE_ENDPOINT_PIPELINING_HEURISTIC \
+  "grpc.secure_endpoint.pipelining_heuristic"
+// Boolean. If true, the security handshaker moves record protection into the
+// kernel (kTLS) when the negotiated connection and the platform allow it, and
+// hands out the plain endpoint instead of a secure endpoint. Currently only
+// TLS 1.3 servers built with BoringSSL on Linux can offload, and offloaded
+// connections do not send session tickets. SSL and TLS server credentials
+// read it when they create their security connector: only then do handshakes
+// keep the traffic secrets that offloading needs. The kernel's TLS send path
+// rejects MSG_ZEROCOPY, so offloaded connections send without it even when
+// GRPC_ARG_TCP_TX_ZEROCOPY_ENABLED is set. Defaults to false.
+#define GRPC_ARG_SECURE_ENDPOINT_KERNEL_TLS \
+  "grpc.secure_endpoint.kernel_tls"
 
 // Takes ownership of protector, zero_copy_protector, and to_wrap, and refs
 // leftover_slices. If zero_copy_protector is not NULL, protector will never be
@@ -42,9 +42,12 @@
 #include "src/core/handshaker/handshaker_registry.h"
 #include "src/core/handshaker/security/secure_endpoint.h"
 #include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/event_engine/extensions/supports_fd.h"
+#include "src/core/lib/event_engine/query_extensions.h"
 #include "src/core/lib/iomgr/closure.h"
 #include "src/core/lib/iomgr/endpoint.h"
 #include "src/core/lib/iomgr/error.h"
+#include "src/core/lib/iomgr/event_engine_shims/endpoint.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/iomgr/iomgr_fwd.h"
 #include "src/core/lib/iomgr/tcp_server.h"
@@ -220,6 +223,41 @@ void SecurityHandshaker::OnPeerCheckedFn(grpc_error_handle error) {
     HandshakeFailedLocked(error);
     return;
   }
+  // Move record protection into the kernel if requested. This must happen
+  // before the unused bytes are fetched, as they are decrypted on success.
+  bool kernel_tls = false;
+  if (args_->args.GetBool(GRPC_ARG_SECURE_ENDPOINT_KERNEL_TLS)
+          .value_or(false)) {
+    const int fd = grpc_endpoint_get_fd(args_->endpoint.get());
+    // The kernel's TLS software send path rejects MSG_ZEROCOPY, so the
+    // endpoint must stop using it once the socket is offloaded. Only event
+    // engine endpoints can be told to; others are not offloaded if they may
+    // use zerocopy.
+    grpc_event_engine::experimental::EventEngine::Endpoint* ee_endpoint =
+        grpc_event_engine::experimental::grpc_get_wrapped_event_engine_endpoint(
+            args_->endpoint.get());
+    auto* supports_fd =
+        ee_endpoint == nullptr
+            ? nullptr
+            : grpc_event_engine::experimental::QueryExtension<
+                  grpc_event_engine::experimental::EndpointSupportsFdExtension>(
+                  ee_endpoint);
+    const bool may_use_tx_zerocopy =
+        args_->args.GetBool(GRPC_ARG_TCP_TX_ZEROCOPY_ENABLED).value_or(false);
+    if (fd >= 0 && (supports_fd != nullptr || !may_use_tx_zerocopy)) {
+      tsi_result result =
+          tsi_handshaker_result_install_kernel_tls(handshaker_result_, fd);
+      if (result == TSI_OK) {
+        kernel_tls = true;
+        if (supports_fd != nullptr) supports_fd->DisableTxZerocopy();
+      } else if (result != TSI_UNIMPLEMENTED) {
+        HandshakeFailedLocked(GRPC_ERROR_CREATE(
+            absl::StrCat("Kernel TLS offload failed (",
+                         tsi_result_to_string(result), ")")));
+        return;
+      }
+    }
+  }
   // Get unused bytes.
   const unsigned char* unused_bytes = nullptr;
   size_t unused_bytes_size = 0;
@@ -299,8 +337,8 @@ void SecurityHandshaker::OnPeerCheckedFn(grpc_error_handle error) {
   tsi_handshaker_result_destroy(handshaker_result_);
   handshaker_result_ = nullptr;
   args_->args = args_->args.SetObject(auth_context_);
-  // Add channelz channel args only if frame protector is created.
-  if (has_frame_protector) {
+  // Add channelz channel args only if the connection is protected.
+  if (has_frame_protector || kernel_tls) {
     args_->args = args_->args.SetObject(
         MakeChannelzSecurityFromAuthContext(auth_context_.get()));
   }
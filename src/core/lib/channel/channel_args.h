@@ -406,6 +406,22 @@ class ChannelArgs {
       return str->as_string_view() == rhs;
     }
 
+    // Consistent with operator==.  Pointer values do not contribute to the
+    // hash, since pointers that compare equal need not be identical.
+    template <typename H>
+    friend H AbslHashValue(H h, const Value& value) {
+      if (value.rep_.c_vtable() == &int_vtable_) {
+        return H::combine(std::move(h), *value.GetIfInt());
+      }
+      if (value.rep_.c_vtable() == &string_vtable_) {
+        return H::combine(
+            std::move(h),
+            static_cast<RefCountedString*>(value.rep_.c_pointer())
+                ->as_string_view());
+      }
+      return h;
+    }
+
    private:
     static const grpc_arg_pointer_vtable int_vtable_;
     static const grpc_arg_pointer_vtable string_vtable_;
@@ -583,6 +599,17 @@ class ChannelArgs {
     return QsortCompare(lhs.args_, rhs.args_);
   }
 
+  // Walks all args, so callers that hash the same args repeatedly should
+  // keep the result.
+  template <typename H>
+  friend H AbslHashValue(H h, const ChannelArgs& args) {
+    args.args_.ForEach(
+        [&h](const RefCountedStringValue& key, const Value& value) {
+          h = H::combine(std::move(h), key.as_string_view(), value);
+        });
+    return h;
+  }
+
   // Helpers for commonly accessed things
 
   bool WantMinimalStack() const;
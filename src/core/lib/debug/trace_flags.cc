@@ -96,10 +96,12 @@ TraceFlag http2_ping_trace(false, "http2_ping");
 TraceFlag http2_stream_state_trace(false, "http2_stream_state");
 TraceFlag http_keepalive_trace(false, "http_keepalive");
 TraceFlag inproc_trace(false, "inproc");
+TraceFlag least_request_lb_trace(false, "least_request_lb");
 TraceFlag metadata_query_trace(false, "metadata_query");
 TraceFlag op_failure_trace(false, "op_failure");
 TraceFlag orca_client_trace(false, "orca_client");
 TraceFlag outlier_detection_lb_trace(false, "outlier_detection_lb");
+TraceFlag peak_ewma_lb_trace(false, "peak_ewma_lb");
 TraceFlag pick_first_trace(false, "pick_first");
 TraceFlag plugin_credentials_trace(false, "plugin_credentials");
 TraceFlag priority_lb_trace(false, "priority_lb");
@@ -183,10 +185,12 @@ const absl::flat_hash_map<std::string, TraceFlag*>& GetAllTraceFlags() {
           {"http2_stream_state", &http2_stream_state_trace},
           {"http_keepalive", &http_keepalive_trace},
           {"inproc", &inproc_trace},
+          {"least_request_lb", &least_request_lb_trace},
           {"metadata_query", &metadata_query_trace},
           {"op_failure", &op_failure_trace},
           {"orca_client", &orca_client_trace},
           {"outlier_detection_lb", &outlier_detection_lb_trace},
+          {"peak_ewma_lb", &peak_ewma_lb_trace},
           {"pick_first", &pick_first_trace},
           {"plugin_credentials", &plugin_credentials_trace},
           {"priority_lb", &priority_lb_trace},
@@ -46,6 +46,11 @@ class EndpointSupportsFdExtension {
   /// Otherwise it would get an appropriate error status as its argument.
   virtual void Shutdown(absl::AnyInvocable<void(absl::StatusOr<int> release_fd)>
                             on_release_fd) = 0;
+  /// Stops sending with MSG_ZEROCOPY, e.g. because the kernel now protects
+  /// the socket with TLS, whose software send path rejects the flag. Must
+  /// not be called while a write is in progress. Endpoints that never send
+  /// with MSG_ZEROCOPY need not override it.
+  virtual void DisableTxZerocopy() {}
 };
 
 class ListenerSupportsFdExtension {
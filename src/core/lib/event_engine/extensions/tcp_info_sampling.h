@@ -0,0 +1,43 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_EVENT_ENGINE_EXTENSIONS_TCP_INFO_SAMPLING_H
+#define GRPC_SRC_CORE_LIB_EVENT_ENGINE_EXTENSIONS_TCP_INFO_SAMPLING_H
+
+#include "src/core/telemetry/instrument.h"
+#include "src/core/util/ref_counted_ptr.h"
+#include "src/core/util/time.h"
+#include "absl/strings/string_view.h"
+
+namespace grpc_event_engine::experimental {
+
+class TcpInfoSamplingExtension {
+ public:
+  virtual ~TcpInfoSamplingExtension() = default;
+  static absl::string_view EndpointExtensionName() {
+    return "io.grpc.event_engine.extension.tcp_info_sampling";
+  }
+
+  // Start reading the kernel's TCP_INFO for this connection every `interval`,
+  // recording it against `target` in `collection_scope`.  The latest sample
+  // is also reported through channelz if the endpoint supports
+  // ChannelzExtension.
+  virtual void EnableTcpInfoSampling(
+      grpc_core::RefCountedPtr<grpc_core::CollectionScope> collection_scope,
+      absl::string_view target, grpc_core::Duration interval) = 0;
+};
+
+}  // namespace grpc_event_engine::experimental
+
+#endif  // GRPC_SRC_CORE_LIB_EVENT_ENGINE_EXTENSIONS_TCP_INFO_SAMPLING_H
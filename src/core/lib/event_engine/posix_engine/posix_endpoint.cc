@@ -35,6 +35,7 @@
 #include "src/core/lib/event_engine/posix_engine/event_poller.h"
 #include "src/core/lib/event_engine/posix_engine/internal_errqueue.h"
 #include "src/core/lib/event_engine/posix_engine/posix_interface.h"
+#include "src/core/lib/event_engine/posix_engine/tcp_info_sampler.h"
 #include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/resource_quota/resource_quota.h"
@@ -1284,6 +1285,10 @@ void PosixEndpointImpl::MaybeShutdown(
     handle_->SetHasError();
   }
   on_release_fd_ = std::move(on_release_fd);
+  {
+    grpc_core::MutexLock lock(&tcp_info_mu_);
+    tcp_info_registration_.reset();
+  }
   handle_->ShutdownHandle(why);
   read_mu_.Lock();
   memory_owner_.Reset();
@@ -1412,6 +1417,24 @@ PosixEndpointImpl::PosixEndpointImpl(EventHandle* handle,
   }
 }
 
+void PosixEndpointImpl::EnableTcpInfoSampling(
+    grpc_core::RefCountedPtr<grpc_core::CollectionScope> collection_scope,
+    absl::string_view target, grpc_core::Duration interval) {
+  auto storage = grpc_core::TcpInfoMetricsDomain::GetStorage(
+      std::move(collection_scope), target);
+  grpc_core::MutexLock lock(&tcp_info_mu_);
+  if (tcp_info_registration_ != nullptr) return;
+  tcp_info_registration_ = TcpInfoSampler::Get(interval)->Register(
+      engine_, handle_->WrappedFd(), &poller_->posix_interface(),
+      std::move(storage));
+}
+
+std::optional<TcpInfoSample> PosixEndpointImpl::LastTcpInfoSample() {
+  grpc_core::MutexLock lock(&tcp_info_mu_);
+  if (tcp_info_registration_ == nullptr) return std::nullopt;
+  return tcp_info_registration_->last_sample();
+}
+
 namespace {
 class PosixEndpointTelemetryInfo : public EventEngine::Endpoint::TelemetryInfo {
  public:
@@ -1446,6 +1469,11 @@ PosixEndpoint::GetTelemetryInfo() const {
   return *telemetry_info;
 }
 
+void PosixEndpoint::AddData(grpc_core::channelz::DataSink& sink) {
+  auto sample = impl_->LastTcpInfoSample();
+  if (sample.has_value()) sink.AddData("tcp_info", sample->ToPropertyList());
+}
+
 std::unique_ptr<PosixEndpoint> CreatePosixEndpoint(
     EventHandle* handle, PosixEngineClosure* on_shutdown,
     std::shared_ptr<EventEngine> engine, MemoryAllocator&& allocator,
@@ -27,25 +27,34 @@
 #include <atomic>
 #include <cstdint>
 #include <memory>
+#include <optional>
 #include <utility>
 
+#include "src/core/channelz/channelz.h"
+#include "src/core/lib/event_engine/extensions/channelz.h"
+#include "src/core/lib/event_engine/extensions/tcp_info_sampling.h"
 #include "src/core/lib/event_engine/posix.h"
 #include "src/core/lib/event_engine/posix_engine/event_poller.h"
 #include "src/core/lib/event_engine/posix_engine/posix_engine_closure.h"
+#include "src/core/lib/event_engine/posix_engine/tcp_info_sampler.h"
 #include "src/core/lib/event_engine/posix_engine/tcp_socket_utils.h"
 #include "src/core/lib/event_engine/posix_engine/traced_buffer_list.h"
 #include "src/core/lib/iomgr/port.h"
 #include "src/core/lib/resource_quota/memory_quota.h"
+#include "src/core/telemetry/instrument.h"
 #include "src/core/util/crash.h"
 #include "src/core/util/grpc_check.h"
 #include "src/core/util/ref_counted.h"
+#include "src/core/util/ref_counted_ptr.h"
 #include "src/core/util/sync.h"
+#include "src/core/util/time.h"
 #include "absl/base/thread_annotations.h"
 #include "absl/container/flat_hash_map.h"
 #include "absl/functional/any_invocable.h"
 #include "absl/log/log.h"
 #include "absl/status/status.h"
 #include "absl/status/statusor.h"
+#include "absl/strings/string_view.h"
 
 #ifdef GRPC_POSIX_SOCKET_TCP
 
@@ -287,6 +296,10 @@ class TcpZerocopySendCtx {
 
   bool Enabled() const { return enabled_; }
 
+  // Stops new writes from using zerocopy.  Sends already in flight still
+  // complete through the error queue.
+  void Disable() { enabled_ = false; }
+
   // Only use zerocopy if we are sending at least this many bytes. The
   // additional overhead of reading the error queue for notifications means that
   // zerocopy is not useful for small transfers.
@@ -492,6 +505,13 @@ class PosixEndpointImpl : public grpc_core::RefCounted<PosixEndpointImpl> {
       absl::Status why,
       absl::AnyInvocable<void(absl::StatusOr<int> release_fd)> on_release_fd);
 
+  void EnableTcpInfoSampling(
+      grpc_core::RefCountedPtr<grpc_core::CollectionScope> collection_scope,
+      absl::string_view target, grpc_core::Duration interval);
+  void DisableTxZerocopy() { tcp_zerocopy_send_ctx_->Disable(); }
+  // The latest TCP_INFO sample, if sampling is enabled and has run.
+  std::optional<TcpInfoSample> LastTcpInfoSample();
+
  private:
   void UpdateRcvLowat() ABSL_EXCLUSIVE_LOCKS_REQUIRED(read_mu_);
   void HandleWrite(absl::Status status);
@@ -593,9 +613,15 @@ class PosixEndpointImpl : public grpc_core::RefCounted<PosixEndpointImpl> {
   EventHandle* handle_;
   PosixEventPoller* poller_;
   std::shared_ptr<grpc_event_engine::experimental::EventEngine> engine_;
+  grpc_core::Mutex tcp_info_mu_;
+  // Dropped on shutdown, before the fd is released or closed.
+  std::unique_ptr<TcpInfoSampler::Registration> tcp_info_registration_
+      ABSL_GUARDED_BY(tcp_info_mu_);
 };
 
-class PosixEndpoint : public PosixEndpointWithFdSupport {
+class PosixEndpoint : public PosixEndpointWithFdSupport,
+                      public ChannelzExtension,
+                      public TcpInfoSamplingExtension {
  public:
   PosixEndpoint(
       EventHandle* handle, PosixEngineClosure* on_shutdown,
@@ -635,9 +661,31 @@ class PosixEndpoint : public PosixEndpointWithFdSupport {
 
   bool CanTrackErrors() override { return impl_->CanTrackErrors(); }
 
+  void DisableTxZerocopy() override { impl_->DisableTxZerocopy(); }
+
+  void* QueryExtension(absl::string_view id) override {
+    if (id == ChannelzExtension::EndpointExtensionName()) {
+      return static_cast<ChannelzExtension*>(this);
+    }
+    if (id == TcpInfoSamplingExtension::EndpointExtensionName()) {
+      return static_cast<TcpInfoSamplingExtension*>(this);
+    }
+    return PosixEndpointWithFdSupport::QueryExtension(id);
+  }
+
+  void AddData(grpc_core::channelz::DataSink& sink) override;
+
+  void EnableTcpInfoSampling(
+      grpc_core::RefCountedPtr<grpc_core::CollectionScope> collection_scope,
+      absl::string_view target, grpc_core::Duration interval) override {
+    impl_->EnableTcpInfoSampling(std::move(collection_scope), target,
+                                 interval);
+  }
+
   void Shutdown(absl::AnyInvocable<void(absl::StatusOr<int> release_fd)>
                     on_release_fd) override {
     if (!shutdown_.exchange(true, std::memory_order_acq_rel)) {
+      ShutdownChannelzExtension();
       impl_->MaybeShutdown(absl::UnavailableError("Endpoint closing"),
                            std::move(on_release_fd));
     }
@@ -645,6 +693,7 @@ class PosixEndpoint : public PosixEndpointWithFdSupport {
 
   ~PosixEndpoint() override {
     if (!shutdown_.exchange(true, std::memory_order_acq_rel)) {
+      ShutdownChannelzExtension();
       impl_->MaybeShutdown(absl::UnavailableError("Endpoint closing"), nullptr);
     }
   }
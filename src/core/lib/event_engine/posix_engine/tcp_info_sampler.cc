@@ -0,0 +1,249 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/event_engine/posix_engine/tcp_info_sampler.h"
+
+#include <grpc/support/port_platform.h>
+
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+#include "src/core/lib/event_engine/posix_engine/internal_errqueue.h"
+#include "src/core/lib/iomgr/port.h"
+#include "src/core/telemetry/histogram.h"
+#include "src/core/telemetry/instrument.h"
+#include "absl/base/no_destructor.h"
+#include "absl/container/flat_hash_map.h"
+
+namespace grpc_core {
+
+TcpInfoMetricsDomain::HistogramHandle<ExponentialHistogramShape>
+    TcpInfoMetricsDomain::kSmoothedRtt =
+        TcpInfoMetricsDomain::RegisterHistogram<ExponentialHistogramShape>(
+            "grpc.tcp.info.smoothed_rtt",
+            "Smoothed round trip time of connections, sampled periodically.",
+            "us", 1 << 24, 100);  // Max bucket is 16 seconds.
+TcpInfoMetricsDomain::HistogramHandle<ExponentialHistogramShape>
+    TcpInfoMetricsDomain::kCongestionWindow =
+        TcpInfoMetricsDomain::RegisterHistogram<ExponentialHistogramShape>(
+            "grpc.tcp.info.congestion_window",
+            "Congestion window of connections, sampled periodically.", "By",
+            1 << 30, 100);  // Max bucket is 1 GiB.
+TcpInfoMetricsDomain::HistogramHandle<ExponentialHistogramShape>
+    TcpInfoMetricsDomain::kDeliveryRate =
+        TcpInfoMetricsDomain::RegisterHistogram<ExponentialHistogramShape>(
+            "grpc.tcp.info.delivery_rate",
+            "TCP's most recent measure of connections' throughput, sampled "
+            "periodically.",
+            "By/s", int64_t{1} << 34, 100);  // Max bucket is 16 GiB/s.
+TcpInfoMetricsDomain::CounterHandle TcpInfoMetricsDomain::kRetransmits =
+    TcpInfoMetricsDomain::RegisterCounter(
+        "grpc.tcp.info.retransmits",
+        "Packets retransmitted by TCP, as of the latest sample.", "{packet}");
+TcpInfoMetricsDomain::CounterHandle TcpInfoMetricsDomain::kBusyTime =
+    TcpInfoMetricsDomain::RegisterCounter(
+        "grpc.tcp.info.busy_time",
+        "Time TCP spent with data to send, as of the latest sample.", "us");
+TcpInfoMetricsDomain::CounterHandle
+    TcpInfoMetricsDomain::kReceiveWindowLimitedTime =
+        TcpInfoMetricsDomain::RegisterCounter(
+            "grpc.tcp.info.rwnd_limited_time",
+            "Time TCP spent unable to send because of the peer's receive "
+            "window, as of the latest sample.",
+            "us");
+TcpInfoMetricsDomain::CounterHandle
+    TcpInfoMetricsDomain::kSendBufferLimitedTime =
+        TcpInfoMetricsDomain::RegisterCounter(
+            "grpc.tcp.info.sndbuf_limited_time",
+            "Time TCP spent limited by an insufficient (full) send "
+            "buffer, as of the latest sample.",
+            "us");
+
+}  // namespace grpc_core
+
+namespace grpc_event_engine::experimental {
+
+namespace {
+
+#ifdef GRPC_LINUX_ERRQUEUE
+// From the kernel's TCP states; the other states have nothing worth
+// sampling.
+constexpr uint8_t kTcpEstablished = 1;
+#endif  // GRPC_LINUX_ERRQUEUE
+
+// The totals in TCP_INFO only go up, but be robust to a socket being
+// reused for a new connection between samples.
+uint64_t Delta(uint64_t now, uint64_t before) {
+  return now > before ? now - before : 0;
+}
+
+}  // namespace
+
+grpc_core::channelz::PropertyList TcpInfoSample::ToPropertyList() const {
+  return grpc_core::channelz::PropertyList()
+      .Set("smoothed_rtt_us", smoothed_rtt_us)
+      .Set("rtt_variance_us", rtt_variance_us)
+      .Set("congestion_window_bytes", congestion_window_bytes)
+      .Set("delivery_rate", delivery_rate)
+      .Set("retransmits", retransmits)
+      .Set("busy_time_us", busy_time_us)
+      .Set("rwnd_limited_us", receive_window_limited_us)
+      .Set("sndbuf_limited_us", send_buffer_limited_us);
+}
+
+TcpInfoSampler::Registration::~Registration() {
+  sampler_->Unregister(connection_);
+  // A sweep that copied this connection before it was unregistered may
+  // still be reading it; wait for that, and stop any later read, before
+  // the caller closes the fd.
+  grpc_core::MutexLock lock(&connection_->mu);
+  connection_->registered = false;
+}
+
+std::optional<TcpInfoSample> TcpInfoSampler::Registration::last_sample()
+    const {
+  grpc_core::MutexLock lock(&connection_->mu);
+  return connection_->last_sample;
+}
+
+void TcpInfoSampler::Registration::Connection::Sample() {
+  grpc_core::MutexLock lock(&mu);
+  if (!registered) return;
+#ifdef GRPC_LINUX_ERRQUEUE
+  tcp_info info;
+  if (!GetSocketTcpInfo(&info, posix_interface, fd).ok()) return;
+  if (info.tcpi_state != kTcpEstablished) return;
+  // Fields the kernel did not fill in are left zeroed.
+  TcpInfoSample sample;
+  sample.smoothed_rtt_us = info.tcpi_rtt;
+  sample.rtt_variance_us = info.tcpi_rttvar;
+  sample.congestion_window_bytes =
+      static_cast<uint64_t>(info.tcpi_snd_cwnd) * info.tcpi_snd_mss;
+  sample.delivery_rate = info.tcpi_delivery_rate;
+  sample.retransmits = info.tcpi_total_retrans;
+  sample.busy_time_us = info.tcpi_busy_time;
+  sample.receive_window_limited_us = info.tcpi_rwnd_limited;
+  sample.send_buffer_limited_us = info.tcpi_sndbuf_limited;
+  using Domain = grpc_core::TcpInfoMetricsDomain;
+  storage->Increment(Domain::kSmoothedRtt, sample.smoothed_rtt_us);
+  storage->Increment(Domain::kCongestionWindow,
+                      sample.congestion_window_bytes);
+  if (sample.delivery_rate != 0) {
+    storage->Increment(Domain::kDeliveryRate, sample.delivery_rate);
+  }
+  const TcpInfoSample previous = last_sample.value_or(TcpInfoSample{});
+  storage->Increment(Domain::kRetransmits,
+                      Delta(sample.retransmits, previous.retransmits));
+  storage->Increment(Domain::kBusyTime,
+                      Delta(sample.busy_time_us, previous.busy_time_us));
+  storage->Increment(Domain::kReceiveWindowLimitedTime,
+                      Delta(sample.receive_window_limited_us,
+                            previous.receive_window_limited_us));
+  storage->Increment(
+      Domain::kSendBufferLimitedTime,
+      Delta(sample.send_buffer_limited_us, previous.send_buffer_limited_us));
+  last_sample = sample;
+#endif  // GRPC_LINUX_ERRQUEUE
+}
+
+TcpInfoSampler* TcpInfoSampler::Get(grpc_core::Duration interval) {
+  static absl::NoDestructor<grpc_core::Mutex> mu;
+  static absl::NoDestructor<
+      absl::flat_hash_map<int64_t, std::unique_ptr<TcpInfoSampler>>>
+      samplers;
+  grpc_core::MutexLock lock(mu.get());
+  auto& sampler = (*samplers)[interval.millis()];
+  if (sampler == nullptr) sampler.reset(new TcpInfoSampler(interval));
+  return sampler.get();
+}
+
+std::unique_ptr<TcpInfoSampler::Registration> TcpInfoSampler::Register(
+    std::shared_ptr<EventEngine> engine, FileDescriptor fd,
+    EventEnginePosixInterface* posix_interface,
+    grpc_core::InstrumentStorageRefPtr<grpc_core::TcpInfoMetricsDomain>
+        storage) {
+  auto connection =
+      std::make_shared<Connection>(fd, posix_interface, std::move(storage));
+  std::unique_ptr<Registration> registration(
+      new Registration(this, connection));
+  grpc_core::MutexLock lock(&mu_);
+  registrations_.insert(std::move(connection));
+  if (!timer_handle_.has_value()) {
+    engine_ = std::move(engine);
+    StartTimerLocked();
+  }
+  return registration;
+}
+
+void TcpInfoSampler::Unregister(
+    const std::shared_ptr<Connection>& connection) {
+  grpc_core::MutexLock lock(&mu_);
+  registrations_.erase(connection);
+  // If the timer can't be cancelled it is about to run, and will stop
+  // itself if nothing has registered by then.
+  if (registrations_.empty() && timer_handle_.has_value() &&
+      engine_->Cancel(*timer_handle_)) {
+    timer_handle_.reset();
+    engine_.reset();
+  }
+}
+
+std::vector<std::shared_ptr<TcpInfoSampler::Connection>>
+TcpInfoSampler::SnapshotLocked() {
+  return std::vector<std::shared_ptr<Connection>>(registrations_.begin(),
+                                                  registrations_.end());
+}
+
+void TcpInfoSampler::SampleAll() {
+  std::vector<std::shared_ptr<Connection>> connections;
+  {
+    grpc_core::MutexLock lock(&mu_);
+    connections = SnapshotLocked();
+  }
+  for (const auto& connection : connections) connection->Sample();
+}
+
+size_t TcpInfoSampler::num_registered() {
+  grpc_core::MutexLock lock(&mu_);
+  return registrations_.size();
+}
+
+void TcpInfoSampler::StartTimerLocked() {
+  timer_handle_ = engine_->RunAfter(interval_, [this]() { OnTimer(); });
+}
+
+void TcpInfoSampler::OnTimer() {
+  std::vector<std::shared_ptr<Connection>> connections;
+  {
+    grpc_core::MutexLock lock(&mu_);
+    if (registrations_.empty()) {
+      // Keep engine_: this callback may hold the last reference to it.
+      timer_handle_.reset();
+      return;
+    }
+    connections = SnapshotLocked();
+  }
+  for (const auto& connection : connections) connection->Sample();
+  grpc_core::MutexLock lock(&mu_);
+  // Every connection may have gone while we were sampling; check again so
+  // an empty sampler doesn't keep waking up.
+  if (registrations_.empty()) {
+    timer_handle_.reset();
+    return;
+  }
+  StartTimerLocked();
+}
+
+}  // namespace grpc_event_engine::experimental
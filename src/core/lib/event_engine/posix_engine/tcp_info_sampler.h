@@ -0,0 +1,177 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_TCP_INFO_SAMPLER_H
+#define GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_TCP_INFO_SAMPLER_H
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/support/port_platform.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "src/core/channelz/property_list.h"
+#include "src/core/lib/event_engine/posix_engine/posix_interface.h"
+#include "src/core/telemetry/histogram.h"
+#include "src/core/telemetry/instrument.h"
+#include "src/core/util/sync.h"
+#include "src/core/util/time.h"
+#include "absl/container/flat_hash_set.h"
+#include "absl/strings/string_view.h"
+
+namespace grpc_core {
+
+class TcpInfoMetricsDomain final
+    : public InstrumentDomain<TcpInfoMetricsDomain> {
+ public:
+  using Backend = LowContentionBackend;
+  static constexpr absl::string_view kName = "tcp_info";
+  GRPC_INSTRUMENT_DOMAIN_LABELS("grpc.target");
+
+  static HistogramHandle<ExponentialHistogramShape> kSmoothedRtt;
+  static HistogramHandle<ExponentialHistogramShape> kCongestionWindow;
+  static HistogramHandle<ExponentialHistogramShape> kDeliveryRate;
+  static CounterHandle kRetransmits;
+  static CounterHandle kBusyTime;
+  static CounterHandle kReceiveWindowLimitedTime;
+  static CounterHandle kSendBufferLimitedTime;
+};
+
+}  // namespace grpc_core
+
+namespace grpc_event_engine::experimental {
+
+// The parts of a connection's TCP_INFO that the sampler reports.
+struct TcpInfoSample {
+  uint32_t smoothed_rtt_us = 0;
+  uint32_t rtt_variance_us = 0;
+  uint64_t congestion_window_bytes = 0;
+  uint64_t delivery_rate = 0;  // Bytes per second.
+  // The rest are totals since the connection was established.
+  uint32_t retransmits = 0;
+  uint64_t busy_time_us = 0;
+  uint64_t receive_window_limited_us = 0;
+  uint64_t send_buffer_limited_us = 0;
+
+  grpc_core::channelz::PropertyList ToPropertyList() const;
+};
+
+// Reads TCP_INFO for connections on a timer and records it as metrics.
+//
+// Connections sampled at the same interval share a sampler, so one timer
+// sweeps all of them in a single pass instead of each connection waking up
+// on its own.  The timer only runs while connections are registered.
+class TcpInfoSampler {
+ public:
+  // A connection's membership in a sampler.  The sampler stops reading the
+  // socket once this is destroyed, so it must be destroyed before the fd is
+  // closed.
+  class Registration {
+   public:
+    ~Registration();
+
+    Registration(const Registration&) = delete;
+    Registration& operator=(const Registration&) = delete;
+
+    std::optional<TcpInfoSample> last_sample() const;
+
+   private:
+    friend class TcpInfoSampler;
+
+    // The connection as a sampling pass sees it.  Passes sample outside the
+    // sampler's lock, so they hold this rather than the Registration, and
+    // the Registration waits on `mu` for a pass that is reading its socket.
+    struct Connection {
+      Connection(
+          FileDescriptor fd, EventEnginePosixInterface* posix_interface,
+          grpc_core::InstrumentStorageRefPtr<grpc_core::TcpInfoMetricsDomain>
+              storage)
+          : fd(fd),
+            posix_interface(posix_interface),
+            storage(std::move(storage)) {}
+
+      // Reads TCP_INFO and records whatever changed since the last sample.
+      void Sample() ABSL_LOCKS_EXCLUDED(mu);
+
+      const FileDescriptor fd;
+      EventEnginePosixInterface* const posix_interface;
+      const grpc_core::InstrumentStorageRefPtr<
+          grpc_core::TcpInfoMetricsDomain>
+          storage;
+      mutable grpc_core::Mutex mu;
+      // Cleared once the Registration is gone and `fd` may be closed.
+      bool registered ABSL_GUARDED_BY(mu) = true;
+      std::optional<TcpInfoSample> last_sample ABSL_GUARDED_BY(mu);
+    };
+
+    Registration(TcpInfoSampler* sampler,
+                 std::shared_ptr<Connection> connection)
+        : sampler_(sampler), connection_(std::move(connection)) {}
+
+    TcpInfoSampler* const sampler_;
+    const std::shared_ptr<Connection> connection_;
+  };
+
+  // Returns the process-wide sampler for `interval`.
+  static TcpInfoSampler* Get(grpc_core::Duration interval);
+
+  // Starts sampling `fd`.  `engine` runs the timer if it is not already
+  // running.
+  std::unique_ptr<Registration> Register(
+      std::shared_ptr<EventEngine> engine, FileDescriptor fd,
+      EventEnginePosixInterface* posix_interface,
+      grpc_core::InstrumentStorageRefPtr<grpc_core::TcpInfoMetricsDomain>
+          storage);
+
+  // Samples every registered connection now.  Normally the timer does this.
+  void SampleAll() ABSL_LOCKS_EXCLUDED(mu_);
+
+  grpc_core::Duration interval() const { return interval_; }
+  size_t num_registered() ABSL_LOCKS_EXCLUDED(mu_);
+
+ private:
+  explicit TcpInfoSampler(grpc_core::Duration interval)
+      : interval_(interval) {}
+
+  using Connection = Registration::Connection;
+
+  void Unregister(const std::shared_ptr<Connection>& connection)
+      ABSL_LOCKS_EXCLUDED(mu_);
+  // Copies the registered connections so they can be sampled without
+  // holding `mu_`: reading TCP_INFO is a syscall per connection, and
+  // Register() and ~Registration() should not wait on a whole sweep.
+  std::vector<std::shared_ptr<Connection>> SnapshotLocked()
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  void StartTimerLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  void OnTimer() ABSL_LOCKS_EXCLUDED(mu_);
+
+  const grpc_core::Duration interval_;
+  mutable grpc_core::Mutex mu_;
+  absl::flat_hash_set<std::shared_ptr<Connection>> registrations_
+      ABSL_GUARDED_BY(mu_);
+  // The engine that runs the timer.  A timer that finds nothing registered
+  // stops without dropping it, since that could release the engine from
+  // inside its own callback; the next Register() or Unregister() that
+  // cancels the timer releases it instead.
+  std::shared_ptr<EventEngine> engine_ ABSL_GUARDED_BY(mu_);
+  std::optional<EventEngine::TaskHandle> timer_handle_ ABSL_GUARDED_BY(mu_);
+};
+
+}  // namespace grpc_event_engine::experimental
+
+#endif  // GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_TCP_INFO_SAMPLER_H
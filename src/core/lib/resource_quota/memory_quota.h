@@ -22,6 +22,7 @@
 #include <grpc/support/port_platform.h>
 #include <stdint.h>
 
+#include <algorithm>
 #include <array>
 #include <atomic>
 #include <cstddef>
@@ -339,6 +340,14 @@ class BasicMemoryQuota final
                           size_t old_free_bytes, size_t new_free_bytes);
   // Instantaneous memory pressure approximation.
   PressureInfo GetPressureInfo();
+  // Bytes currently taken from the quota, including bytes that allocators
+  // have reserved but not yet handed out.
+  size_t InstantaneousUsage() const {
+    const intptr_t free = free_bytes_.load(std::memory_order_relaxed);
+    const size_t size = quota_size_.load(std::memory_order_relaxed);
+    if (free < 0) return size + static_cast<size_t>(-free);
+    return size - std::min(size, static_cast<size_t>(free));
+  }
   // Get a reclamation queue
   ReclaimerQueue* reclaimer_queue(size_t i) { return &reclaimers_[i]; }
 
@@ -615,6 +624,11 @@ class MemoryQuota final
   // Resize the quota to new_size.
   void SetSize(size_t new_size) { memory_quota_->SetSize(new_size); }
 
+  // Bytes currently taken from the quota.
+  size_t InstantaneousUsage() const {
+    return memory_quota_->InstantaneousUsage();
+  }
+
   // Return true if the controlled memory pressure is high enough to reject new
   // connections.
   bool RejectNewConnectionsUnderHighMemoryPressure() const {
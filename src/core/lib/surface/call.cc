@@ -93,6 +93,7 @@
 #include "src/core/util/crash.h"
 #include "src/core/util/debug_location.h"
 #include "src/core/util/grpc_check.h"
+#include "src/core/util/latent_see.h"
 #include "src/core/util/match.h"
 #include "src/core/util/ref_counted.h"
 #include "src/core/util/ref_counted_ptr.h"
@@ -276,6 +277,14 @@ void Call::PropagateCancellationToChildren() {
   }
 }
 
+gpr_timespec Call::ReportLatency() {
+  gpr_timespec latency =
+      gpr_cycle_counter_sub(gpr_get_cycle_counter(), start_time());
+  latent_see::FlightRecorder::ReportLatency(latency.tv_sec * GPR_NS_PER_SEC +
+                                            latency.tv_nsec);
+  return latency;
+}
+
 void Call::PrepareOutgoingInitialMetadata(const grpc_op& op,
                                           grpc_metadata_batch& md) {
   // TODO(juanlishen): If the user has already specified a compression
@@ -187,6 +187,9 @@ class Call : public CppImplOf<Call, grpc_call>,
   void PublishToParent(Call* parent);
   void MaybeUnpublishFromParent();
   void PropagateCancellationToChildren();
+  // Returns the time since the call started, and reports it to the latent-see
+  // flight recorder.
+  gpr_timespec ReportLatency();
 
   Timestamp send_deadline() const { return send_deadline_; }
   void set_send_deadline(Timestamp send_deadline) {
@@ -252,8 +252,7 @@ void FilterStackCall::DestroyCall(void* call, grpc_error_handle /*error*/) {
                         &c->final_info_.final_status, nullptr, nullptr,
                         &(c->final_info_.error_string));
   c->status_error_.set(absl::OkStatus());
-  c->final_info_.stats.latency =
-      gpr_cycle_counter_sub(gpr_get_cycle_counter(), c->start_time());
+  c->final_info_.stats.latency = c->ReportLatency();
   grpc_call_stack_destroy(c->call_stack(), &c->final_info_,
                           GRPC_CLOSURE_INIT(&c->release_call_, ReleaseCall, c,
                                             grpc_schedule_on_exec_ctx));
@@ -0,0 +1,70 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/transport/tcp_info_bdp_estimator.h"
+
+#include <grpc/support/port_platform.h>
+
+#include <algorithm>
+
+#include "src/core/lib/debug/trace.h"
+#include "src/core/lib/transport/bdp_estimator.h"
+#include "absl/log/log.h"
+
+namespace grpc_core {
+
+namespace {
+constexpr Duration kUpdateInterval =
+    Duration::Milliseconds(kDefaultInterPingDelayMillis);
+}  // namespace
+
+void TcpInfoBdpEstimator::Sampler::AddSample(uint32_t min_rtt_us) {
+  if (min_rtt_us != 0) min_rtt_us_.store(min_rtt_us, std::memory_order_relaxed);
+}
+
+TcpInfoBdpEstimator::TcpInfoBdpEstimator(absl::string_view name)
+    : estimate_(kInitialBdpDefault),
+      last_update_(Timestamp::InfPast()),
+      peer_name_(name) {}
+
+Timestamp TcpInfoBdpEstimator::Update() {
+  const Timestamp now = Timestamp::Now();
+  double bw = 0;
+  const uint32_t min_rtt_us =
+      sampler_->min_rtt_us_.load(std::memory_order_relaxed);
+  if (min_rtt_us != 0) min_rtt_us_ = min_rtt_us;
+  if (last_update_ != Timestamp::InfPast()) {
+    const double dt = (now - last_update_).seconds();
+    if (dt > 0) bw = static_cast<double>(accumulator_) / dt;
+  }
+  last_update_ = now;
+  accumulator_ = 0;
+  bw_samples_[next_bw_sample_] = bw;
+  next_bw_sample_ = (next_bw_sample_ + 1) % kBandwidthFilterLength;
+  bw_est_ = *std::max_element(bw_samples_.begin(), bw_samples_.end());
+  // Until the endpoint has reported a round trip time, keep the initial
+  // estimate rather than guess.
+  if (min_rtt_us_ != 0) {
+    estimate_ = std::max(
+        kInitialBdpDefault,
+        static_cast<int64_t>(bw_est_ * static_cast<double>(min_rtt_us_) / 1e6));
+  }
+  GRPC_TRACE_LOG(bdp_estimator, INFO)
+      << "bdp[" << peer_name_ << "]:tcp_info bw=" << bw / 125000.0
+      << "Mbs bw_est=" << bw_est_ / 125000.0 << "Mbs min_rtt=" << min_rtt_us_
+      << "us est=" << estimate_;
+  return now + kUpdateInterval;
+}
+
+}  // namespace grpc_core
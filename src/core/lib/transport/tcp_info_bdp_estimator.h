@@ -0,0 +1,87 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_TRANSPORT_TCP_INFO_BDP_ESTIMATOR_H
+#define GRPC_SRC_CORE_LIB_TRANSPORT_TCP_INFO_BDP_ESTIMATOR_H
+
+#include <grpc/support/port_platform.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <array>
+#include <atomic>
+#include <memory>
+
+#include "src/core/util/time.h"
+#include "absl/strings/string_view.h"
+
+namespace grpc_core {
+
+// Estimates the bandwidth-delay product of a connection the way BBR does:
+// the largest recent bandwidth sample times the minimum round trip time.
+//
+// Unlike BdpEstimator, no pings are sent.  The round trip time comes from
+// TCP_INFO samples that the endpoint reports with write events, and the
+// transport's own count of received bytes provides the bandwidth.  The
+// kernel's delivery rate is not used: it measures what we send, and the
+// window being sized is the one for what we receive.
+class TcpInfoBdpEstimator {
+ public:
+  // Number of Update() calls a bandwidth sample stays in the max filter.
+  static constexpr size_t kBandwidthFilterLength = 10;
+
+  // Collects TCP_INFO samples.  Write events are reported off the
+  // transport's serializer, so this is thread-safe and outlives the
+  // estimator for as long as a write holds on to it.
+  class Sampler {
+   public:
+    // Zero means the sample has no value.
+    void AddSample(uint32_t min_rtt_us);
+
+   private:
+    friend class TcpInfoBdpEstimator;
+
+    std::atomic<uint32_t> min_rtt_us_{0};
+  };
+
+  explicit TcpInfoBdpEstimator(absl::string_view name);
+
+  int64_t EstimateBdp() const { return estimate_; }
+  double EstimateBandwidth() const { return bw_est_; }
+
+  void AddIncomingBytes(int64_t num_bytes) { accumulator_ += num_bytes; }
+  int64_t accumulator() const { return accumulator_; }
+
+  const std::shared_ptr<Sampler>& sampler() const { return sampler_; }
+
+  // Folds in the bytes received and the TCP_INFO samples since the last
+  // call, and returns when to call again.  The first call only starts the
+  // first bandwidth sample.
+  Timestamp Update();
+
+ private:
+  int64_t accumulator_ = 0;
+  int64_t estimate_;
+  double bw_est_ = 0;
+  uint32_t min_rtt_us_ = 0;
+  Timestamp last_update_;
+  std::array<double, kBandwidthFilterLength> bw_samples_{};
+  size_t next_bw_sample_ = 0;
+  const std::shared_ptr<Sampler> sampler_ = std::make_shared<Sampler>();
+  absl::string_view peer_name_;
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_LIB_TRANSPORT_TCP_INFO_BDP_ESTIMATOR_H
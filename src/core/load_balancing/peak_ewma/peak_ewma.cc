@@ -0,0 +1,743 @@
+//
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+// peak_ewma LB policy: estimates the load of each endpoint from the latency
+// of the calls sent to it, without needing backend metrics.  Each endpoint
+// keeps an exponentially weighted moving average of call latency that jumps
+// straight to any slower latency it sees (the "peak"), and its cost is that
+// average times the number of calls in flight to it.  Calls still in flight
+// count too: an endpoint whose calls have been outstanding for longer than
+// its average is costed by their age, so one that stops responding gets
+// more expensive rather than cheaper.  Each pick samples two READY endpoints
+// at random and picks the one with the lower cost.
+
+#include <grpc/impl/connectivity_state.h>
+#include <grpc/support/port_platform.h>
+#include <grpc/support/time.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "src/core/config/core_configuration.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/debug/trace.h"
+#include "src/core/lib/iomgr/resolved_address.h"
+#include "src/core/lib/transport/connectivity_state.h"
+#include "src/core/load_balancing/endpoint_list.h"
+#include "src/core/load_balancing/lb_policy.h"
+#include "src/core/load_balancing/lb_policy_factory.h"
+#include "src/core/resolver/endpoint_addresses.h"
+#include "src/core/util/debug_location.h"
+#include "src/core/util/down_cast.h"
+#include "src/core/util/grpc_check.h"
+#include "src/core/util/json/json.h"
+#include "src/core/util/json/json_args.h"
+#include "src/core/util/json/json_object_loader.h"
+#include "src/core/util/orphanable.h"
+#include "src/core/util/ref_counted.h"
+#include "src/core/util/ref_counted_ptr.h"
+#include "src/core/util/shared_bit_gen.h"
+#include "src/core/util/sync.h"
+#include "src/core/util/time.h"
+#include "src/core/util/validation_errors.h"
+#include "src/core/util/work_serializer.h"
+#include "absl/base/thread_annotations.h"
+#include "absl/log/log.h"
+#include "absl/random/random.h"
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/str_join.h"
+#include "absl/strings/string_view.h"
+
+namespace grpc_core {
+
+namespace {
+
+constexpr absl::string_view kPeakEwma = "peak_ewma_experimental";
+
+// Config for peak_ewma LB policy.
+class PeakEwmaConfig final : public LoadBalancingPolicy::Config {
+ public:
+  PeakEwmaConfig() = default;
+
+  PeakEwmaConfig(const PeakEwmaConfig&) = delete;
+  PeakEwmaConfig& operator=(const PeakEwmaConfig&) = delete;
+
+  PeakEwmaConfig(PeakEwmaConfig&&) = delete;
+  PeakEwmaConfig& operator=(PeakEwmaConfig&&) = delete;
+
+  absl::string_view name() const override { return kPeakEwma; }
+
+  Duration decay_time() const { return decay_time_; }
+  Duration default_rtt() const { return default_rtt_; }
+
+  static const JsonLoaderInterface* JsonLoader(const JsonArgs&) {
+    static const auto* loader =
+        JsonObjectLoader<PeakEwmaConfig>()
+            .OptionalField("decayTime", &PeakEwmaConfig::decay_time_)
+            .OptionalField("defaultRtt", &PeakEwmaConfig::default_rtt_)
+            .Finish();
+    return loader;
+  }
+
+  void JsonPostLoad(const Json&, const JsonArgs&, ValidationErrors* errors) {
+    ValidationErrors::ScopedField field(errors, ".decayTime");
+    if (!errors->FieldHasErrors() && decay_time_ == Duration::Zero()) {
+      errors->AddError("must be greater than 0");
+    }
+  }
+
+ private:
+  // How quickly old latency samples lose their influence.
+  Duration decay_time_ = Duration::Seconds(10);
+  // The latency assumed for an endpoint that has not completed a call yet.
+  Duration default_rtt_ = Duration::Milliseconds(30);
+};
+
+// Uses Timestamp so that the policy follows the event engine's clock, which
+// tests can drive.  Timestamp only has millisecond resolution.
+int64_t NowNanos() {
+  return static_cast<int64_t>(
+             Timestamp::Now().milliseconds_after_process_epoch()) *
+         GPR_NS_PER_MS;
+}
+
+double DurationToNanos(Duration duration) {
+  return static_cast<double>(duration.millis()) * 1e6;
+}
+
+//
+// peak_ewma LB policy
+//
+
+class PeakEwma final : public LoadBalancingPolicy {
+ public:
+  explicit PeakEwma(Args args);
+
+  absl::string_view name() const override { return kPeakEwma; }
+
+  absl::Status UpdateLocked(UpdateArgs args) override;
+  void ResetBackoffLocked() override;
+
+ private:
+  // The load estimate of a given endpoint.  Shared by all endpoint lists
+  // that contain the endpoint, so that the estimate carries over across
+  // address updates.
+  class EndpointLoad final : public RefCounted<EndpointLoad> {
+   public:
+    EndpointLoad(RefCountedPtr<PeakEwma> peak_ewma, EndpointAddressSet key,
+                 double default_rtt_nanos)
+        : peak_ewma_(std::move(peak_ewma)),
+          key_(std::move(key)),
+          default_rtt_nanos_(default_rtt_nanos),
+          epoch_nanos_(NowNanos()),
+          rtt_ewma_nanos_(default_rtt_nanos),
+          last_update_nanos_(epoch_nanos_) {}
+    ~EndpointLoad() override;
+
+    // Returns the cost of sending one more call to the endpoint.  Reads
+    // only atomics, so that pickers never block on call completions.
+    double Cost(int64_t now_nanos, double decay_nanos) const;
+
+    void CallStarted(int64_t start_nanos) {
+      in_flight_start_nanos_.fetch_add(start_nanos - epoch_nanos_,
+                                       std::memory_order_relaxed);
+      in_flight_.fetch_add(1, std::memory_order_relaxed);
+    }
+    void CallEnded(int64_t start_nanos) {
+      in_flight_.fetch_sub(1, std::memory_order_relaxed);
+      in_flight_start_nanos_.fetch_sub(start_nanos - epoch_nanos_,
+                                       std::memory_order_relaxed);
+    }
+
+    // Folds the latency of a completed call into the moving average.
+    // Failed calls may raise the average but never lower it, so that an
+    // endpoint that fails fast does not attract more traffic.
+    void RecordRtt(int64_t now_nanos, double rtt_nanos, bool call_succeeded,
+                   double decay_nanos);
+
+   private:
+    RefCountedPtr<PeakEwma> peak_ewma_;
+    const EndpointAddressSet key_;
+    // What the estimate decays back to while no calls complete.
+    const double default_rtt_nanos_;
+    // Start times of calls in flight are summed relative to this.
+    const int64_t epoch_nanos_;
+    // Serializes RecordRtt(); Cost() reads the atomics without it.
+    Mutex mu_;
+    std::atomic<double> rtt_ewma_nanos_;
+    std::atomic<int64_t> last_update_nanos_;
+    std::atomic<uint64_t> in_flight_{0};
+    // Sum of the start times of the calls in flight, from epoch_nanos_.
+    std::atomic<int64_t> in_flight_start_nanos_{0};
+  };
+
+  class PeakEwmaEndpointList final : public EndpointList {
+   public:
+    PeakEwmaEndpointList(RefCountedPtr<PeakEwma> peak_ewma,
+                             EndpointAddressesIterator* endpoints,
+                             const ChannelArgs& args,
+                             std::string resolution_note,
+                             std::vector<std::string>* errors)
+        : EndpointList(std::move(peak_ewma), std::move(resolution_note),
+                       GRPC_TRACE_FLAG_ENABLED(peak_ewma_lb)
+                           ? "PeakEwmaEndpointList"
+                           : nullptr) {
+      Init(endpoints, args,
+           [&](RefCountedPtr<EndpointList> endpoint_list,
+               const EndpointAddresses& addresses, const ChannelArgs& args) {
+             return MakeOrphanable<PeakEwmaEndpoint>(
+                 std::move(endpoint_list), addresses, args,
+                 policy<PeakEwma>()->work_serializer(), errors);
+           });
+    }
+
+    class PeakEwmaEndpoint final : public Endpoint {
+     public:
+      PeakEwmaEndpoint(RefCountedPtr<EndpointList> endpoint_list,
+                           const EndpointAddresses& addresses,
+                           const ChannelArgs& args,
+                           std::shared_ptr<WorkSerializer> work_serializer,
+                           std::vector<std::string>* errors)
+          : Endpoint(std::move(endpoint_list)),
+            endpoint_load_(policy<PeakEwma>()->GetOrCreateEndpointLoad(
+                addresses.addresses())) {
+        absl::Status status = Init(addresses, args, std::move(work_serializer));
+        if (!status.ok()) {
+          errors->emplace_back(absl::StrCat("endpoint ", addresses.ToString(),
+                                            ": ", status.ToString()));
+        }
+      }
+
+      RefCountedPtr<EndpointLoad> endpoint_load() const {
+        return endpoint_load_;
+      }
+
+     private:
+      // Called when the child policy reports a connectivity state update.
+      void OnStateUpdate(std::optional<grpc_connectivity_state> old_state,
+                         grpc_connectivity_state new_state,
+                         const absl::Status& status) override;
+
+      RefCountedPtr<EndpointLoad> endpoint_load_;
+    };
+
+   private:
+    LoadBalancingPolicy::ChannelControlHelper* channel_control_helper()
+        const override {
+      return policy<PeakEwma>()->channel_control_helper();
+    }
+
+    // Updates the counters of children in each state when a
+    // child transitions from old_state to new_state.
+    void UpdateStateCountersLocked(
+        std::optional<grpc_connectivity_state> old_state,
+        grpc_connectivity_state new_state);
+
+    // Ensures that the right child list is used and then updates
+    // the policy's connectivity state based on the child list's
+    // state counters.
+    void MaybeUpdateAggregatedConnectivityStateLocked(
+        absl::Status status_for_tf);
+
+    std::string CountersString() const {
+      return absl::StrCat("num_children=", size(), " num_ready=", num_ready_,
+                          " num_connecting=", num_connecting_,
+                          " num_transient_failure=", num_transient_failure_);
+    }
+
+    size_t num_ready_ = 0;
+    size_t num_connecting_ = 0;
+    size_t num_transient_failure_ = 0;
+
+    absl::Status last_failure_;
+  };
+
+  class Picker final : public SubchannelPicker {
+   public:
+    struct EndpointInfo {
+      RefCountedPtr<SubchannelPicker> picker;
+      RefCountedPtr<EndpointLoad> endpoint_load;
+    };
+
+    Picker(PeakEwma* parent, Duration decay_time,
+           std::vector<EndpointInfo> endpoints);
+
+    PickResult Pick(PickArgs args) override;
+
+   private:
+    class SubchannelCallTracker;
+
+    // Using pointer value only, no ref held -- do not dereference!
+    PeakEwma* parent_;
+
+    const double decay_nanos_;
+    std::vector<EndpointInfo> endpoints_;
+  };
+
+  ~PeakEwma() override;
+
+  void ShutdownLocked() override;
+
+  RefCountedPtr<EndpointLoad> GetOrCreateEndpointLoad(
+      const std::vector<grpc_resolved_address>& addresses);
+
+  RefCountedPtr<PeakEwmaConfig> config_;
+
+  // Current child list.
+  OrphanablePtr<PeakEwmaEndpointList> endpoint_list_;
+  // Latest pending child list.
+  // When we get an updated address list, we create a new child list
+  // for it here, and we wait to swap it into endpoint_list_ until the new
+  // list becomes READY.
+  OrphanablePtr<PeakEwmaEndpointList> latest_pending_endpoint_list_;
+
+  Mutex endpoint_load_map_mu_;
+  std::map<EndpointAddressSet, EndpointLoad*> endpoint_load_map_
+      ABSL_GUARDED_BY(&endpoint_load_map_mu_);
+
+  bool shutdown_ = false;
+};
+
+//
+// PeakEwma::EndpointLoad
+//
+
+PeakEwma::EndpointLoad::~EndpointLoad() {
+  MutexLock lock(&peak_ewma_->endpoint_load_map_mu_);
+  auto it = peak_ewma_->endpoint_load_map_.find(key_);
+  if (it != peak_ewma_->endpoint_load_map_.end() && it->second == this) {
+    peak_ewma_->endpoint_load_map_.erase(it);
+  }
+}
+
+double PeakEwma::EndpointLoad::Cost(int64_t now_nanos,
+                                    double decay_nanos) const {
+  double rtt_nanos = rtt_ewma_nanos_.load(std::memory_order_relaxed);
+  // Let the estimate decay back to the default while no calls complete, so
+  // that an endpoint that was slow once is eventually tried again.
+  const int64_t elapsed_nanos =
+      now_nanos - last_update_nanos_.load(std::memory_order_relaxed);
+  if (elapsed_nanos > 0) {
+    rtt_nanos = default_rtt_nanos_ + (rtt_nanos - default_rtt_nanos_) *
+                                         std::exp(-elapsed_nanos / decay_nanos);
+  }
+  // Calls in flight have taken at least as long as they have been waiting.
+  // Their mean age stands in for the latency of an endpoint that stopped
+  // completing calls.  The two atomics may be read mid-update; that only
+  // skews one estimate.
+  const uint64_t in_flight = in_flight_.load(std::memory_order_relaxed);
+  if (in_flight > 0) {
+    const double mean_start_nanos =
+        static_cast<double>(
+            in_flight_start_nanos_.load(std::memory_order_relaxed)) /
+        in_flight;
+    rtt_nanos = std::max(
+        rtt_nanos,
+        static_cast<double>(now_nanos - epoch_nanos_) - mean_start_nanos);
+  }
+  return rtt_nanos * (in_flight + 1);
+}
+
+void PeakEwma::EndpointLoad::RecordRtt(int64_t now_nanos, double rtt_nanos,
+                                       bool call_succeeded,
+                                       double decay_nanos) {
+  MutexLock lock(&mu_);
+  double rtt_ewma_nanos = rtt_ewma_nanos_.load(std::memory_order_relaxed);
+  if (rtt_nanos > rtt_ewma_nanos) {
+    // Peak: react to a slowdown immediately.
+    rtt_ewma_nanos = rtt_nanos;
+  } else if (call_succeeded) {
+    // Weight the new sample by how long it has been since the last one.
+    const int64_t elapsed_nanos =
+        now_nanos - last_update_nanos_.load(std::memory_order_relaxed);
+    const double weight =
+        elapsed_nanos > 0 ? std::exp(-elapsed_nanos / decay_nanos) : 1.0;
+    rtt_ewma_nanos = rtt_ewma_nanos * weight + rtt_nanos * (1 - weight);
+  } else {
+    return;
+  }
+  rtt_ewma_nanos_.store(rtt_ewma_nanos, std::memory_order_relaxed);
+  last_update_nanos_.store(now_nanos, std::memory_order_relaxed);
+}
+
+//
+// PeakEwma::Picker::SubchannelCallTracker
+//
+
+// Counts a call as in flight for as long as the tracker exists, which also
+// covers picks that the channel abandons without ever calling Finish(), and
+// records the latency of the call when it finishes.
+class PeakEwma::Picker::SubchannelCallTracker final
+    : public LoadBalancingPolicy::SubchannelCallTrackerInterface {
+ public:
+  SubchannelCallTracker(
+      std::unique_ptr<LoadBalancingPolicy::SubchannelCallTrackerInterface>
+          original_subchannel_call_tracker,
+      RefCountedPtr<EndpointLoad> endpoint_load, double decay_nanos)
+      : original_subchannel_call_tracker_(
+            std::move(original_subchannel_call_tracker)),
+        endpoint_load_(std::move(endpoint_load)),
+        decay_nanos_(decay_nanos),
+        start_nanos_(NowNanos()) {
+    endpoint_load_->CallStarted(start_nanos_);
+  }
+
+  ~SubchannelCallTracker() override {
+    endpoint_load_->CallEnded(start_nanos_);
+  }
+
+  void Finish(FinishArgs args) override {
+    // Delegate if needed.
+    if (original_subchannel_call_tracker_ != nullptr) {
+      original_subchannel_call_tracker_->Finish(args);
+    }
+    const int64_t now_nanos = NowNanos();
+    // A call that finished within the clock's resolution counts as taking
+    // one tick, so that endpoints faster than that all get the same
+    // non-zero estimate and are still told apart by their calls in flight.
+    const int64_t rtt_nanos =
+        std::max<int64_t>(now_nanos - start_nanos_, GPR_NS_PER_MS);
+    endpoint_load_->RecordRtt(now_nanos, static_cast<double>(rtt_nanos),
+                              args.status.ok(), decay_nanos_);
+  }
+
+ private:
+  std::unique_ptr<LoadBalancingPolicy::SubchannelCallTrackerInterface>
+      original_subchannel_call_tracker_;
+  RefCountedPtr<EndpointLoad> endpoint_load_;
+  const double decay_nanos_;
+  const int64_t start_nanos_;
+};
+
+//
+// PeakEwma::Picker
+//
+
+PeakEwma::Picker::Picker(PeakEwma* parent, Duration decay_time,
+                         std::vector<EndpointInfo> endpoints)
+    : parent_(parent),
+      decay_nanos_(DurationToNanos(decay_time)),
+      endpoints_(std::move(endpoints)) {
+  GRPC_TRACE_LOG(peak_ewma_lb, INFO)
+      << "[PE " << parent_ << " picker " << this
+      << "] created picker from endpoint_list="
+      << parent_->endpoint_list_.get() << " with " << endpoints_.size()
+      << " READY children";
+}
+
+PeakEwma::PickResult PeakEwma::Picker::Pick(PickArgs args) {
+  // Power of two choices: sample two endpoints and keep the cheaper one.
+  size_t index = 0;
+  if (endpoints_.size() > 1) {
+    SharedBitGen g;
+    const size_t first = absl::Uniform<size_t>(g, 0, endpoints_.size());
+    size_t second = absl::Uniform<size_t>(g, 0, endpoints_.size() - 1);
+    if (second >= first) ++second;
+    const int64_t now_nanos = NowNanos();
+    const double first_cost =
+        endpoints_[first].endpoint_load->Cost(now_nanos, decay_nanos_);
+    const double second_cost =
+        endpoints_[second].endpoint_load->Cost(now_nanos, decay_nanos_);
+    index = second_cost < first_cost ? second : first;
+    GRPC_TRACE_LOG(peak_ewma_lb, INFO)
+        << "[PE " << parent_ << " picker " << this << "] choosing between "
+        << first << " (cost " << first_cost << ") and " << second << " (cost "
+        << second_cost << ")";
+  }
+  GRPC_TRACE_LOG(peak_ewma_lb, INFO)
+      << "[PE " << parent_ << " picker " << this << "] using picker index "
+      << index << ", picker=" << endpoints_[index].picker.get();
+  PickResult result = endpoints_[index].picker->Pick(args);
+  auto* complete_pick = std::get_if<PickResult::Complete>(&result.result);
+  if (complete_pick != nullptr) {
+    complete_pick->subchannel_call_tracker =
+        std::make_unique<SubchannelCallTracker>(
+            std::move(complete_pick->subchannel_call_tracker),
+            endpoints_[index].endpoint_load, decay_nanos_);
+  }
+  return result;
+}
+
+//
+// PeakEwma
+//
+
+PeakEwma::PeakEwma(Args args) : LoadBalancingPolicy(std::move(args)) {
+  GRPC_TRACE_LOG(peak_ewma_lb, INFO) << "[PE " << this << "] Created";
+}
+
+PeakEwma::~PeakEwma() {
+  GRPC_TRACE_LOG(peak_ewma_lb, INFO)
+      << "[PE " << this << "] Destroying peak_ewma policy";
+  GRPC_CHECK(endpoint_list_ == nullptr);
+  GRPC_CHECK(latest_pending_endpoint_list_ == nullptr);
+}
+
+void PeakEwma::ShutdownLocked() {
+  GRPC_TRACE_LOG(peak_ewma_lb, INFO) << "[PE " << this << "] Shutting down";
+  shutdown_ = true;
+  endpoint_list_.reset();
+  latest_pending_endpoint_list_.reset();
+}
+
+void PeakEwma::ResetBackoffLocked() {
+  endpoint_list_->ResetBackoffLocked();
+  if (latest_pending_endpoint_list_ != nullptr) {
+    latest_pending_endpoint_list_->ResetBackoffLocked();
+  }
+}
+
+RefCountedPtr<PeakEwma::EndpointLoad> PeakEwma::GetOrCreateEndpointLoad(
+    const std::vector<grpc_resolved_address>& addresses) {
+  EndpointAddressSet key(addresses);
+  MutexLock lock(&endpoint_load_map_mu_);
+  auto it = endpoint_load_map_.find(key);
+  if (it != endpoint_load_map_.end()) {
+    auto endpoint_load = it->second->RefIfNonZero();
+    if (endpoint_load != nullptr) return endpoint_load;
+  }
+  auto endpoint_load = MakeRefCounted<EndpointLoad>(
+      RefAsSubclass<PeakEwma>(DEBUG_LOCATION, "EndpointLoad"), key,
+      DurationToNanos(config_->default_rtt()));
+  endpoint_load_map_[key] = endpoint_load.get();
+  return endpoint_load;
+}
+
+absl::Status PeakEwma::UpdateLocked(UpdateArgs args) {
+  config_ = args.config.TakeAsSubclass<PeakEwmaConfig>();
+  EndpointAddressesIterator* addresses = nullptr;
+  if (args.addresses.ok()) {
+    GRPC_TRACE_LOG(peak_ewma_lb, INFO)
+        << "[PE " << this << "] received update";
+    addresses = args.addresses->get();
+  } else {
+    GRPC_TRACE_LOG(peak_ewma_lb, INFO)
+        << "[PE " << this
+        << "] received update with address error: " << args.addresses.status();
+    // If we already have a child list, then keep using the existing
+    // list, but still report back that the update was not accepted.
+    if (endpoint_list_ != nullptr) return args.addresses.status();
+  }
+  // Create new child list, replacing the previous pending list, if any.
+  if (GRPC_TRACE_FLAG_ENABLED(peak_ewma_lb) &&
+      latest_pending_endpoint_list_ != nullptr) {
+    LOG(INFO) << "[PE " << this << "] replacing previous pending child list "
+              << latest_pending_endpoint_list_.get();
+  }
+  std::vector<std::string> errors;
+  latest_pending_endpoint_list_ = MakeOrphanable<PeakEwmaEndpointList>(
+      RefAsSubclass<PeakEwma>(DEBUG_LOCATION, "PeakEwmaEndpointList"),
+      addresses, args.args, std::move(args.resolution_note), &errors);
+  // If the new list is empty, immediately promote it to
+  // endpoint_list_ and report TRANSIENT_FAILURE.
+  if (latest_pending_endpoint_list_->size() == 0) {
+    if (GRPC_TRACE_FLAG_ENABLED(peak_ewma_lb) &&
+        endpoint_list_ != nullptr) {
+      LOG(INFO) << "[PE " << this << "] replacing previous child list "
+                << endpoint_list_.get();
+    }
+    endpoint_list_ = std::move(latest_pending_endpoint_list_);
+    absl::Status status = args.addresses.ok()
+                              ? absl::UnavailableError("empty address list")
+                              : args.addresses.status();
+    endpoint_list_->ReportTransientFailure(status);
+    return status;
+  }
+  // Otherwise, if this is the initial update, immediately promote it to
+  // endpoint_list_.
+  if (endpoint_list_ == nullptr) {
+    endpoint_list_ = std::move(latest_pending_endpoint_list_);
+  }
+  if (!errors.empty()) {
+    return absl::UnavailableError(absl::StrCat(
+        "errors from children: [", absl::StrJoin(errors, "; "), "]"));
+  }
+  return absl::OkStatus();
+}
+
+//
+// PeakEwma::PeakEwmaEndpointList::PeakEwmaEndpoint
+//
+
+void PeakEwma::PeakEwmaEndpointList::PeakEwmaEndpoint::
+    OnStateUpdate(std::optional<grpc_connectivity_state> old_state,
+                  grpc_connectivity_state new_state,
+                  const absl::Status& status) {
+  auto* pe_endpoint_list = endpoint_list<PeakEwmaEndpointList>();
+  auto* peak_ewma = policy<PeakEwma>();
+  GRPC_TRACE_LOG(peak_ewma_lb, INFO)
+      << "[PE " << peak_ewma << "] connectivity changed for child "
+      << this << ", endpoint_list " << pe_endpoint_list << " (index "
+      << Index() << " of " << pe_endpoint_list->size() << "): prev_state="
+      << (old_state.has_value() ? ConnectivityStateName(*old_state) : "N/A")
+      << " new_state=" << ConnectivityStateName(new_state) << " (" << status
+      << ")";
+  if (new_state == GRPC_CHANNEL_IDLE) {
+    GRPC_TRACE_LOG(peak_ewma_lb, INFO)
+        << "[PE " << peak_ewma << "] child " << this
+        << " reported IDLE; requesting connection";
+    ExitIdleLocked();
+  }
+  // If state changed, update state counters.
+  if (!old_state.has_value() || *old_state != new_state) {
+    pe_endpoint_list->UpdateStateCountersLocked(old_state, new_state);
+  }
+  // Update the policy state.
+  pe_endpoint_list->MaybeUpdateAggregatedConnectivityStateLocked(status);
+}
+
+//
+// PeakEwma::PeakEwmaEndpointList
+//
+
+void PeakEwma::PeakEwmaEndpointList::UpdateStateCountersLocked(
+    std::optional<grpc_connectivity_state> old_state,
+    grpc_connectivity_state new_state) {
+  // We treat IDLE the same as CONNECTING, since it will immediately
+  // transition into that state anyway.
+  if (old_state.has_value()) {
+    GRPC_CHECK(*old_state != GRPC_CHANNEL_SHUTDOWN);
+    if (*old_state == GRPC_CHANNEL_READY) {
+      GRPC_CHECK_GT(num_ready_, 0u);
+      --num_ready_;
+    } else if (*old_state == GRPC_CHANNEL_CONNECTING ||
+               *old_state == GRPC_CHANNEL_IDLE) {
+      GRPC_CHECK_GT(num_connecting_, 0u);
+      --num_connecting_;
+    } else if (*old_state == GRPC_CHANNEL_TRANSIENT_FAILURE) {
+      GRPC_CHECK_GT(num_transient_failure_, 0u);
+      --num_transient_failure_;
+    }
+  }
+  GRPC_CHECK(new_state != GRPC_CHANNEL_SHUTDOWN);
+  if (new_state == GRPC_CHANNEL_READY) {
+    ++num_ready_;
+  } else if (new_state == GRPC_CHANNEL_CONNECTING ||
+             new_state == GRPC_CHANNEL_IDLE) {
+    ++num_connecting_;
+  } else if (new_state == GRPC_CHANNEL_TRANSIENT_FAILURE) {
+    ++num_transient_failure_;
+  }
+}
+
+void PeakEwma::PeakEwmaEndpointList::
+    MaybeUpdateAggregatedConnectivityStateLocked(absl::Status status_for_tf) {
+  auto* peak_ewma = policy<PeakEwma>();
+  // If this is latest_pending_endpoint_list_, then swap it into
+  // endpoint_list_ in the following cases:
+  // - endpoint_list_ has no READY children.
+  // - This list has at least one READY child and we have seen the
+  //   initial connectivity state notification for all children.
+  // - All of the children in this list are in TRANSIENT_FAILURE.
+  //   (This may cause the channel to go from READY to TRANSIENT_FAILURE,
+  //   but we're doing what the control plane told us to do.)
+  if (peak_ewma->latest_pending_endpoint_list_.get() == this &&
+      (peak_ewma->endpoint_list_->num_ready_ == 0 ||
+       (num_ready_ > 0 && AllEndpointsSeenInitialState()) ||
+       num_transient_failure_ == size())) {
+    if (GRPC_TRACE_FLAG_ENABLED(peak_ewma_lb)) {
+      LOG(INFO) << "[PE " << peak_ewma << "] swapping out child list "
+                << peak_ewma->endpoint_list_.get() << " ("
+                << peak_ewma->endpoint_list_->CountersString()
+                << ") in favor of " << this << " (" << CountersString() << ")";
+    }
+    peak_ewma->endpoint_list_ =
+        std::move(peak_ewma->latest_pending_endpoint_list_);
+  }
+  // Only set connectivity state if this is the current child list.
+  if (peak_ewma->endpoint_list_.get() != this) return;
+  // First matching rule wins:
+  // 1) ANY child is READY => policy is READY.
+  // 2) ANY child is CONNECTING => policy is CONNECTING.
+  // 3) ALL children are TRANSIENT_FAILURE => policy is TRANSIENT_FAILURE.
+  if (num_ready_ > 0) {
+    GRPC_TRACE_LOG(peak_ewma_lb, INFO)
+        << "[PE " << peak_ewma << "] reporting READY with child list "
+        << this;
+    std::vector<Picker::EndpointInfo> endpoints;
+    for (const auto& endpoint : this->endpoints()) {
+      auto state = endpoint->connectivity_state();
+      if (state.has_value() && *state == GRPC_CHANNEL_READY) {
+        endpoints.push_back(
+            {endpoint->picker(),
+             DownCast<PeakEwmaEndpoint*>(endpoint.get())->endpoint_load()});
+      }
+    }
+    GRPC_CHECK(!endpoints.empty());
+    peak_ewma->channel_control_helper()->UpdateState(
+        GRPC_CHANNEL_READY, absl::OkStatus(),
+        MakeRefCounted<Picker>(peak_ewma, peak_ewma->config_->decay_time(),
+                               std::move(endpoints)));
+  } else if (num_connecting_ > 0) {
+    GRPC_TRACE_LOG(peak_ewma_lb, INFO)
+        << "[PE " << peak_ewma << "] reporting CONNECTING with child list "
+        << this;
+    peak_ewma->channel_control_helper()->UpdateState(
+        GRPC_CHANNEL_CONNECTING, absl::OkStatus(),
+        MakeRefCounted<QueuePicker>(nullptr));
+  } else if (num_transient_failure_ == size()) {
+    GRPC_TRACE_LOG(peak_ewma_lb, INFO)
+        << "[PE " << peak_ewma
+        << "] reporting TRANSIENT_FAILURE with child list " << this << ": "
+        << status_for_tf;
+    if (!status_for_tf.ok()) {
+      last_failure_ = absl::UnavailableError(
+          absl::StrCat("connections to all backends failing; last error: ",
+                       status_for_tf.message()));
+    }
+    ReportTransientFailure(last_failure_);
+  }
+}
+
+//
+// factory
+//
+
+class PeakEwmaFactory final : public LoadBalancingPolicyFactory {
+ public:
+  OrphanablePtr<LoadBalancingPolicy> CreateLoadBalancingPolicy(
+      LoadBalancingPolicy::Args args) const override {
+    return MakeOrphanable<PeakEwma>(std::move(args));
+  }
+
+  absl::string_view name() const override { return kPeakEwma; }
+
+  absl::StatusOr<RefCountedPtr<LoadBalancingPolicy::Config>>
+  ParseLoadBalancingConfig(const Json& json) const override {
+    return LoadFromJson<RefCountedPtr<PeakEwmaConfig>>(
+        json, JsonArgs(), "errors validating peak_ewma LB policy config");
+  }
+};
+
+}  // namespace
+
+void RegisterPeakEwmaLbPolicy(CoreConfiguration::Builder* builder) {
+  builder->lb_policy_registry()->RegisterLoadBalancingPolicyFactory(
+      std::make_unique<PeakEwmaFactory>());
+}
+
+}  // namespace grpc_core
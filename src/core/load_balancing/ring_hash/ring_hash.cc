@@ -49,6 +49,7 @@
 #include "src/core/load_balancing/lb_policy_factory.h"
 #include "src/core/load_balancing/lb_policy_registry.h"
 #include "src/core/load_balancing/pick_first/pick_first.h"
+#include "src/core/load_balancing/ring_hash/ring_hash_lookup.h"
 #include "src/core/resolver/endpoint_addresses.h"
 #include "src/core/util/crash.h"
 #include "src/core/util/debug_location.h"
@@ -171,10 +172,21 @@ class RingHash final : public LoadBalancingPolicy {
 
     Ring(RingHash* ring_hash, RingHashLbConfig* config);
 
+    // For a Maglev lookup table, the entries are the table slots, and their
+    // hashes are unused.
     const std::vector<RingEntry>& ring() const { return ring_; }
 
+    // Returns the index of the entry in ring() that owns request_hash.
+    size_t FindIndex(uint64_t request_hash) const {
+      if (lookup_table_.has_value()) return lookup_table_->Find(request_hash);
+      if (ring_.empty()) return 0;
+      return request_hash % ring_.size();
+    }
+
    private:
     std::vector<RingEntry> ring_;
+    // Unset if ring_ is a Maglev lookup table.
+    std::optional<RingHashLookupTable> lookup_table_;
   };
 
   // State for a particular endpoint.  Delegates to a pick_first child policy.
@@ -348,34 +360,8 @@ RingHash::PickResult RingHash::Picker::Pick(PickArgs args) {
     }
   }
   // Find the index in the ring to use for this RPC.
-  // Ported from https://github.com/RJ/ketama/blob/master/libketama/ketama.c
-  // (ketama_get_server) NOTE: The algorithm depends on using signed integers
-  // for lowp, highp, and index. Do not change them!
   const auto& ring = ring_->ring();
-  int64_t lowp = 0;
-  int64_t highp = ring.size();
-  int64_t index = 0;
-  while (true) {
-    index = (lowp + highp) / 2;
-    if (index == static_cast<int64_t>(ring.size())) {
-      index = 0;
-      break;
-    }
-    uint64_t midval = ring[index].hash;
-    uint64_t midval1 = index == 0 ? 0 : ring[index - 1].hash;
-    if (request_hash <= midval && request_hash > midval1) {
-      break;
-    }
-    if (midval < request_hash) {
-      lowp = index + 1;
-    } else {
-      highp = index - 1;
-    }
-    if (lowp > highp) {
-      index = 0;
-      break;
-    }
-  }
+  const size_t index = ring_->FindIndex(request_hash);
   // Find the first endpoint we can use from the selected index.
   if (!using_random_hash) {
     for (size_t i = 0; i < ring.size(); ++i) {
@@ -485,8 +471,28 @@ RingHash::Ring::Ring(RingHash* ring_hash, RingHashLbConfig* config) {
   const double scale = std::min(
       std::ceil(min_normalized_weight * min_ring_size) / min_normalized_weight,
       static_cast<double>(max_ring_size));
-  // Reserve memory for the entire ring up front.
   const uint64_t ring_size = std::ceil(scale);
+  // With Maglev, the ring size only determines the size of the lookup table,
+  // whose slots are then split among the endpoints according to their weights.
+  if (ring_hash->args_.GetBool(GRPC_ARG_RING_HASH_LB_USE_MAGLEV)
+          .value_or(false)) {
+    std::vector<std::string> hash_keys;
+    std::vector<uint32_t> weights;
+    hash_keys.reserve(endpoint_weights.size());
+    weights.reserve(endpoint_weights.size());
+    for (auto& endpoint_weight : endpoint_weights) {
+      hash_keys.push_back(std::move(endpoint_weight.hash_key));
+      weights.push_back(endpoint_weight.weight);
+    }
+    std::vector<size_t> table =
+        BuildMaglevTable(hash_keys, weights, MaglevTableSize(ring_size));
+    ring_.reserve(table.size());
+    for (size_t endpoint_index : table) {
+      ring_.push_back({0, endpoint_index});
+    }
+    return;
+  }
+  // Reserve memory for the entire ring up front.
   ring_.reserve(ring_size);
   // Populate the hash ring by walking through the (host, weight) pairs in
   // normalized_host_weights, and generating (scale * weight) hashes for each
@@ -525,6 +531,10 @@ RingHash::Ring::Ring(RingHash* ring_hash, RingHashLbConfig* config) {
             [](const RingEntry& lhs, const RingEntry& rhs) -> bool {
               return lhs.hash < rhs.hash;
             });
+  std::vector<uint64_t> hashes;
+  hashes.reserve(ring_.size());
+  for (const RingEntry& entry : ring_) hashes.push_back(entry.hash);
+  lookup_table_.emplace(std::move(hashes));
 }
 
 //
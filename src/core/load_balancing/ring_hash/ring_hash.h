@@ -31,6 +31,12 @@
 #define GRPC_ARG_RING_HASH_ENDPOINT_HASH_KEY \
   GRPC_ARG_NO_SUBCHANNEL_PREFIX "hash_key"
 
+// Channel arg to map request hashes to endpoints with a Maglev lookup table
+// instead of a ring, making picks O(1).  The min and max ring size then bound
+// the size of the table.  Note that the same request hash generally maps to a
+// different endpoint than it would on a ring.  Boolean, defaults to false.
+#define GRPC_ARG_RING_HASH_LB_USE_MAGLEV "grpc.lb.ring_hash.use_maglev"
+
 namespace grpc_core {
 
 class RequestHashAttribute final
@@ -0,0 +1,143 @@
+//
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include "src/core/load_balancing/ring_hash/ring_hash_lookup.h"
+
+#include <grpc/support/port_platform.h>
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+#include "src/core/util/grpc_check.h"
+#include "src/core/util/xxhash_inline.h"
+
+namespace grpc_core {
+
+namespace {
+
+// Caps the prefix index at 64K buckets (256KiB), which is plenty for the
+// default ring size cap of 4096 entries.
+constexpr int kMaxPrefixBits = 16;
+
+}  // namespace
+
+//
+// RingHashLookupTable
+//
+
+RingHashLookupTable::RingHashLookupTable(std::vector<uint64_t> hashes)
+    : hashes_(std::move(hashes)) {
+  GRPC_CHECK_LE(hashes_.size(), std::numeric_limits<uint32_t>::max());
+  GRPC_DCHECK(std::is_sorted(hashes_.begin(), hashes_.end()));
+  // Use about one bucket per ring entry, so that each bucket holds only a
+  // few entries even when the hashes are not perfectly uniform.
+  int prefix_bits = 1;
+  while (prefix_bits < kMaxPrefixBits &&
+         (size_t{1} << prefix_bits) < hashes_.size()) {
+    ++prefix_bits;
+  }
+  shift_ = 64 - prefix_bits;
+  const size_t num_prefixes = size_t{1} << prefix_bits;
+  prefix_index_.resize(num_prefixes + 1);
+  size_t index = 0;
+  for (size_t prefix = 0; prefix < num_prefixes; ++prefix) {
+    while (index < hashes_.size() && (hashes_[index] >> shift_) < prefix) {
+      ++index;
+    }
+    prefix_index_[prefix] = index;
+  }
+  prefix_index_[num_prefixes] = hashes_.size();
+}
+
+size_t RingHashLookupTable::Find(uint64_t hash) const {
+  const size_t prefix = hash >> shift_;
+  const auto begin = hashes_.begin() + prefix_index_[prefix];
+  const auto end = hashes_.begin() + prefix_index_[prefix + 1];
+  // If all hashes in the bucket are smaller than the request hash, this
+  // yields the first entry of the next non-empty bucket, which is the owner.
+  const size_t index = std::lower_bound(begin, end, hash) - hashes_.begin();
+  return index == hashes_.size() ? 0 : index;
+}
+
+//
+// Maglev
+//
+
+size_t MaglevTableSize(size_t min_size) {
+  for (size_t n = std::max<size_t>(min_size, 2);; ++n) {
+    bool is_prime = true;
+    for (size_t d = 2; d * d <= n; ++d) {
+      if (n % d == 0) {
+        is_prime = false;
+        break;
+      }
+    }
+    if (is_prime) return n;
+  }
+}
+
+std::vector<size_t> BuildMaglevTable(absl::Span<const std::string> hash_keys,
+                                     absl::Span<const uint32_t> weights,
+                                     size_t table_size) {
+  GRPC_CHECK_EQ(hash_keys.size(), weights.size());
+  GRPC_CHECK_GE(table_size, 2u);
+  if (hash_keys.empty()) return {};
+  // Each endpoint fills the slots of its own permutation of the table, given
+  // by (offset + skip * i) % table_size.  Since table_size is prime, every
+  // permutation visits every slot.
+  struct Permutation {
+    uint64_t offset;
+    uint64_t skip;
+    uint64_t next = 0;
+    uint64_t target_weight = 0;
+  };
+  std::vector<Permutation> permutations;
+  permutations.reserve(hash_keys.size());
+  uint64_t max_weight = 0;
+  for (size_t i = 0; i < hash_keys.size(); ++i) {
+    GRPC_CHECK_GT(weights[i], 0u);
+    const std::string& key = hash_keys[i];
+    permutations.push_back(
+        {XXH64(key.data(), key.size(), 0) % table_size,
+         XXH64(key.data(), key.size(), 1) % (table_size - 1) + 1});
+    max_weight = std::max<uint64_t>(max_weight, weights[i]);
+  }
+  constexpr size_t kEmpty = std::numeric_limits<size_t>::max();
+  std::vector<size_t> table(table_size, kEmpty);
+  size_t filled = 0;
+  // Endpoints take turns claiming their next free slot.  An endpoint with the
+  // maximum weight takes a turn in every round; one with a third of that
+  // weight only in every third round.
+  for (uint64_t round = 1; filled < table_size; ++round) {
+    for (size_t i = 0; i < permutations.size() && filled < table_size; ++i) {
+      Permutation& permutation = permutations[i];
+      if (round * weights[i] < permutation.target_weight) continue;
+      permutation.target_weight += max_weight;
+      size_t slot;
+      do {
+        slot = (permutation.offset + permutation.skip * permutation.next) %
+               table_size;
+        ++permutation.next;
+      } while (table[slot] != kEmpty);
+      table[slot] = i;
+      ++filled;
+    }
+  }
+  return table;
+}
+
+}  // namespace grpc_core
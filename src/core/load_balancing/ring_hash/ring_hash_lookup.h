@@ -0,0 +1,80 @@
+//
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#ifndef GRPC_SRC_CORE_LOAD_BALANCING_RING_HASH_RING_HASH_LOOKUP_H
+#define GRPC_SRC_CORE_LOAD_BALANCING_RING_HASH_RING_HASH_LOOKUP_H
+
+#include <grpc/support/port_platform.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+#include "absl/types/span.h"
+
+namespace grpc_core {
+
+// Finds the owner of a request hash on a hash ring: the first ring entry whose
+// hash is not smaller than the request hash, wrapping around to the first
+// entry.
+//
+// Rather than binary searching the whole ring, the table keeps the ring hashes
+// in a dense array alongside a prefix index that maps the top bits of a hash
+// to the range of ring entries sharing them. With roughly one prefix bucket
+// per ring entry, a lookup is one index load followed by a binary search over
+// a handful of neighbouring hashes, usually within a single cache line.
+//
+// Construction is O(|hashes|). Lookups are thread-safe.
+class RingHashLookupTable final {
+ public:
+  // `hashes` must be sorted in ascending order.
+  explicit RingHashLookupTable(std::vector<uint64_t> hashes);
+
+  // Returns the index of the ring entry owning `hash`, or 0 if the ring is
+  // empty.
+  size_t Find(uint64_t hash) const;
+
+ private:
+  std::vector<uint64_t> hashes_;
+  // prefix_index_[p] is the index of the first hash whose top bits are >= p.
+  // Has one more element than there are prefixes, so that the entries for
+  // prefix p are always in [prefix_index_[p], prefix_index_[p + 1]).
+  std::vector<uint32_t> prefix_index_;
+  int shift_;
+};
+
+// Returns the smallest prime that is not smaller than `min_size` (or 2).
+// Maglev lookup tables must have a prime number of slots.
+size_t MaglevTableSize(size_t min_size);
+
+// Builds a Maglev lookup table (Eisenbud et al., "Maglev: A Fast and Reliable
+// Software Network Load Balancer", NSDI 2016) with `table_size` slots, which
+// must be prime. Endpoint i is identified by `hash_keys[i]` and gets a share of
+// the slots proportional to `weights[i]`, which must be non-zero. Returns the
+// endpoint index for each slot, or an empty table if there are no endpoints.
+//
+// A request hash is mapped to the endpoint in slot (hash % table_size), which
+// makes lookups O(1). Compared to a ring, the slots are spread more evenly
+// among endpoints, at the cost of remapping slightly more keys when the set of
+// endpoints changes.
+std::vector<size_t> BuildMaglevTable(absl::Span<const std::string> hash_keys,
+                                     absl::Span<const uint32_t> weights,
+                                     size_t table_size);
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_LOAD_BALANCING_RING_HASH_RING_HASH_LOOKUP_H
@@ -38,6 +38,7 @@
 #include <string.h>
 
 #include <algorithm>
+#include <atomic>
 #include <deque>
 #include <list>
 #include <map>
@@ -295,7 +296,21 @@ class RlsLb final : public LoadBalancingPolicy {
       return connectivity_state_;
     }
 
+    RefCountedPtr<SubchannelPicker> picker() const
+        ABSL_EXCLUSIVE_LOCKS_REQUIRED(&RlsLb::mu_) {
+      return picker_;
+    }
+
+    // Changes whenever connectivity_state() or picker() does.
+    uint64_t generation() const ABSL_EXCLUSIVE_LOCKS_REQUIRED(&RlsLb::mu_) {
+      return generation_;
+    }
+
    private:
+    // Records a change of connectivity_state_ or picker_, which cache entry
+    // snapshots using this child need to pick up.
+    void OnStateChanged() ABSL_EXCLUSIVE_LOCKS_REQUIRED(&RlsLb::mu_);
+
     // ChannelControlHelper object that allows the child policy to update state
     // with the wrapper.
     class ChildPolicyHelper final : public DelegatingChannelControlHelper {
@@ -335,25 +350,26 @@ class RlsLb final : public LoadBalancingPolicy {
         GRPC_CHANNEL_CONNECTING;
     RefCountedPtr<LoadBalancingPolicy::SubchannelPicker> picker_
         ABSL_GUARDED_BY(&RlsLb::mu_);
+    uint64_t generation_ ABSL_GUARDED_BY(&RlsLb::mu_) = 0;
   };
 
-  // A picker that uses the cache and the request map in the LB policy
-  // (synchronized via a mutex) to determine how to route requests.
-  class Picker final : public LoadBalancingPolicy::SubchannelPicker {
-   public:
-    explicit Picker(RefCountedPtr<RlsLb> lb_policy);
-
-    PickResult Pick(PickArgs args) override;
-
-   private:
-    PickResult PickFromDefaultTargetOrFail(const char* reason, PickArgs args,
-                                           absl::Status status)
-        ABSL_EXCLUSIVE_LOCKS_REQUIRED(&RlsLb::mu_);
+  class CacheEntrySnapshot;
 
-    RefCountedPtr<RlsLb> lb_policy_;
-    RefCountedPtr<RlsLbConfig> config_;
-    RefCountedPtr<ChildPolicyWrapper> default_child_policy_;
+  struct CacheSnapshotKeyHash {
+    size_t operator()(const RequestKey* key) const {
+      return absl::Hash<RequestKey>()(*key);
+    }
+  };
+  struct CacheSnapshotKeyEq {
+    bool operator()(const RequestKey* a, const RequestKey* b) const {
+      return *a == *b;
+    }
   };
+  // Entries of the cache with unexpired data, keyed by pointers to the keys
+  // held in the entry snapshots themselves.
+  using CacheSnapshot =
+      std::unordered_map<const RequestKey*, RefCountedPtr<CacheEntrySnapshot>,
+                         CacheSnapshotKeyHash, CacheSnapshotKeyEq>;
 
   // An LRU cache with adjustable size.
   class Cache final {
@@ -433,6 +449,27 @@ class RlsLb final : public LoadBalancingPolicy {
       // Moves entry to the end of the LRU list.
       void MarkUsed() ABSL_EXCLUSIVE_LOCKS_REQUIRED(&RlsLb::mu_);
 
+      // Records a pick served from a snapshot of the entry. Such picks do not
+      // hold the lock, so the entry is only moved in the LRU list when it is
+      // next considered for eviction.
+      void MarkUsedByPicker() {
+        if (!used_by_picker_.load(std::memory_order_relaxed)) {
+          used_by_picker_.store(true, std::memory_order_relaxed);
+        }
+      }
+
+      // Returns true, and clears the mark, if MarkUsedByPicker() was called
+      // since the last call.
+      bool TakeUsedByPicker() {
+        return used_by_picker_.exchange(false, std::memory_order_relaxed);
+      }
+
+      // Returns a snapshot of the entry for picks that do not take the lock,
+      // or null if the entry has no unexpired data. The snapshot is reused
+      // until the entry or one of its own child policies changes.
+      RefCountedPtr<CacheEntrySnapshot> Snapshot(Timestamp now)
+          ABSL_EXCLUSIVE_LOCKS_REQUIRED(&RlsLb::mu_);
+
       // Takes entries from child_policy_wrappers_ and appends them to the end
       // of \a child_policy_wrappers.
       void TakeChildPolicyWrappers(
@@ -446,6 +483,9 @@ class RlsLb final : public LoadBalancingPolicy {
       }
 
      private:
+      // Drops the snapshot of the entry, and so the cache's snapshot too.
+      void InvalidateSnapshot() ABSL_EXCLUSIVE_LOCKS_REQUIRED(&RlsLb::mu_);
+
       class BackoffTimer final : public InternallyRefCounted<BackoffTimer> {
        public:
         BackoffTimer(RefCountedPtr<Entry> entry, Duration delay);
@@ -487,6 +527,10 @@ class RlsLb final : public LoadBalancingPolicy {
 
       Timestamp min_expiration_time_ ABSL_GUARDED_BY(&RlsLb::mu_);
       Cache::Iterator lru_iterator_ ABSL_GUARDED_BY(&RlsLb::mu_);
+
+      // Snapshot handed to pickers.
+      RefCountedPtr<CacheEntrySnapshot> snapshot_ ABSL_GUARDED_BY(&RlsLb::mu_);
+      std::atomic<bool> used_by_picker_{false};
     };
 
     explicit Cache(RlsLb* lb_policy);
@@ -524,6 +568,17 @@ class RlsLb final : public LoadBalancingPolicy {
     void ReportMetricsLocked(CallbackMetricReporter& reporter)
         ABSL_EXCLUSIVE_LOCKS_REQUIRED(&RlsLb::mu_);
 
+    // Returns snapshots of all entries with unexpired data, to be published
+    // with a new picker. The result is reused until InvalidateSnapshot() is
+    // called, and rebuilding it only re-snapshots the entries that changed.
+    std::shared_ptr<const CacheSnapshot> Snapshot()
+        ABSL_EXCLUSIVE_LOCKS_REQUIRED(&RlsLb::mu_);
+
+    // Called when an entry is added, removed, or gets a new snapshot.
+    void InvalidateSnapshot() ABSL_EXCLUSIVE_LOCKS_REQUIRED(&RlsLb::mu_) {
+      snapshot_.reset();
+    }
+
    private:
     // Shared logic for starting the cleanup timer
     void StartCleanupTimer() ABSL_EXCLUSIVE_LOCKS_REQUIRED(&RlsLb::mu_);
@@ -548,9 +603,115 @@ class RlsLb final : public LoadBalancingPolicy {
     std::list<RequestKey> lru_list_ ABSL_GUARDED_BY(&RlsLb::mu_);
     std::unordered_map<RequestKey, OrphanablePtr<Entry>, absl::Hash<RequestKey>>
         map_ ABSL_GUARDED_BY(&RlsLb::mu_);
+    std::shared_ptr<const CacheSnapshot> snapshot_ ABSL_GUARDED_BY(&RlsLb::mu_);
     std::optional<EventEngine::TaskHandle> cleanup_timer_handle_;
   };
 
+  // A view of a cache entry with unexpired data, published with each picker
+  // so that picks for cached keys do not need to take mu_. Only the times
+  // and the refresh flag change once it is built.
+  class CacheEntrySnapshot final : public RefCounted<CacheEntrySnapshot> {
+   public:
+    struct Target {
+      std::string name;
+      grpc_connectivity_state state;
+      RefCountedPtr<SubchannelPicker> picker;
+      // ChildPolicyWrapper::generation() that state and picker are from.
+      uint64_t generation;
+    };
+
+    CacheEntrySnapshot(RefCountedPtr<Cache::Entry> entry, RequestKey key,
+                       Timestamp data_expiration_time, Timestamp stale_time,
+                       grpc_event_engine::experimental::Slice header_data,
+                       std::vector<Target> targets)
+        : entry_(std::move(entry)),
+          key_(std::move(key)),
+          data_expiration_time_(
+              data_expiration_time.milliseconds_after_process_epoch()),
+          stale_time_(stale_time.milliseconds_after_process_epoch()),
+          header_data_(std::move(header_data)),
+          targets_(std::move(targets)) {}
+
+    const RequestKey& key() const { return key_; }
+
+    // Returns true if a pick at \a now can be served from the snapshot
+    // without taking the lock: the data must not have expired, and must
+    // either not be stale or already have a refresh request pending.
+    bool CanPick(Timestamp now) const {
+      const uint64_t now_ms = now.milliseconds_after_process_epoch();
+      return data_expiration_time_.load(std::memory_order_relaxed) >= now_ms &&
+             (stale_time_.load(std::memory_order_relaxed) >= now_ms ||
+              refresh_pending_.load(std::memory_order_relaxed));
+    }
+
+    // Records that an RLS request to refresh the entry is pending, so that
+    // picks can keep using the stale data until the response arrives.
+    void MarkRefreshPending() {
+      refresh_pending_.store(true, std::memory_order_relaxed);
+    }
+
+    // Takes the times of a response that left the targets and header data
+    // unchanged, so that the entry needs neither a new snapshot nor a new
+    // picker.
+    void Refresh(Timestamp data_expiration_time, Timestamp stale_time) {
+      data_expiration_time_.store(
+          data_expiration_time.milliseconds_after_process_epoch(),
+          std::memory_order_relaxed);
+      stale_time_.store(stale_time.milliseconds_after_process_epoch(),
+                        std::memory_order_relaxed);
+      refresh_pending_.store(false, std::memory_order_relaxed);
+    }
+
+    // Returns true if the snapshot still has the current state and picker of
+    // each of \a child_policy_wrappers, which must be the entry's.
+    bool IsCurrent(const std::vector<RefCountedPtr<ChildPolicyWrapper>>&
+                       child_policy_wrappers) const
+        ABSL_EXCLUSIVE_LOCKS_REQUIRED(&RlsLb::mu_) {
+      for (size_t i = 0; i < targets_.size(); ++i) {
+        if (targets_[i].generation != child_policy_wrappers[i]->generation()) {
+          return false;
+        }
+      }
+      return true;
+    }
+
+    // Same as Cache::Entry::Pick(), using the state captured in the snapshot.
+    PickResult Pick(PickArgs args, RlsLb* lb_policy,
+                    absl::string_view lookup_service) const;
+
+   private:
+    const RefCountedPtr<Cache::Entry> entry_;
+    const RequestKey key_;
+    // Timestamps, as milliseconds after the process epoch.
+    std::atomic<uint64_t> data_expiration_time_;
+    std::atomic<uint64_t> stale_time_;
+    const grpc_event_engine::experimental::Slice header_data_;
+    const std::vector<Target> targets_;
+    std::atomic<bool> refresh_pending_{false};
+  };
+
+  // A picker that serves cached keys from a snapshot of the cache, and
+  // otherwise uses the cache and the request map in the LB policy
+  // (synchronized via a mutex) to determine how to route requests.
+  class Picker final : public LoadBalancingPolicy::SubchannelPicker {
+   public:
+    Picker(RefCountedPtr<RlsLb> lb_policy,
+           std::shared_ptr<const CacheSnapshot> cache_snapshot);
+
+    PickResult Pick(PickArgs args) override;
+
+   private:
+    PickResult PickFromDefaultTargetOrFail(const char* reason, PickArgs args,
+                                           absl::Status status)
+        ABSL_EXCLUSIVE_LOCKS_REQUIRED(&RlsLb::mu_);
+
+    RefCountedPtr<RlsLb> lb_policy_;
+    RefCountedPtr<RlsLbConfig> config_;
+    RefCountedPtr<ChildPolicyWrapper> default_child_policy_;
+    // Null if the LB policy has no child policies.
+    const std::shared_ptr<const CacheSnapshot> cache_snapshot_;
+  };
+
   // Channel for communicating with the RLS server.
   // Contains throttling logic for RLS requests.
   class RlsChannel final : public InternallyRefCounted<RlsChannel> {
@@ -819,6 +980,7 @@ void RlsLb::ChildPolicyWrapper::StartUpdate(
     pending_config_.reset();
     picker_ = MakeRefCounted<TransientFailurePicker>(
         absl::UnavailableError(config.status().message()));
+    OnStateChanged();
     *child_policy_to_delete = std::move(child_policy_);
   } else {
     pending_config_ = std::move(*config);
@@ -857,6 +1019,11 @@ absl::Status RlsLb::ChildPolicyWrapper::MaybeFinishUpdate() {
   return child_policy_->UpdateLocked(std::move(update_args));
 }
 
+void RlsLb::ChildPolicyWrapper::OnStateChanged() {
+  ++generation_;
+  lb_policy_->cache_.InvalidateSnapshot();
+}
+
 //
 // RlsLb::ChildPolicyWrapper::ChildPolicyHelper
 //
@@ -885,6 +1052,7 @@ void RlsLb::ChildPolicyWrapper::ChildPolicyHelper::UpdateState(
       // We want to unref the picker after we release the lock.
       wrapper_->picker_.swap(picker);
     }
+    wrapper_->OnStateChanged();
   }
   wrapper_->lb_policy_->UpdatePickerLocked();
 }
@@ -955,8 +1123,11 @@ std::map<std::string, std::string> BuildKeyMap(
   return key_map;
 }
 
-RlsLb::Picker::Picker(RefCountedPtr<RlsLb> lb_policy)
-    : lb_policy_(std::move(lb_policy)), config_(lb_policy_->config_) {
+RlsLb::Picker::Picker(RefCountedPtr<RlsLb> lb_policy,
+                      std::shared_ptr<const CacheSnapshot> cache_snapshot)
+    : lb_policy_(std::move(lb_policy)),
+      config_(lb_policy_->config_),
+      cache_snapshot_(std::move(cache_snapshot)) {
   if (lb_policy_->default_child_policy_ != nullptr) {
     default_child_policy_ =
         lb_policy_->default_child_policy_->Ref(DEBUG_LOCATION, "Picker");
@@ -973,6 +1144,20 @@ LoadBalancingPolicy::PickResult RlsLb::Picker::Pick(PickArgs args) {
       << "[rlslb " << lb_policy_.get() << "] picker=" << this
       << ": request keys: " << key.ToString();
   Timestamp now = Timestamp::Now();
+  // Serve cached keys from the snapshot without taking the lock.
+  CacheEntrySnapshot* entry_snapshot = nullptr;
+  if (cache_snapshot_ != nullptr) {
+    if (auto it = cache_snapshot_->find(&key); it != cache_snapshot_->end()) {
+      entry_snapshot = it->second.get();
+    }
+  }
+  if (entry_snapshot != nullptr && entry_snapshot->CanPick(now)) {
+    GRPC_TRACE_LOG(rls_lb, INFO)
+        << "[rlslb " << lb_policy_.get() << "] picker=" << this
+        << ": using cache entry snapshot " << entry_snapshot;
+    return entry_snapshot->Pick(args, lb_policy_.get(),
+                                config_->lookup_service());
+  }
   MutexLock lock(&lb_policy_->mu_);
   if (lb_policy_->is_shutdown_) {
     return PickResult::Fail(
@@ -1006,6 +1191,13 @@ LoadBalancingPolicy::PickResult RlsLb::Picker::Pick(PickArgs args) {
   if (entry != nullptr) {
     // If the entry has non-expired data, use it.
     if (entry->data_expiration_time() >= now) {
+      // Once a refresh is pending, further picks for this key can keep
+      // using the snapshot until the response arrives.
+      if (entry_snapshot != nullptr &&
+          lb_policy_->request_map_.find(key) !=
+              lb_policy_->request_map_.end()) {
+        entry_snapshot->MarkRefreshPending();
+      }
       GRPC_TRACE_LOG(rls_lb, INFO)
           << "[rlslb " << lb_policy_.get() << "] picker=" << this
           << ": using cache entry " << entry;
@@ -1056,6 +1248,45 @@ LoadBalancingPolicy::PickResult RlsLb::Picker::PickFromDefaultTargetOrFail(
   return PickResult::Fail(std::move(status));
 }
 
+//
+// RlsLb::CacheEntrySnapshot
+//
+
+LoadBalancingPolicy::PickResult RlsLb::CacheEntrySnapshot::Pick(
+    PickArgs args, RlsLb* lb_policy, absl::string_view lookup_service) const {
+  entry_->MarkUsedByPicker();
+  // Skip targets before the last one that are in state TRANSIENT_FAILURE.
+  size_t i = 0;
+  while (i < targets_.size() - 1 &&
+         targets_[i].state == GRPC_CHANNEL_TRANSIENT_FAILURE) {
+    ++i;
+  }
+  const Target& target = targets_[i];
+  GRPC_TRACE_LOG(rls_lb, INFO)
+      << "[rlslb " << lb_policy << "] cache entry snapshot=" << this << " "
+      << key_.ToString() << ": target " << target.name << " (" << i << " of "
+      << targets_.size() << ") in state "
+      << ConnectivityStateName(target.state) << "; delegating";
+  absl::string_view telemetry_label;
+  if (auto* label = GetContext<Arena>()->GetContext<TelemetryLabel>();
+      label != nullptr) {
+    telemetry_label = label->value;
+  }
+  auto pick_result = target.picker->Pick(args);
+  lb_policy->MaybeExportPickCount(kMetricTargetPicks, target.name,
+                                  lookup_service, pick_result,
+                                  telemetry_label);
+  // Add header data.
+  if (!header_data_.empty()) {
+    auto* complete_pick =
+        std::get_if<PickResult::Complete>(&pick_result.result);
+    if (complete_pick != nullptr) {
+      complete_pick->metadata_mutations.Set(kRlsHeaderKey, header_data_.Ref());
+    }
+  }
+  return pick_result;
+}
+
 //
 // RlsLb::Cache::Entry::BackoffTimer
 //
@@ -1135,6 +1366,8 @@ void RlsLb::Cache::Entry::Orphan() {
       << "[rlslb " << lb_policy_.get() << "] cache entry=" << this << " "
       << lru_iterator_->ToString() << ": cache entry evicted";
   is_shutdown_ = true;
+  // The snapshot holds a ref to us.
+  InvalidateSnapshot();
   lb_policy_->cache_.lru_list_.erase(lru_iterator_);
   lru_iterator_ = lb_policy_->cache_.lru_list_.end();  // Just in case.
   GRPC_CHECK(child_policy_wrappers_.empty());
@@ -1223,6 +1456,39 @@ void RlsLb::Cache::Entry::MarkUsed() {
   lru_iterator_ = new_it;
 }
 
+RefCountedPtr<RlsLb::CacheEntrySnapshot> RlsLb::Cache::Entry::Snapshot(
+    Timestamp now) {
+  if (data_expiration_time_ < now || child_policy_wrappers_.empty()) {
+    snapshot_.reset();
+    return nullptr;
+  }
+  if (snapshot_ != nullptr && snapshot_->IsCurrent(child_policy_wrappers_)) {
+    return snapshot_;
+  }
+  std::vector<CacheEntrySnapshot::Target> targets;
+  targets.reserve(child_policy_wrappers_.size());
+  for (const auto& child_policy_wrapper : child_policy_wrappers_) {
+    RefCountedPtr<SubchannelPicker> picker = child_policy_wrapper->picker();
+    if (picker == nullptr) {
+      snapshot_.reset();
+      return nullptr;
+    }
+    targets.push_back({child_policy_wrapper->target(),
+                       child_policy_wrapper->connectivity_state(),
+                       std::move(picker), child_policy_wrapper->generation()});
+  }
+  snapshot_ = MakeRefCounted<CacheEntrySnapshot>(
+      Ref(DEBUG_LOCATION, "CacheEntrySnapshot"), *lru_iterator_,
+      data_expiration_time_, stale_time_, header_data_.Ref(),
+      std::move(targets));
+  return snapshot_;
+}
+
+void RlsLb::Cache::Entry::InvalidateSnapshot() {
+  snapshot_.reset();
+  lb_policy_->cache_.InvalidateSnapshot();
+}
+
 std::vector<RlsLb::ChildPolicyWrapper*>
 RlsLb::Cache::Entry::OnRlsResponseLocked(
     ResponseInfo response, std::unique_ptr<BackOff> backoff_state,
@@ -1232,6 +1498,7 @@ RlsLb::Cache::Entry::OnRlsResponseLocked(
   // If the request failed, store the failed status and update the
   // backoff state.
   if (!response.status.ok()) {
+    InvalidateSnapshot();
     status_ = response.status;
     if (backoff_state != nullptr) {
       backoff_state_ = std::move(backoff_state);
@@ -1248,8 +1515,12 @@ RlsLb::Cache::Entry::OnRlsResponseLocked(
     return {};
   }
   // Request succeeded, so store the result.
-  header_data_ = std::move(response.header_data);
   Timestamp now = Timestamp::Now();
+  // No pick is ever queued on an entry with unexpired data.
+  const bool had_data = data_expiration_time_ >= now;
+  const bool header_data_changed = header_data_.as_string_view() !=
+                                   response.header_data.as_string_view();
+  header_data_ = std::move(response.header_data);
   data_expiration_time_ = now + lb_policy_->config_->max_age();
   stale_time_ = now + lb_policy_->config_->stale_age();
   status_ = absl::OkStatus();
@@ -1268,12 +1539,21 @@ RlsLb::Cache::Entry::OnRlsResponseLocked(
   }();
   if (!targets_changed) {
     // Targets didn't change, so we're not updating the list of child
-    // policies.  Return a new picker so that any queued requests can be
-    // re-processed.
+    // policies.  If only the times changed, update the published snapshot
+    // in place: nothing is queued on the entry and pickers need no new
+    // data.
+    if (had_data && !header_data_changed && snapshot_ != nullptr) {
+      snapshot_->Refresh(data_expiration_time_, stale_time_);
+      return {};
+    }
+    // Return a new picker so that any queued requests can be re-processed
+    // and the picker's snapshot of the cache picks up the new data.
+    InvalidateSnapshot();
     lb_policy_->UpdatePickerAsync();
     return {};
   }
   // Target list changed, so update it.
+  InvalidateSnapshot();
   std::set<absl::string_view> old_targets;
   for (RefCountedPtr<ChildPolicyWrapper>& child_policy_wrapper :
        child_policy_wrappers_) {
@@ -1375,6 +1655,7 @@ std::vector<RefCountedPtr<RlsLb::ChildPolicyWrapper>> RlsLb::Cache::Shutdown() {
   }
   map_.clear();
   lru_list_.clear();
+  snapshot_.reset();
   if (cleanup_timer_handle_.has_value() &&
       lb_policy_->channel_control_helper()->GetEventEngine()->Cancel(
           *cleanup_timer_handle_)) {
@@ -1385,6 +1666,20 @@ std::vector<RefCountedPtr<RlsLb::ChildPolicyWrapper>> RlsLb::Cache::Shutdown() {
   return child_policy_wrappers_to_delete;
 }
 
+std::shared_ptr<const RlsLb::CacheSnapshot> RlsLb::Cache::Snapshot() {
+  if (snapshot_ != nullptr) return snapshot_;
+  auto snapshot = std::make_shared<CacheSnapshot>();
+  Timestamp now = Timestamp::Now();
+  for (auto& [_, entry] : map_) {
+    RefCountedPtr<CacheEntrySnapshot> entry_snapshot = entry->Snapshot(now);
+    if (entry_snapshot == nullptr) continue;
+    const RequestKey* key = &entry_snapshot->key();
+    snapshot->emplace(key, std::move(entry_snapshot));
+  }
+  snapshot_ = std::move(snapshot);
+  return snapshot_;
+}
+
 void RlsLb::Cache::ReportMetricsLocked(CallbackMetricReporter& reporter) {
   reporter.Report(
       kMetricCacheSize, size_,
@@ -1449,6 +1744,11 @@ void RlsLb::Cache::MaybeShrinkSize(
     GRPC_CHECK(map_it != map_.end());
     auto& entry = map_it->second;
     if (!entry->CanEvict()) break;
+    // Give entries that picks used without the lock a second chance.
+    if (entry->TakeUsedByPicker()) {
+      entry->MarkUsed();
+      continue;
+    }
     GRPC_TRACE_LOG(rls_lb, INFO)
         << "[rlslb " << lb_policy_ << "] LRU eviction: removing entry "
         << entry.get() << " " << lru_it->ToString();
@@ -2094,6 +2394,8 @@ void RlsLb::UpdatePickerLocked() {
   if (update_in_progress_) return;
   GRPC_TRACE_LOG(rls_lb, INFO) << "[rlslb " << this << "] updating picker";
   grpc_connectivity_state state = GRPC_CHANNEL_IDLE;
+  // Cache entries only have usable data when they have child policies.
+  std::shared_ptr<const CacheSnapshot> cache_snapshot;
   if (!child_policy_map_.empty()) {
     state = GRPC_CHANNEL_TRANSIENT_FAILURE;
     int num_idle = 0;
@@ -2101,6 +2403,7 @@ void RlsLb::UpdatePickerLocked() {
     {
       MutexLock lock(&mu_);
       if (is_shutdown_) return;
+      cache_snapshot = cache_.Snapshot();
       for (auto& [_, child] : child_policy_map_) {
         grpc_connectivity_state child_state = child->connectivity_state();
         GRPC_TRACE_LOG(rls_lb, INFO)
@@ -2132,7 +2435,8 @@ void RlsLb::UpdatePickerLocked() {
   }
   channel_control_helper()->UpdateState(
       state, status,
-      MakeRefCounted<Picker>(RefAsSubclass<RlsLb>(DEBUG_LOCATION, "Picker")));
+      MakeRefCounted<Picker>(RefAsSubclass<RlsLb>(DEBUG_LOCATION, "Picker"),
+                             std::move(cache_snapshot)));
 }
 
 template <typename HandleType>
@@ -0,0 +1,89 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/telemetry/call_trace_sampler.h"
+
+#include <grpc/support/port_platform.h>
+#include <grpc/support/time.h>
+
+#include <algorithm>
+
+#include "src/core/util/shared_bit_gen.h"
+#include "src/core/util/useful.h"
+#include "absl/random/distributions.h"
+
+namespace grpc_core {
+
+namespace {
+// How many calls a thread starts between checks for whether the rate is due
+// for adjustment, to keep clock reads off the per-call path.
+constexpr uint32_t kCallsPerAdjustCheck = 256;
+// The most the rate may grow in one adjustment, so that a quiet period
+// does not let it overshoot when load returns.
+constexpr double kMaxGrowth = 2.0;
+}  // namespace
+
+CallTraceSampler::CallTraceSampler(double cpu_budget)
+    : cpu_budget_(cpu_budget) {
+  const Timestamp now = Timestamp::Now();
+  last_adjust_ = now;
+  next_adjust_ms_.store(
+      (now + AdjustPeriod()).milliseconds_after_process_epoch(),
+      std::memory_order_relaxed);
+}
+
+bool CallTraceSampler::ShouldSample() {
+  static thread_local uint32_t calls = 0;
+  if (GPR_UNLIKELY(++calls % kCallsPerAdjustCheck == 0)) {
+    MaybeAdjustRate(Timestamp::Now());
+  }
+  const uint64_t threshold = threshold_.load(std::memory_order_relaxed);
+  if (threshold >= kAlways) return true;
+  SharedBitGen bit_gen;
+  return absl::Uniform<uint32_t>(bit_gen) < threshold;
+}
+
+void CallTraceSampler::MaybeAdjustRate(Timestamp now) {
+  if (now.milliseconds_after_process_epoch() <
+      next_adjust_ms_.load(std::memory_order_relaxed)) {
+    return;
+  }
+  // Whoever gets the lock adjusts; everyone else carries on sampling.
+  if (!mu_.TryLock()) return;
+  const Duration elapsed = now - last_adjust_;
+  if (elapsed >= AdjustPeriod()) {
+    last_adjust_ = now;
+    next_adjust_ms_.store(
+        (now + AdjustPeriod()).milliseconds_after_process_epoch(),
+        std::memory_order_relaxed);
+    const double cost_ns = static_cast<double>(
+        cost_ns_.exchange(0, std::memory_order_relaxed));
+    const double budget_ns = cpu_budget_ * elapsed.seconds() * GPR_NS_PER_SEC;
+    double growth = kMaxGrowth;
+    if (cost_ns > 0) growth = std::min(kMaxGrowth, budget_ns / cost_ns);
+    const double new_rate = Clamp(rate() * growth, MinRate(), 1.0);
+    threshold_.store(static_cast<uint64_t>(new_rate * kAlways),
+                     std::memory_order_relaxed);
+  }
+  mu_.Unlock();
+}
+
+void CallTraceSampler::AddCost(gpr_cycle_counter start) {
+  const gpr_timespec elapsed =
+      gpr_cycle_counter_sub(gpr_get_cycle_counter(), start);
+  cost_ns_.fetch_add(elapsed.tv_sec * GPR_NS_PER_SEC + elapsed.tv_nsec,
+                     std::memory_order_relaxed);
+}
+
+}  // namespace grpc_core
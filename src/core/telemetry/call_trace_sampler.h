@@ -0,0 +1,97 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_TELEMETRY_CALL_TRACE_SAMPLER_H
+#define GRPC_SRC_CORE_TELEMETRY_CALL_TRACE_SAMPLER_H
+
+#include <grpc/support/port_platform.h>
+#include <stdint.h>
+
+#include <atomic>
+
+#include "src/core/util/sync.h"
+#include "src/core/util/time.h"
+#include "src/core/util/time_precise.h"
+
+namespace grpc_core {
+
+// Decides when each call starts whether it is traced, so that tracers can
+// skip spans, annotations and the strings that go into them for calls that
+// are not.
+//
+// The fraction of calls traced adapts to a CPU budget: tracers measure the
+// work they do for traced calls with CostScope, and every AdjustPeriod() the
+// rate is scaled so that this work stays within the budget.  The rate never
+// drops below MinRate(), so that the cost estimate stays current.
+class CallTraceSampler {
+ public:
+  static constexpr Duration AdjustPeriod() { return Duration::Seconds(1); }
+  static constexpr double MinRate() { return 1.0 / 65536; }
+
+  // Measures the CPU spent on tracing work in its scope.  A null sampler
+  // measures nothing.
+  class CostScope {
+   public:
+    explicit CostScope(CallTraceSampler* sampler)
+        : sampler_(sampler),
+          start_(sampler == nullptr ? gpr_cycle_counter{}
+                                    : gpr_get_cycle_counter()) {}
+    ~CostScope() {
+      if (sampler_ != nullptr) sampler_->AddCost(start_);
+    }
+
+    CostScope(const CostScope&) = delete;
+    CostScope& operator=(const CostScope&) = delete;
+
+   private:
+    CallTraceSampler* const sampler_;
+    const gpr_cycle_counter start_;
+  };
+
+  // `cpu_budget` is the share of one CPU that tracing may use, e.g. 0.01 for
+  // 1%.  Sampling starts with every call traced.
+  explicit CallTraceSampler(double cpu_budget);
+
+  // Called once per call, when it starts.
+  bool ShouldSample();
+
+  double rate() const {
+    return static_cast<double>(threshold_.load(std::memory_order_relaxed)) /
+           kAlways;
+  }
+
+  // Adjusts the rate if AdjustPeriod() has passed since the last adjustment.
+  // ShouldSample() calls this every so often.
+  void MaybeAdjustRate(Timestamp now);
+
+ private:
+  // A call is sampled if a random 32-bit value is below the threshold.
+  static constexpr uint64_t kAlways = uint64_t{1} << 32;
+
+  void AddCost(gpr_cycle_counter start);
+
+  const double cpu_budget_;
+  std::atomic<uint64_t> threshold_{kAlways};
+  // Nanoseconds of tracing work since the last adjustment.
+  std::atomic<int64_t> cost_ns_{0};
+  // When the next adjustment is due, in milliseconds after the process
+  // epoch.
+  std::atomic<int64_t> next_adjust_ms_;
+  Mutex mu_;
+  Timestamp last_adjust_ ABSL_GUARDED_BY(mu_);
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_TELEMETRY_CALL_TRACE_SAMPLER_H
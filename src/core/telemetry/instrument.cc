@@ -943,6 +943,36 @@ uint64_t HighContentionBackend::Sum(size_t index) {
   return positive_sum - negative_sum;
 }
 
+PerCpuBackend::PerCpuBackend(size_t size) {
+  const size_t lines = (size + kCountersPerLine - 1) / kCountersPerLine;
+  for (auto& shard : counters_) {
+    shard = std::make_unique<Line[]>(lines);
+    for (size_t i = 0; i < lines; ++i) {
+      for (auto& counter : shard[i].counters) {
+        counter.store(0, std::memory_order_relaxed);
+      }
+    }
+  }
+}
+
+uint64_t PerCpuBackend::Sum(size_t index) {
+  uint64_t positive_sum = 0;
+  uint64_t negative_sum = 0;
+  for (auto& shard : counters_) {
+    int64_t value = shard[index / kCountersPerLine]
+                        .counters[index % kCountersPerLine]
+                        .load(std::memory_order_relaxed);
+    if (value > 0) {
+      positive_sum += value;
+    } else if (value < 0) {
+      negative_sum += -value;
+    }
+  }
+  // Every decrement should have a corresponding increment.
+  GRPC_CHECK(positive_sum >= negative_sum);
+  return positive_sum - negative_sum;
+}
+
 class GlobalCollectionScopeManager {
  public:
   GlobalCollectionScopeManager(const GlobalCollectionScopeManager&) = delete;
@@ -45,8 +45,9 @@
 //     instance is reused (shared).
 //
 // *   **Backend:** Determines how the metric data is stored and aggregated
-//     within a Storage object. Examples include `LowContentionBackend` and
-//     `HighContentionBackend` for counters and histograms.
+//     within a Storage object. Examples include `LowContentionBackend`,
+//     `HighContentionBackend` and `PerCpuBackend` for counters and
+//     histograms.
 //
 // ## Instrument Types
 //
@@ -90,7 +91,7 @@
 // `InstrumentDomain<YourDomainName>`. This class must define:
 //
 // 1.  `using Backend = ...;`: Specifies the backend type (e.g.,
-//      `LowContentionBackend`, `HighContentionBackend`).
+//      `LowContentionBackend`, `HighContentionBackend`, `PerCpuBackend`).
 // 2.  `GRPC_INSTRUMENT_DOMAIN_LABELS("label1", "label2", ...);`: Defines the
 //      names of the labels for this domain via a macro that generates a
 //      static `Labels()` method. The types of the labels are inferred from
@@ -824,6 +825,44 @@ class HighContentionBackend final {
       PerCpuOptions().SetMaxShards(16)};
 };
 
+// A domain backend for the hottest domains, updated on every call or
+// every read/write on a busy process.
+// Like HighContentionBackend, but with a shard for every CPU, and with each
+// shard's counters laid out on cache lines of their own, so that updates
+// from different CPUs never write to the same line.  Memory use grows with
+// the number of CPUs, so this suits domains with few label combinations.
+class PerCpuBackend final {
+ public:
+  explicit PerCpuBackend(size_t size);
+
+  void Add(size_t index, uint64_t amount) {
+    CounterFor(index).fetch_add(amount, std::memory_order_relaxed);
+  }
+  void Subtract(size_t index, uint64_t amount) {
+    CounterFor(index).fetch_sub(amount, std::memory_order_relaxed);
+  }
+  void Increment(size_t index) { Add(index, 1); }
+  void Decrement(size_t index) { Subtract(index, 1); }
+
+  uint64_t Sum(size_t index);
+
+ private:
+  static constexpr size_t kCountersPerLine =
+      GPR_CACHELINE_SIZE / sizeof(std::atomic<int64_t>);
+  struct alignas(GPR_CACHELINE_SIZE) Line {
+    std::atomic<int64_t> counters[kCountersPerLine];
+  };
+
+  std::atomic<int64_t>& CounterFor(size_t index) {
+    return counters_.this_cpu()[index / kCountersPerLine]
+        .counters[index % kCountersPerLine];
+  }
+
+  // As with HighContentionBackend, a counter may be incremented on one CPU
+  // and decremented on another, so the shards hold signed values.
+  PerCpu<std::unique_ptr<Line[]>> counters_{PerCpuOptions()};
+};
+
 // MetricsSink is an interface for accumulating metrics.
 // Importantly it's the output interface for MetricsQuery.
 class MetricsSink {
@@ -0,0 +1,107 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_TELEMETRY_LATENCY_SKETCH_H
+#define GRPC_SRC_CORE_TELEMETRY_LATENCY_SKETCH_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+#include "src/core/telemetry/histogram.h"
+#include "src/core/util/no_destruct.h"
+#include "src/core/util/time.h"
+
+namespace grpc_core {
+
+// Approximate latency distribution for answering percentile queries on
+// the recent past.
+//
+// Samples are counted in exponential buckets of milliseconds, so a
+// percentile is accurate to within one bucket (about 12%).  Whenever
+// kDecaySamples samples have been recorded, all counts are halved, so
+// that the distribution follows shifts in load instead of being dominated
+// by old samples.
+//
+// Record() and Percentile() may be called concurrently from any thread.
+// Concurrent calls to Record() during a decay may lose a sample, which is
+// fine for an estimate.
+class LatencySketch {
+ public:
+  static constexpr size_t kBuckets = 100;
+  static constexpr int64_t kMaxMillis = 100 * 1000;
+  static constexpr uint64_t kDecaySamples = 1000;
+
+  void Record(Duration latency) {
+    const int64_t millis = latency.millis();
+    counts_[Shape().BucketFor(millis < 0 ? 0 : millis)].fetch_add(
+        1, std::memory_order_relaxed);
+    if (total_.fetch_add(1, std::memory_order_relaxed) + 1 ==
+        2 * kDecaySamples) {
+      Decay();
+    }
+  }
+
+  // Returns the given percentile (between 0 and 100) of the recorded
+  // latencies, rounded up to the end of its bucket, or nullopt if fewer
+  // than min_samples samples are available.
+  std::optional<Duration> Percentile(double percentile,
+                                     uint64_t min_samples) const {
+    std::array<uint64_t, kBuckets> counts;
+    uint64_t total = 0;
+    for (size_t i = 0; i < kBuckets; ++i) {
+      counts[i] = counts_[i].load(std::memory_order_relaxed);
+      total += counts[i];
+    }
+    if (total == 0 || total < min_samples) return std::nullopt;
+    const double rank = total * percentile / 100.0;
+    uint64_t seen = 0;
+    const HistogramBuckets bounds = Shape().bounds();
+    for (size_t i = 0; i < kBuckets; ++i) {
+      seen += counts[i];
+      if (seen >= rank && counts[i] > 0) {
+        return Duration::Milliseconds(bounds[i]);
+      }
+    }
+    return Duration::Milliseconds(bounds.back());
+  }
+
+ private:
+  static const ExponentialHistogramShape& Shape() {
+    static const NoDestruct<ExponentialHistogramShape> shape(kMaxMillis,
+                                                             kBuckets);
+    return *shape;
+  }
+
+  void Decay() {
+    uint64_t removed = 0;
+    for (auto& count : counts_) {
+      uint64_t value = count.load(std::memory_order_relaxed);
+      while (!count.compare_exchange_weak(value, value - value / 2,
+                                          std::memory_order_relaxed)) {
+      }
+      removed += value / 2;
+    }
+    total_.fetch_sub(removed, std::memory_order_relaxed);
+  }
+
+  std::array<std::atomic<uint64_t>, kBuckets> counts_{};
+  std::atomic<uint64_t> total_{0};
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_TELEMETRY_LATENCY_SKETCH_H
@@ -20,6 +20,10 @@
 
 #include <grpc/support/alloc.h>
 #include <grpc/support/port_platform.h>
+#include <string.h>
+
+#include <algorithm>
+#include <vector>
 
 #include "src/core/lib/slice/slice.h"
 #include "src/core/lib/slice/slice_internal.h"
@@ -123,10 +127,185 @@ static tsi_result alts_grpc_privacy_integrity_unprotect(
   return TSI_OK;
 }
 
+namespace {
+
+// Walks the slices of a slice buffer in order, handing out consecutive byte
+// ranges as iovecs without copying the underlying data.
+class SliceBufferCursor {
+ public:
+  explicit SliceBufferCursor(grpc_slice_buffer* sb) : sb_(sb) {}
+
+  // Appends iovecs covering the next length bytes to vec.
+  void Take(size_t length, std::vector<iovec_t>* vec) {
+    while (length > 0) {
+      grpc_slice& slice = sb_->slices[index_];
+      size_t n = std::min(GRPC_SLICE_LENGTH(slice) - offset_, length);
+      vec->push_back({GRPC_SLICE_START_PTR(slice) + offset_, n});
+      Advance(n);
+      length -= n;
+    }
+  }
+
+  // Copies the next length bytes to dst.
+  void Copy(size_t length, unsigned char* dst) {
+    while (length > 0) {
+      grpc_slice& slice = sb_->slices[index_];
+      size_t n = std::min(GRPC_SLICE_LENGTH(slice) - offset_, length);
+      memcpy(dst, GRPC_SLICE_START_PTR(slice) + offset_, n);
+      Advance(n);
+      dst += n;
+      length -= n;
+    }
+  }
+
+ private:
+  void Advance(size_t n) {
+    offset_ += n;
+    if (offset_ == GRPC_SLICE_LENGTH(sb_->slices[index_])) {
+      ++index_;
+      offset_ = 0;
+    }
+  }
+
+  grpc_slice_buffer* sb_;
+  size_t index_ = 0;
+  size_t offset_ = 0;
+};
+
+}  // namespace
+
+static tsi_result alts_grpc_privacy_integrity_protect_batch(
+    alts_grpc_record_protocol* rp, grpc_slice_buffer* unprotected_slices,
+    size_t max_unprotected_data_size, grpc_slice_buffer* protected_slices) {
+  // Input sanity check.
+  if (rp == nullptr || unprotected_slices == nullptr ||
+      protected_slices == nullptr || max_unprotected_data_size == 0) {
+    LOG(ERROR) << "Invalid arguments to alts_grpc_record_protocol protect "
+                  "batch.";
+    return TSI_INVALID_ARGUMENT;
+  }
+  // Splits the unprotected data into frames the same way repeated calls to
+  // protect would, so an empty input still produces a single empty frame.
+  size_t data_length = unprotected_slices->length;
+  size_t num_frames =
+      data_length == 0 ? 1
+                       : (data_length + max_unprotected_data_size - 1) /
+                             max_unprotected_data_size;
+  size_t frame_overhead = rp->header_length + rp->tag_length;
+  // All protected frames are written into one newly allocated buffer.
+  grpc_slice protected_slice =
+      allocate_slice(rp, data_length + num_frames * frame_overhead);
+  std::vector<iovec_t> iovecs;
+  iovecs.reserve(unprotected_slices->count + num_frames);
+  std::vector<size_t> iovec_offsets(num_frames + 1, 0);
+  std::vector<alts_iovec_record_protocol_protect_frame> frames(num_frames);
+  SliceBufferCursor cursor(unprotected_slices);
+  unsigned char* frame_start = GRPC_SLICE_START_PTR(protected_slice);
+  size_t remaining = data_length;
+  for (size_t i = 0; i < num_frames; ++i) {
+    size_t frame_data_length = std::min(remaining, max_unprotected_data_size);
+    cursor.Take(frame_data_length, &iovecs);
+    iovec_offsets[i + 1] = iovecs.size();
+    frames[i].protected_frame = {frame_start,
+                                 frame_data_length + frame_overhead};
+    frame_start += frame_data_length + frame_overhead;
+    remaining -= frame_data_length;
+  }
+  // iovecs is fully populated, so pointers into it are now stable.
+  for (size_t i = 0; i < num_frames; ++i) {
+    frames[i].unprotected_vec = iovecs.data() + iovec_offsets[i];
+    frames[i].unprotected_vec_length = iovec_offsets[i + 1] - iovec_offsets[i];
+  }
+  // Calls alts_iovec_record_protocol protect batch.
+  char* error_details = nullptr;
+  grpc_status_code status =
+      alts_iovec_record_protocol_privacy_integrity_protect_batch(
+          rp->iovec_rp, frames.data(), frames.size(), &error_details);
+  if (status != GRPC_STATUS_OK) {
+    LOG(ERROR) << "Failed to protect, " << error_details;
+    gpr_free(error_details);
+    grpc_core::CSliceUnref(protected_slice);
+    return TSI_INTERNAL_ERROR;
+  }
+  grpc_slice_buffer_add(protected_slices, protected_slice);
+  grpc_slice_buffer_reset_and_unref(unprotected_slices);
+  return TSI_OK;
+}
+
+static tsi_result alts_grpc_privacy_integrity_unprotect_batch(
+    alts_grpc_record_protocol* rp, grpc_slice_buffer* protected_slices,
+    const uint32_t* frame_sizes, size_t num_frames,
+    grpc_slice_buffer* unprotected_slices) {
+  // Input sanity check.
+  if (rp == nullptr || protected_slices == nullptr ||
+      unprotected_slices == nullptr || frame_sizes == nullptr) {
+    LOG(ERROR) << "Invalid nullptr arguments to alts_grpc_record_protocol "
+                  "unprotect batch.";
+    return TSI_INVALID_ARGUMENT;
+  }
+  size_t frame_overhead = rp->header_length + rp->tag_length;
+  size_t total_frame_size = 0;
+  for (size_t i = 0; i < num_frames; ++i) {
+    if (frame_sizes[i] < frame_overhead) {
+      LOG(ERROR) << "Protected slices do not have sufficient data.";
+      return TSI_INVALID_ARGUMENT;
+    }
+    total_frame_size += frame_sizes[i];
+  }
+  if (total_frame_size != protected_slices->length) {
+    LOG(ERROR) << "Frame sizes do not match protected slices length.";
+    return TSI_INVALID_ARGUMENT;
+  }
+  // The unprotected data of all frames is stored in one newly allocated
+  // buffer.
+  grpc_slice unprotected_slice =
+      allocate_slice(rp, total_frame_size - num_frames * frame_overhead);
+  // Frame headers may straddle slices, so they are always copied into a flat
+  // buffer. Ciphertext and tags are referenced in place.
+  std::vector<unsigned char> headers(num_frames * rp->header_length);
+  std::vector<iovec_t> iovecs;
+  iovecs.reserve(protected_slices->count + num_frames);
+  std::vector<size_t> iovec_offsets(num_frames + 1, 0);
+  std::vector<alts_iovec_record_protocol_unprotect_frame> frames(num_frames);
+  SliceBufferCursor cursor(protected_slices);
+  unsigned char* data_start = GRPC_SLICE_START_PTR(unprotected_slice);
+  for (size_t i = 0; i < num_frames; ++i) {
+    unsigned char* header = headers.data() + i * rp->header_length;
+    cursor.Copy(rp->header_length, header);
+    cursor.Take(frame_sizes[i] - rp->header_length, &iovecs);
+    iovec_offsets[i + 1] = iovecs.size();
+    size_t data_length = frame_sizes[i] - frame_overhead;
+    frames[i].header = {header, rp->header_length};
+    frames[i].unprotected_data = {data_start, data_length};
+    data_start += data_length;
+  }
+  // iovecs is fully populated, so pointers into it are now stable.
+  for (size_t i = 0; i < num_frames; ++i) {
+    frames[i].protected_vec = iovecs.data() + iovec_offsets[i];
+    frames[i].protected_vec_length = iovec_offsets[i + 1] - iovec_offsets[i];
+  }
+  // Calls alts_iovec_record_protocol unprotect batch.
+  char* error_details = nullptr;
+  grpc_status_code status =
+      alts_iovec_record_protocol_privacy_integrity_unprotect_batch(
+          rp->iovec_rp, frames.data(), frames.size(), &error_details);
+  if (status != GRPC_STATUS_OK) {
+    LOG(ERROR) << "Failed to unprotect, " << error_details;
+    gpr_free(error_details);
+    grpc_core::CSliceUnref(unprotected_slice);
+    return TSI_INTERNAL_ERROR;
+  }
+  grpc_slice_buffer_reset_and_unref(protected_slices);
+  grpc_slice_buffer_add(unprotected_slices, unprotected_slice);
+  return TSI_OK;
+}
+
 static const alts_grpc_record_protocol_vtable
     alts_grpc_privacy_integrity_record_protocol_vtable = {
         alts_grpc_privacy_integrity_protect,
-        alts_grpc_privacy_integrity_unprotect, nullptr};
+        alts_grpc_privacy_integrity_unprotect, nullptr,
+        alts_grpc_privacy_integrity_protect_batch,
+        alts_grpc_privacy_integrity_unprotect_batch};
 
 tsi_result alts_grpc_privacy_integrity_record_protocol_create(
     gsec_aead_crypter* crypter, size_t overflow_size, bool is_client,
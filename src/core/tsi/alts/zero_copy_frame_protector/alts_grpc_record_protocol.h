@@ -68,6 +68,52 @@ tsi_result alts_grpc_record_protocol_unprotect(
     alts_grpc_record_protocol* self, grpc_slice_buffer* protected_slices,
     grpc_slice_buffer* unprotected_slices);
 
+///
+/// This methods performs protect operation on an arbitrary amount of
+/// unprotected data, splitting it into frames of at most
+/// max_unprotected_data_size bytes each, and appends all protected frames to
+/// protected_slices as a single contiguous buffer. The frames are identical to
+/// the ones produced by calling alts_grpc_record_protocol_protect on each
+/// chunk, but are sealed in one batch. The input unprotected data slice buffer
+/// will be cleared, although the actual unprotected data bytes are not
+/// modified.
+///
+///- self: an alts_grpc_record_protocol instance.
+///- unprotected_slices: the unprotected data to be protected.
+///- max_unprotected_data_size: maximum unprotected data size of each frame.
+///- protected_slices: slice buffer where the protected frames are appended.
+///
+/// This method returns TSI_OK in case of success, TSI_UNIMPLEMENTED if the
+/// instance does not support batching, or a specific error code in case of
+/// failure.
+///
+tsi_result alts_grpc_record_protocol_protect_batch(
+    alts_grpc_record_protocol* self, grpc_slice_buffer* unprotected_slices,
+    size_t max_unprotected_data_size, grpc_slice_buffer* protected_slices);
+
+///
+/// This methods performs unprotect operation on a sequence of full frames of
+/// protected data and appends the unprotected data of all frames to
+/// unprotected_slices as a single contiguous buffer. It is the caller's
+/// responsibility to prepare the full frames and their sizes before calling
+/// this method. The input protected frame slice buffer will be cleared,
+/// although the actual protected data bytes are not modified.
+///
+///- self: an alts_grpc_record_protocol instance.
+///- protected_slices: full frames of protected data in grpc slices.
+///- frame_sizes: the total size of each frame in protected_slices, in order.
+///- num_frames: the array length of frame_sizes.
+///- unprotected_slices: slice buffer where unprotected data is appended.
+///
+/// This method returns TSI_OK in case of success, TSI_UNIMPLEMENTED if the
+/// instance does not support batching, or a specific error code in case of
+/// failure.
+///
+tsi_result alts_grpc_record_protocol_unprotect_batch(
+    alts_grpc_record_protocol* self, grpc_slice_buffer* protected_slices,
+    const uint32_t* frame_sizes, size_t num_frames,
+    grpc_slice_buffer* unprotected_slices);
+
 ///
 /// This method returns maximum allowed unprotected data size, given maximum
 /// protected frame size.
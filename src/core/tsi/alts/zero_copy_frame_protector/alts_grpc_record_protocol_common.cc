@@ -149,6 +149,38 @@ tsi_result alts_grpc_record_protocol_unprotect(
   return self->vtable->unprotect(self, protected_slices, unprotected_slices);
 }
 
+tsi_result alts_grpc_record_protocol_protect_batch(
+    alts_grpc_record_protocol* self, grpc_slice_buffer* unprotected_slices,
+    size_t max_unprotected_data_size, grpc_slice_buffer* protected_slices) {
+  if (self == nullptr || self->vtable == nullptr ||
+      unprotected_slices == nullptr || protected_slices == nullptr ||
+      max_unprotected_data_size == 0) {
+    return TSI_INVALID_ARGUMENT;
+  }
+  if (self->vtable->protect_batch == nullptr) {
+    return TSI_UNIMPLEMENTED;
+  }
+  return self->vtable->protect_batch(self, unprotected_slices,
+                                     max_unprotected_data_size,
+                                     protected_slices);
+}
+
+tsi_result alts_grpc_record_protocol_unprotect_batch(
+    alts_grpc_record_protocol* self, grpc_slice_buffer* protected_slices,
+    const uint32_t* frame_sizes, size_t num_frames,
+    grpc_slice_buffer* unprotected_slices) {
+  if (self == nullptr || self->vtable == nullptr ||
+      protected_slices == nullptr || unprotected_slices == nullptr ||
+      (frame_sizes == nullptr && num_frames != 0)) {
+    return TSI_INVALID_ARGUMENT;
+  }
+  if (self->vtable->unprotect_batch == nullptr) {
+    return TSI_UNIMPLEMENTED;
+  }
+  return self->vtable->unprotect_batch(self, protected_slices, frame_sizes,
+                                       num_frames, unprotected_slices);
+}
+
 void alts_grpc_record_protocol_destroy(alts_grpc_record_protocol* self) {
   if (self == nullptr) {
     return;
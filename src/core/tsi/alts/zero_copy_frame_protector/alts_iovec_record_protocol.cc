@@ -286,11 +286,10 @@ grpc_status_code alts_iovec_record_protocol_integrity_only_unprotect(
   return increment_counter(rp->ctr, error_details);
 }
 
-grpc_status_code alts_iovec_record_protocol_privacy_integrity_protect(
-    alts_iovec_record_protocol* rp, const iovec_t* unprotected_vec,
-    size_t unprotected_vec_length, iovec_t protected_frame,
+// Ensures rp can be used for privacy-integrity protect or unprotect operations.
+static grpc_status_code ensure_privacy_integrity_operation(
+    const alts_iovec_record_protocol* rp, bool is_protect,
     char** error_details) {
-  // Input sanity checks.
   if (rp == nullptr) {
     maybe_copy_error_msg("Input iovec_record_protocol is nullptr.",
                          error_details);
@@ -302,15 +301,24 @@ grpc_status_code alts_iovec_record_protocol_privacy_integrity_protect(
         error_details);
     return GRPC_STATUS_FAILED_PRECONDITION;
   }
-  if (!rp->is_protect) {
+  if (is_protect && !rp->is_protect) {
     maybe_copy_error_msg("Protect operations are not allowed for this object.",
                          error_details);
     return GRPC_STATUS_FAILED_PRECONDITION;
   }
-  // Unprotected data should not be zero length.
-  size_t data_length =
-      get_total_length(unprotected_vec, unprotected_vec_length);
-  // Ensures protected frame iovec has sufficient size.
+  if (!is_protect && rp->is_protect) {
+    maybe_copy_error_msg(
+        "Unprotect operations are not allowed for this object.", error_details);
+    return GRPC_STATUS_FAILED_PRECONDITION;
+  }
+  return GRPC_STATUS_OK;
+}
+
+// Ensures protected frame iovec has sufficient size for the given unprotected
+// data length.
+static grpc_status_code ensure_protected_frame_length(
+    const alts_iovec_record_protocol* rp, size_t data_length,
+    iovec_t protected_frame, char** error_details) {
   if (protected_frame.iov_base == nullptr) {
     maybe_copy_error_msg("Protected frame is nullptr.", error_details);
     return GRPC_STATUS_INVALID_ARGUMENT;
@@ -321,6 +329,15 @@ grpc_status_code alts_iovec_record_protocol_privacy_integrity_protect(
     maybe_copy_error_msg("Protected frame size is incorrect.", error_details);
     return GRPC_STATUS_INVALID_ARGUMENT;
   }
+  return GRPC_STATUS_OK;
+}
+
+// Writes the frame header and seals a frame whose size has been validated.
+static grpc_status_code seal_frame(alts_iovec_record_protocol* rp,
+                                   const iovec_t* unprotected_vec,
+                                   size_t unprotected_vec_length,
+                                   size_t data_length, iovec_t protected_frame,
+                                   char** error_details) {
   // Writer frame header.
   grpc_status_code status = write_frame_header(
       data_length + rp->tag_length,
@@ -352,30 +369,13 @@ grpc_status_code alts_iovec_record_protocol_privacy_integrity_protect(
   return increment_counter(rp->ctr, error_details);
 }
 
-grpc_status_code alts_iovec_record_protocol_privacy_integrity_unprotect(
-    alts_iovec_record_protocol* rp, iovec_t header,
-    const iovec_t* protected_vec, size_t protected_vec_length,
-    iovec_t unprotected_data, char** error_details) {
-  // Input sanity checks.
-  if (rp == nullptr) {
-    maybe_copy_error_msg("Input iovec_record_protocol is nullptr.",
-                         error_details);
-    return GRPC_STATUS_INVALID_ARGUMENT;
-  }
-  if (rp->is_integrity_only) {
-    maybe_copy_error_msg(
-        "Privacy-integrity operations are not allowed for this object.",
-        error_details);
-    return GRPC_STATUS_FAILED_PRECONDITION;
-  }
-  if (rp->is_protect) {
-    maybe_copy_error_msg(
-        "Unprotect operations are not allowed for this object.", error_details);
-    return GRPC_STATUS_FAILED_PRECONDITION;
-  }
+// Ensures the header and unprotected data iovecs of a frame are consistent with
+// its protected data length, and verifies the frame header.
+static grpc_status_code ensure_unprotect_frame(
+    const alts_iovec_record_protocol* rp, iovec_t header,
+    size_t protected_data_length, iovec_t unprotected_data,
+    char** error_details) {
   // Protected data size should be no less than tag size.
-  size_t protected_data_length =
-      get_total_length(protected_vec, protected_vec_length);
   if (protected_data_length < rp->tag_length) {
     maybe_copy_error_msg(
         "Protected data length should be more than the tag length.",
@@ -397,15 +397,21 @@ grpc_status_code alts_iovec_record_protocol_privacy_integrity_unprotect(
     return GRPC_STATUS_INVALID_ARGUMENT;
   }
   // Verify frame header.
-  grpc_status_code status = verify_frame_header(
-      protected_data_length, static_cast<unsigned char*>(header.iov_base),
-      error_details);
-  if (status != GRPC_STATUS_OK) {
-    return status;
-  }
+  return verify_frame_header(protected_data_length,
+                             static_cast<unsigned char*>(header.iov_base),
+                             error_details);
+}
+
+// Decrypts a frame whose header has been verified.
+static grpc_status_code open_frame(alts_iovec_record_protocol* rp,
+                                   const iovec_t* protected_vec,
+                                   size_t protected_vec_length,
+                                   size_t protected_data_length,
+                                   iovec_t unprotected_data,
+                                   char** error_details) {
   // Decrypt protected data by calling AEAD crypter.
   size_t bytes_written = 0;
-  status = gsec_aead_crypter_decrypt_iovec(
+  grpc_status_code status = gsec_aead_crypter_decrypt_iovec(
       rp->crypter, alts_counter_get_counter(rp->ctr),
       alts_counter_get_size(rp->ctr), /* aad_vec = */ nullptr,
       /* aad_vec_length = */ 0, protected_vec, protected_vec_length,
@@ -424,6 +430,130 @@ grpc_status_code alts_iovec_record_protocol_privacy_integrity_unprotect(
   return increment_counter(rp->ctr, error_details);
 }
 
+grpc_status_code alts_iovec_record_protocol_privacy_integrity_protect(
+    alts_iovec_record_protocol* rp, const iovec_t* unprotected_vec,
+    size_t unprotected_vec_length, iovec_t protected_frame,
+    char** error_details) {
+  // Input sanity checks.
+  grpc_status_code status = ensure_privacy_integrity_operation(
+      rp, /*is_protect=*/true, error_details);
+  if (status != GRPC_STATUS_OK) {
+    return status;
+  }
+  // Unprotected data should not be zero length.
+  size_t data_length =
+      get_total_length(unprotected_vec, unprotected_vec_length);
+  // Ensures protected frame iovec has sufficient size.
+  status = ensure_protected_frame_length(rp, data_length, protected_frame,
+                                         error_details);
+  if (status != GRPC_STATUS_OK) {
+    return status;
+  }
+  return seal_frame(rp, unprotected_vec, unprotected_vec_length, data_length,
+                    protected_frame, error_details);
+}
+
+grpc_status_code alts_iovec_record_protocol_privacy_integrity_unprotect(
+    alts_iovec_record_protocol* rp, iovec_t header,
+    const iovec_t* protected_vec, size_t protected_vec_length,
+    iovec_t unprotected_data, char** error_details) {
+  // Input sanity checks.
+  grpc_status_code status = ensure_privacy_integrity_operation(
+      rp, /*is_protect=*/false, error_details);
+  if (status != GRPC_STATUS_OK) {
+    return status;
+  }
+  size_t protected_data_length =
+      get_total_length(protected_vec, protected_vec_length);
+  status = ensure_unprotect_frame(rp, header, protected_data_length,
+                                  unprotected_data, error_details);
+  if (status != GRPC_STATUS_OK) {
+    return status;
+  }
+  return open_frame(rp, protected_vec, protected_vec_length,
+                    protected_data_length, unprotected_data, error_details);
+}
+
+grpc_status_code alts_iovec_record_protocol_privacy_integrity_protect_batch(
+    alts_iovec_record_protocol* rp,
+    const alts_iovec_record_protocol_protect_frame* frames, size_t num_frames,
+    char** error_details) {
+  // Input sanity checks.
+  grpc_status_code status = ensure_privacy_integrity_operation(
+      rp, /*is_protect=*/true, error_details);
+  if (status != GRPC_STATUS_OK) {
+    return status;
+  }
+  if (frames == nullptr && num_frames != 0) {
+    maybe_copy_error_msg("Frames is nullptr.", error_details);
+    return GRPC_STATUS_INVALID_ARGUMENT;
+  }
+  // Validates every frame up front so that a malformed batch is rejected
+  // before any counter value is consumed.
+  for (size_t i = 0; i < num_frames; ++i) {
+    status = ensure_protected_frame_length(
+        rp,
+        get_total_length(frames[i].unprotected_vec,
+                         frames[i].unprotected_vec_length),
+        frames[i].protected_frame, error_details);
+    if (status != GRPC_STATUS_OK) {
+      return status;
+    }
+  }
+  for (size_t i = 0; i < num_frames; ++i) {
+    // Frame sizes were validated above, so the data length can be derived
+    // from the protected frame without walking the iovecs again.
+    size_t data_length = frames[i].protected_frame.iov_len -
+                         alts_iovec_record_protocol_get_header_length() -
+                         rp->tag_length;
+    status = seal_frame(rp, frames[i].unprotected_vec,
+                        frames[i].unprotected_vec_length, data_length,
+                        frames[i].protected_frame, error_details);
+    if (status != GRPC_STATUS_OK) {
+      return status;
+    }
+  }
+  return GRPC_STATUS_OK;
+}
+
+grpc_status_code alts_iovec_record_protocol_privacy_integrity_unprotect_batch(
+    alts_iovec_record_protocol* rp,
+    const alts_iovec_record_protocol_unprotect_frame* frames,
+    size_t num_frames, char** error_details) {
+  // Input sanity checks.
+  grpc_status_code status = ensure_privacy_integrity_operation(
+      rp, /*is_protect=*/false, error_details);
+  if (status != GRPC_STATUS_OK) {
+    return status;
+  }
+  if (frames == nullptr && num_frames != 0) {
+    maybe_copy_error_msg("Frames is nullptr.", error_details);
+    return GRPC_STATUS_INVALID_ARGUMENT;
+  }
+  // Verifies every frame header up front so that a corrupted batch is
+  // rejected without spending any time on decryption.
+  for (size_t i = 0; i < num_frames; ++i) {
+    status = ensure_unprotect_frame(
+        rp, frames[i].header,
+        get_total_length(frames[i].protected_vec,
+                         frames[i].protected_vec_length),
+        frames[i].unprotected_data, error_details);
+    if (status != GRPC_STATUS_OK) {
+      return status;
+    }
+  }
+  for (size_t i = 0; i < num_frames; ++i) {
+    status = open_frame(rp, frames[i].protected_vec,
+                        frames[i].protected_vec_length,
+                        frames[i].unprotected_data.iov_len + rp->tag_length,
+                        frames[i].unprotected_data, error_details);
+    if (status != GRPC_STATUS_OK) {
+      return status;
+    }
+  }
+  return GRPC_STATUS_OK;
+}
+
 grpc_status_code alts_iovec_record_protocol_create(
     gsec_aead_crypter* crypter, size_t overflow_size, bool is_client,
     bool is_integrity_only, bool is_protect, alts_iovec_record_protocol** rp,
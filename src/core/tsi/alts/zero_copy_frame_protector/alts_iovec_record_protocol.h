@@ -158,6 +158,74 @@ grpc_status_code alts_iovec_record_protocol_privacy_integrity_unprotect(
     const iovec_t* protected_vec, size_t protected_vec_length,
     iovec_t unprotected_data, char** error_details);
 
+// A single frame of a batched privacy-integrity protect operation. The fields
+// have the same meaning as the corresponding arguments of
+// alts_iovec_record_protocol_privacy_integrity_protect.
+typedef struct alts_iovec_record_protocol_protect_frame {
+  const iovec_t* unprotected_vec;
+  size_t unprotected_vec_length;
+  iovec_t protected_frame;
+} alts_iovec_record_protocol_protect_frame;
+
+// A single frame of a batched privacy-integrity unprotect operation. The
+// fields have the same meaning as the corresponding arguments of
+// alts_iovec_record_protocol_privacy_integrity_unprotect.
+typedef struct alts_iovec_record_protocol_unprotect_frame {
+  iovec_t header;
+  const iovec_t* protected_vec;
+  size_t protected_vec_length;
+  iovec_t unprotected_data;
+} alts_iovec_record_protocol_unprotect_frame;
+
+///
+/// This method performs privacy-integrity protect operation on a batch of
+/// frames, which is equivalent to calling
+/// alts_iovec_record_protocol_privacy_integrity_protect on each frame in
+/// order. All frames are validated before any of them is sealed, and frames
+/// are then sealed back-to-back on the same crypter so that the per-frame
+/// setup cost is paid once per batch. The caller needs to allocate the memory
+/// for every protected frame prior to calling this method.
+///
+///- rp: an alts_iovec_record_protocol instance.
+///- frames: an array of frames to be protected.
+///- num_frames: the array length of frames.
+///- error_details: a buffer containing an error message if the method does not
+///  function correctly. It is OK to pass nullptr into error_details.
+///
+/// On success, the method returns GRPC_STATUS_OK. Otherwise, it returns an
+/// error status code along with its details specified in error_details (if
+/// error_details is not nullptr). If sealing fails part way through the batch,
+/// the frames preceding the failed one have consumed their counter values and
+/// the instance should not be used any further.
+///
+grpc_status_code alts_iovec_record_protocol_privacy_integrity_protect_batch(
+    alts_iovec_record_protocol* rp,
+    const alts_iovec_record_protocol_protect_frame* frames, size_t num_frames,
+    char** error_details);
+
+///
+/// This method performs privacy-integrity unprotect operation on a batch of
+/// full protected frames, which is equivalent to calling
+/// alts_iovec_record_protocol_privacy_integrity_unprotect on each frame in
+/// order. All frame headers are verified before any frame is decrypted. The
+/// caller needs to allocate the memory for the unprotected data of every frame
+/// prior to calling this method.
+///
+///- rp: an alts_iovec_record_protocol instance.
+///- frames: an array of frames to be unprotected.
+///- num_frames: the array length of frames.
+///- error_details: a buffer containing an error message if the method does not
+///  function correctly. It is OK to pass nullptr into error_details.
+///
+/// On success, the method returns GRPC_STATUS_OK. Otherwise, it returns an
+/// error status code along with its details specified in error_details (if
+/// error_details is not nullptr).
+///
+grpc_status_code alts_iovec_record_protocol_privacy_integrity_unprotect_batch(
+    alts_iovec_record_protocol* rp,
+    const alts_iovec_record_protocol_unprotect_frame* frames,
+    size_t num_frames, char** error_details);
+
 ///
 /// This method creates an alts_iovec_record_protocol instance, given a
 /// gsec_aead_crypter instance, a flag indicating if the created instance will
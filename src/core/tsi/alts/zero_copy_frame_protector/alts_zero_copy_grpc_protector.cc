@@ -32,6 +32,7 @@
 #include "src/core/tsi/alts/zero_copy_frame_protector/alts_iovec_record_protocol.h"
 #include "src/core/tsi/transport_security_grpc.h"
 #include "src/core/util/grpc_check.h"
+#include "absl/container/inlined_vector.h"
 #include "absl/log/log.h"
 
 constexpr size_t kMinFrameLength = 1024;
@@ -42,8 +43,10 @@ constexpr size_t kMaxFrameLength = 16 * 1024 * 1024;
 /// Main struct for alts_zero_copy_grpc_protector.
 /// We choose to have two alts_grpc_record_protocol objects and two sets of
 /// slice buffers: one for protect and the other for unprotect, so that protect
-/// and unprotect can be executed in parallel. Implementations of this object
-/// must be thread compatible.
+/// and unprotect can be executed in parallel. In privacy-integrity mode, all
+/// frames produced or consumed by a single protect or unprotect call are
+/// processed as one batch. Implementations of this object must be thread
+/// compatible.
 ///
 typedef struct alts_zero_copy_grpc_protector {
   tsi_zero_copy_grpc_protector base;
@@ -55,6 +58,7 @@ typedef struct alts_zero_copy_grpc_protector {
   grpc_slice_buffer protected_sb;
   grpc_slice_buffer protected_staging_sb;
   uint32_t parsed_frame_size;
+  bool use_batch;
 } alts_zero_copy_grpc_protector;
 
 ///
@@ -156,6 +160,11 @@ static tsi_result alts_zero_copy_grpc_protector_protect(
   }
   alts_zero_copy_grpc_protector* protector =
       reinterpret_cast<alts_zero_copy_grpc_protector*>(self);
+  if (protector->use_batch) {
+    return alts_grpc_record_protocol_protect_batch(
+        protector->record_protocol, unprotected_slices,
+        protector->max_unprotected_data_size, protected_slices);
+  }
   // Calls alts_grpc_record_protocol protect repeatedly.
   while (unprotected_slices->length > protector->max_unprotected_data_size) {
     grpc_slice_buffer_move_first(unprotected_slices,
@@ -183,6 +192,8 @@ static tsi_result alts_zero_copy_grpc_protector_unprotect(
   alts_zero_copy_grpc_protector* protector =
       reinterpret_cast<alts_zero_copy_grpc_protector*>(self);
   grpc_slice_buffer_move_into(protected_slices, &protector->protected_sb);
+  // Sizes of the complete frames staged for batch unprotect.
+  absl::InlinedVector<uint32_t, 8> batch_frame_sizes;
   // Keep unprotecting each frame if possible.
   while (protector->protected_sb.length >= kZeroCopyFrameLengthFieldSize) {
     if (protector->parsed_frame_size == 0) {
@@ -190,11 +201,21 @@ static tsi_result alts_zero_copy_grpc_protector_unprotect(
       if (!read_frame_size(&protector->protected_sb,
                            &protector->parsed_frame_size)) {
         grpc_slice_buffer_reset_and_unref(&protector->protected_sb);
+        grpc_slice_buffer_reset_and_unref(&protector->protected_staging_sb);
         return TSI_DATA_CORRUPTED;
       }
     }
     if (protector->protected_sb.length < protector->parsed_frame_size) break;
     // At this point, protected_sb contains at least one frame of data.
+    if (protector->use_batch) {
+      // Stages the frame; all complete frames are unprotected together below.
+      grpc_slice_buffer_move_first(&protector->protected_sb,
+                                   protector->parsed_frame_size,
+                                   &protector->protected_staging_sb);
+      batch_frame_sizes.push_back(protector->parsed_frame_size);
+      protector->parsed_frame_size = 0;
+      continue;
+    }
     tsi_result status;
     if (protector->protected_sb.length == protector->parsed_frame_size) {
       status = alts_grpc_record_protocol_unprotect(protector->unrecord_protocol,
@@ -214,6 +235,16 @@ static tsi_result alts_zero_copy_grpc_protector_unprotect(
       return status;
     }
   }
+  if (!batch_frame_sizes.empty()) {
+    tsi_result status = alts_grpc_record_protocol_unprotect_batch(
+        protector->unrecord_protocol, &protector->protected_staging_sb,
+        batch_frame_sizes.data(), batch_frame_sizes.size(), unprotected_slices);
+    if (status != TSI_OK) {
+      grpc_slice_buffer_reset_and_unref(&protector->protected_sb);
+      grpc_slice_buffer_reset_and_unref(&protector->protected_staging_sb);
+      return status;
+    }
+  }
   if (min_progress_size != nullptr) {
     if (protector->parsed_frame_size > kZeroCopyFrameLengthFieldSize) {
       *min_progress_size =
@@ -319,6 +350,7 @@ tsi_result alts_zero_copy_grpc_protector_create(
       grpc_slice_buffer_init(&impl->protected_sb);
       grpc_slice_buffer_init(&impl->protected_staging_sb);
       impl->parsed_frame_size = 0;
+      impl->use_batch = !is_integrity_only;
       impl->base.vtable = &alts_zero_copy_grpc_protector_vtable;
       *protector = &impl->base;
       return TSI_OK;
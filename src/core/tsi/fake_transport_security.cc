@@ -618,6 +618,7 @@ static const tsi_handshaker_result_vtable handshaker_result_vtable = {
     fake_handshaker_result_create_zero_copy_grpc_protector,
     fake_handshaker_result_create_frame_protector,
     fake_handshaker_result_get_unused_bytes,
+    nullptr,  // fake_handshaker_result_install_kernel_tls
     fake_handshaker_result_destroy,
 };
 
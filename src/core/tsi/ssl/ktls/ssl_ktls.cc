@@ -0,0 +1,361 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/tsi/ssl/ktls/ssl_ktls.h"
+
+#include <grpc/support/port_platform.h>
+
+#include <string>
+
+#include "absl/status/status.h"
+#include "absl/strings/string_view.h"
+
+#ifdef TSI_SSL_KTLS_SUPPORTED
+
+#include <errno.h>
+#include <linux/tls.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <openssl/bio.h>
+#include <openssl/crypto.h>
+#include <openssl/hkdf.h>
+#include <string.h>
+#include <sys/socket.h>
+
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include "absl/strings/escaping.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/str_split.h"
+
+#ifndef SOL_TLS
+#define SOL_TLS 282
+#endif
+#ifndef TCP_ULP
+#define TCP_ULP 31
+#endif
+
+namespace tsi {
+
+namespace {
+
+constexpr absl::string_view kClientTrafficSecretLabel =
+    "CLIENT_TRAFFIC_SECRET_0";
+constexpr absl::string_view kServerTrafficSecretLabel =
+    "SERVER_TRAFFIC_SECRET_0";
+constexpr size_t kTlsRecordHeaderSize = 5;
+constexpr size_t kTls13IvSize = 12;
+constexpr size_t kMaxKeySize = 32;
+
+struct CapturedSecrets {
+  ~CapturedSecrets() {
+    OPENSSL_cleanse(client_traffic_secret.data(),
+                    client_traffic_secret.size());
+    OPENSSL_cleanse(server_traffic_secret.data(),
+                    server_traffic_secret.size());
+  }
+
+  std::string client_traffic_secret;
+  std::string server_traffic_secret;
+};
+
+void FreeCapturedSecrets(void* /*parent*/, void* ptr, CRYPTO_EX_DATA* /*ad*/,
+                         int /*index*/, long /*argl*/, void* /*argp*/) {
+  delete static_cast<CapturedSecrets*>(ptr);
+}
+
+int CapturedSecretsIndex() {
+  static const int index = SSL_get_ex_new_index(0, nullptr, nullptr, nullptr,
+                                                FreeCapturedSecrets);
+  return index;
+}
+
+// Traffic key and IV for one direction of a connection.
+struct TrafficKeys {
+  ~TrafficKeys() {
+    OPENSSL_cleanse(key, sizeof(key));
+    OPENSSL_cleanse(iv, sizeof(iv));
+  }
+
+  uint8_t key[kMaxKeySize];
+  uint8_t iv[kTls13IvSize];
+};
+
+struct KtlsCipher {
+  uint16_t kernel_cipher_type;
+  size_t key_size;
+};
+
+std::optional<KtlsCipher> KtlsCipherFor(const SSL_CIPHER* cipher) {
+  switch (SSL_CIPHER_get_protocol_id(cipher)) {
+    case TLS1_3_CK_AES_128_GCM_SHA256 & 0xffff:
+      return KtlsCipher{TLS_CIPHER_AES_GCM_128,
+                        TLS_CIPHER_AES_GCM_128_KEY_SIZE};
+    case TLS1_3_CK_AES_256_GCM_SHA384 & 0xffff:
+      return KtlsCipher{TLS_CIPHER_AES_GCM_256,
+                        TLS_CIPHER_AES_GCM_256_KEY_SIZE};
+#ifdef TLS_CIPHER_CHACHA20_POLY1305
+    case TLS1_3_CK_CHACHA20_POLY1305_SHA256 & 0xffff:
+      return KtlsCipher{TLS_CIPHER_CHACHA20_POLY1305,
+                        TLS_CIPHER_CHACHA20_POLY1305_KEY_SIZE};
+#endif
+    default:
+      return std::nullopt;
+  }
+}
+
+bool DeriveTrafficKeys(const EVP_MD* digest, absl::string_view secret,
+                       const KtlsCipher& cipher, TrafficKeys* keys) {
+  return internal::SslKtlsDeriveTrafficKeys(digest, secret, cipher.key_size,
+                                            keys->key, keys->iv);
+}
+
+template <typename CryptoInfo>
+bool SetKernelKeys(int fd, int direction, uint16_t kernel_cipher_type,
+                   const TrafficKeys& keys, uint64_t sequence) {
+  static_assert(sizeof(CryptoInfo::salt) + sizeof(CryptoInfo::iv) ==
+                kTls13IvSize);
+  CryptoInfo info;
+  memset(&info, 0, sizeof(info));
+  info.info.version = TLS_1_3_VERSION;
+  info.info.cipher_type = kernel_cipher_type;
+  memcpy(info.key, keys.key, sizeof(info.key));
+  memcpy(info.salt, keys.iv, sizeof(info.salt));
+  memcpy(info.iv, keys.iv + sizeof(info.salt), sizeof(info.iv));
+  // The kernel expects the next record sequence number in network order.
+  for (size_t i = 0; i < sizeof(info.rec_seq); ++i) {
+    info.rec_seq[sizeof(info.rec_seq) - 1 - i] =
+        static_cast<unsigned char>(sequence >> (8 * i));
+  }
+  const bool ok = setsockopt(fd, SOL_TLS, direction, &info, sizeof(info)) == 0;
+  OPENSSL_cleanse(&info, sizeof(info));
+  return ok;
+}
+
+bool SetKernelKeys(int fd, int direction, const KtlsCipher& cipher,
+                   const TrafficKeys& keys, uint64_t sequence) {
+  switch (cipher.kernel_cipher_type) {
+    case TLS_CIPHER_AES_GCM_128:
+      return SetKernelKeys<tls12_crypto_info_aes_gcm_128>(
+          fd, direction, cipher.kernel_cipher_type, keys, sequence);
+    case TLS_CIPHER_AES_GCM_256:
+      return SetKernelKeys<tls12_crypto_info_aes_gcm_256>(
+          fd, direction, cipher.kernel_cipher_type, keys, sequence);
+#ifdef TLS_CIPHER_CHACHA20_POLY1305
+    case TLS_CIPHER_CHACHA20_POLY1305:
+      return SetKernelKeys<tls12_crypto_info_chacha20_poly1305>(
+          fd, direction, cipher.kernel_cipher_type, keys, sequence);
+#endif
+    default:
+      return false;
+  }
+}
+
+// The kernel only accepts records from the start of their header, so bytes
+// that were read past the handshake can only be decrypted in user space if
+// they end exactly on a record boundary.
+bool EndsOnRecordBoundary(absl::string_view bytes) {
+  while (!bytes.empty()) {
+    if (bytes.size() < kTlsRecordHeaderSize) return false;
+    const size_t record_size =
+        kTlsRecordHeaderSize + ((static_cast<uint8_t>(bytes[3]) << 8) |
+                                static_cast<uint8_t>(bytes[4]));
+    if (bytes.size() < record_size) return false;
+    bytes.remove_prefix(record_size);
+  }
+  return true;
+}
+
+absl::Status DecryptPendingRecords(SSL* ssl, BIO* network_io,
+                                   absl::string_view ciphertext,
+                                   std::string* plaintext) {
+  char buffer[4096];
+  while (!ciphertext.empty()) {
+    const int written =
+        BIO_write(network_io, ciphertext.data(),
+                  static_cast<int>(std::min<size_t>(ciphertext.size(),
+                                                    INT_MAX)));
+    if (written <= 0) {
+      return absl::InternalError("Could not feed pending bytes to the BIO.");
+    }
+    ciphertext.remove_prefix(written);
+    while (true) {
+      const int read = SSL_read(ssl, buffer, sizeof(buffer));
+      if (read > 0) {
+        plaintext->append(buffer, read);
+        continue;
+      }
+      const int ssl_error = SSL_get_error(ssl, read);
+      if (ssl_error == SSL_ERROR_WANT_READ) break;
+      return absl::InternalError(
+          absl::StrCat("SSL_read of pending bytes failed with error ",
+                       SSL_error_description(ssl_error)));
+    }
+  }
+  // Anything still buffered, or a reply that SSL wants to send (e.g. to a
+  // KeyUpdate), cannot be carried over to the kernel.
+  if (SSL_has_pending(ssl) || BIO_ctrl_pending(network_io) > 0) {
+    return absl::InternalError(
+        "Pending bytes left TLS state that cannot be offloaded.");
+  }
+  return absl::OkStatus();
+}
+
+}  // namespace
+
+namespace internal {
+
+bool SslKtlsExpandLabel(const EVP_MD* digest, absl::string_view secret,
+                        absl::string_view label, uint8_t* out,
+                        size_t out_len) {
+  const std::string full_label = absl::StrCat("tls13 ", label);
+  std::string info;
+  info.push_back(static_cast<char>(out_len >> 8));
+  info.push_back(static_cast<char>(out_len & 0xff));
+  info.push_back(static_cast<char>(full_label.size()));
+  info.append(full_label);
+  info.push_back(0);
+  return HKDF_expand(out, out_len, digest,
+                     reinterpret_cast<const uint8_t*>(secret.data()),
+                     secret.size(), reinterpret_cast<const uint8_t*>(info.data()),
+                     info.size()) == 1;
+}
+
+bool SslKtlsDeriveTrafficKeys(const EVP_MD* digest, absl::string_view secret,
+                              size_t key_size, uint8_t* key, uint8_t* iv) {
+  return SslKtlsExpandLabel(digest, secret, "key", key, key_size) &&
+         SslKtlsExpandLabel(digest, secret, "iv", iv, kTls13IvSize);
+}
+
+}  // namespace internal
+
+void SslKtlsCaptureSecret(const SSL* ssl, absl::string_view key_log_line) {
+  std::vector<absl::string_view> fields = absl::StrSplit(key_log_line, ' ');
+  if (fields.size() != 3) return;
+  const bool is_client_secret = fields[0] == kClientTrafficSecretLabel;
+  if (!is_client_secret && fields[0] != kServerTrafficSecretLabel) return;
+  std::string secret;
+  if (!absl::HexStringToBytes(fields[2], &secret)) return;
+  auto* secrets = static_cast<CapturedSecrets*>(
+      SSL_get_ex_data(ssl, CapturedSecretsIndex()));
+  if (secrets == nullptr) {
+    secrets = new CapturedSecrets();
+    if (!SSL_set_ex_data(const_cast<SSL*>(ssl), CapturedSecretsIndex(),
+                         secrets)) {
+      delete secrets;
+      OPENSSL_cleanse(secret.data(), secret.size());
+      return;
+    }
+  }
+  std::string& slot = is_client_secret ? secrets->client_traffic_secret
+                                       : secrets->server_traffic_secret;
+  OPENSSL_cleanse(slot.data(), slot.size());
+  slot.swap(secret);
+  OPENSSL_cleanse(secret.data(), secret.size());
+}
+
+void SslKtlsClearSecrets(SSL* ssl) {
+  auto* secrets = static_cast<CapturedSecrets*>(
+      SSL_get_ex_data(ssl, CapturedSecretsIndex()));
+  if (secrets == nullptr) return;
+  SSL_set_ex_data(ssl, CapturedSecretsIndex(), nullptr);
+  delete secrets;
+}
+
+absl::Status SslKtlsInstall(SSL* ssl, BIO* network_io, int fd,
+                            absl::string_view pending_ciphertext,
+                            std::string* pending_plaintext) {
+  if (SSL_version(ssl) != TLS1_3_VERSION) {
+    return absl::UnimplementedError("Kernel TLS offload requires TLS 1.3.");
+  }
+  const SSL_CIPHER* ssl_cipher = SSL_get_current_cipher(ssl);
+  std::optional<KtlsCipher> cipher =
+      ssl_cipher == nullptr ? std::nullopt : KtlsCipherFor(ssl_cipher);
+  if (!cipher.has_value()) {
+    return absl::UnimplementedError(
+        "Negotiated cipher is not supported by kernel TLS.");
+  }
+  const auto* secrets = static_cast<const CapturedSecrets*>(
+      SSL_get_ex_data(ssl, CapturedSecretsIndex()));
+  if (secrets == nullptr || secrets->client_traffic_secret.empty() ||
+      secrets->server_traffic_secret.empty()) {
+    return absl::UnimplementedError("Traffic secrets were not captured.");
+  }
+  if (!EndsOnRecordBoundary(pending_ciphertext)) {
+    return absl::UnimplementedError(
+        "Pending bytes do not end on a TLS record boundary.");
+  }
+  const bool is_server = SSL_is_server(ssl);
+  const EVP_MD* digest = SSL_CIPHER_get_handshake_digest(ssl_cipher);
+  TrafficKeys write_keys;
+  TrafficKeys read_keys;
+  if (!DeriveTrafficKeys(digest,
+                         is_server ? secrets->server_traffic_secret
+                                   : secrets->client_traffic_secret,
+                         *cipher, &write_keys) ||
+      !DeriveTrafficKeys(digest,
+                         is_server ? secrets->client_traffic_secret
+                                   : secrets->server_traffic_secret,
+                         *cipher, &read_keys)) {
+    return absl::UnimplementedError("Could not derive traffic keys.");
+  }
+  // Until TLS_TX is set, the TLS ULP passes data through unchanged, so the
+  // caller can still fall back to user-space record protection.
+  if (setsockopt(fd, SOL_TCP, TCP_ULP, "tls", sizeof("tls")) != 0) {
+    return absl::UnimplementedError(
+        absl::StrCat("TCP_ULP tls is not available: ", strerror(errno)));
+  }
+  if (!SetKernelKeys(fd, TLS_TX, *cipher, write_keys,
+                     SSL_get_write_sequence(ssl))) {
+    return absl::UnimplementedError(
+        absl::StrCat("Kernel rejected TLS_TX keys: ", strerror(errno)));
+  }
+  absl::Status status = DecryptPendingRecords(ssl, network_io,
+                                              pending_ciphertext,
+                                              pending_plaintext);
+  if (!status.ok()) return status;
+  if (!SetKernelKeys(fd, TLS_RX, *cipher, read_keys,
+                     SSL_get_read_sequence(ssl))) {
+    return absl::InternalError(
+        absl::StrCat("Kernel rejected TLS_RX keys: ", strerror(errno)));
+  }
+  SslKtlsClearSecrets(ssl);
+  return absl::OkStatus();
+}
+
+}  // namespace tsi
+
+#else  // TSI_SSL_KTLS_SUPPORTED
+
+namespace tsi {
+
+void SslKtlsCaptureSecret(const SSL* /*ssl*/,
+                          absl::string_view /*key_log_line*/) {}
+
+void SslKtlsClearSecrets(SSL* /*ssl*/) {}
+
+absl::Status SslKtlsInstall(SSL* /*ssl*/, BIO* /*network_io*/, int /*fd*/,
+                            absl::string_view /*pending_ciphertext*/,
+                            std::string* /*pending_plaintext*/) {
+  return absl::UnimplementedError(
+      "Kernel TLS offload is not supported on this platform.");
+}
+
+}  // namespace tsi
+
+#endif  // TSI_SSL_KTLS_SUPPORTED
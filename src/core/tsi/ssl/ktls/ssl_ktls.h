@@ -0,0 +1,82 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_TSI_SSL_KTLS_SSL_KTLS_H
+#define GRPC_SRC_CORE_TSI_SSL_KTLS_SSL_KTLS_H
+
+#include <grpc/support/port_platform.h>
+#include <openssl/ssl.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "absl/status/status.h"
+#include "absl/strings/string_view.h"
+
+// Kernel TLS offload needs the Linux TLS ULP, and BoringSSL to expose the
+// record sequence numbers of a connection.
+#if defined(GPR_LINUX) && defined(OPENSSL_IS_BORINGSSL)
+#if __has_include(<linux/tls.h>)
+#define TSI_SSL_KTLS_SUPPORTED 1
+#endif
+#endif
+
+namespace tsi {
+
+// Remembers the TLS 1.3 application traffic secret carried by `key_log_line`
+// (in the NSS key log format produced by SSL_CTX_set_keylog_callback) on
+// `ssl`, so that SslKtlsInstall() can later hand it to the kernel. Lines for
+// any other secret are ignored.
+void SslKtlsCaptureSecret(const SSL* ssl, absl::string_view key_log_line);
+
+// Wipes and drops the secrets captured for `ssl`, if any.
+void SslKtlsClearSecrets(SSL* ssl);
+
+// Moves the record protection of the established TLS 1.3 connection `ssl`
+// into the kernel for socket `fd`, so that plaintext can be written to and
+// read from `fd` directly.
+// `pending_ciphertext` holds bytes already read from the peer past the end of
+// the handshake. They are decrypted with `ssl`, whose network side is
+// `network_io`, and the resulting plaintext is appended to
+// `pending_plaintext`.
+// Returns an UNIMPLEMENTED status when the connection cannot be offloaded
+// (unsupported platform, protocol version or cipher, missing secrets, pending
+// bytes not ending on a record boundary, or a kernel without kTLS support).
+// The connection is then left as it was and the caller may keep protecting
+// records in user space. Any other error leaves the connection unusable.
+absl::Status SslKtlsInstall(SSL* ssl, BIO* network_io, int fd,
+                            absl::string_view pending_ciphertext,
+                            std::string* pending_plaintext);
+
+#ifdef TSI_SSL_KTLS_SUPPORTED
+namespace internal {
+
+// HKDF-Expand-Label from RFC 8446 section 7.1, with an empty context.
+// Exposed for testing.
+bool SslKtlsExpandLabel(const EVP_MD* digest, absl::string_view secret,
+                        absl::string_view label, uint8_t* out,
+                        size_t out_len);
+
+// Derives the `key_size` byte traffic key and the 12 byte IV from the TLS 1.3
+// traffic secret `secret`, as in RFC 8446 section 7.3. Exposed for testing.
+bool SslKtlsDeriveTrafficKeys(const EVP_MD* digest, absl::string_view secret,
+                              size_t key_size, uint8_t* key, uint8_t* iv);
+
+}  // namespace internal
+#endif  // TSI_SSL_KTLS_SUPPORTED
+
+}  // namespace tsi
+
+#endif  // GRPC_SRC_CORE_TSI_SSL_KTLS_SSL_KTLS_H
@@ -27,6 +27,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <cstdlib>
+#include <type_traits>
 #include <utility>
 #include <variant>
 #include <vector>
@@ -68,6 +69,7 @@
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/surface/init.h"
 #include "src/core/tsi/ssl/key_logging/ssl_key_logging.h"
+#include "src/core/tsi/ssl/ktls/ssl_ktls.h"
 #include "src/core/tsi/ssl/session_cache/ssl_session.h"
 #include "src/core/tsi/ssl/session_cache/ssl_session_cache.h"
 #include "src/core/tsi/ssl_telemetry_utils.h"
@@ -191,6 +193,8 @@ struct tsi_ssl_server_handshaker_factory {
 #if defined(OPENSSL_IS_BORINGSSL)
   std::shared_ptr<grpc_core::CertificateSelector> certificate_selector;
 #endif  // defined(OPENSSL_IS_BORINGSSL)
+  // Whether handshakes capture the traffic secrets for kernel TLS offload.
+  bool kernel_tls = false;
 };
 
 // Tracks the arguments for a pending call to tsi_handshaker_next().
@@ -214,6 +218,8 @@ struct tsi_ssl_handshaker_result {
   BIO* network_io;
   unsigned char* unused_bytes;
   size_t unused_bytes_size;
+  // Set once record protection has been moved into the kernel.
+  bool kernel_tls_installed;
 };
 
 struct SslHandshakeResult {
@@ -2351,9 +2357,13 @@ static tsi_result ssl_handshaker_result_extract_peer(
 }
 
 static tsi_result ssl_handshaker_result_get_frame_protector_type(
-    const tsi_handshaker_result* /*self*/,
+    const tsi_handshaker_result* self,
     tsi_frame_protector_type* frame_protector_type) {
-  *frame_protector_type = TSI_FRAME_PROTECTOR_NORMAL;
+  const tsi_ssl_handshaker_result* impl =
+      reinterpret_cast<const tsi_ssl_handshaker_result*>(self);
+  *frame_protector_type = impl->kernel_tls_installed
+                              ? TSI_FRAME_PROTECTOR_NONE
+                              : TSI_FRAME_PROTECTOR_NORMAL;
   return TSI_OK;
 }
 
@@ -2391,6 +2401,9 @@ static tsi_result ssl_handshaker_result_create_frame_protector(
     return TSI_INTERNAL_ERROR;
   }
 
+  // The frame protector never needs the traffic secrets captured for kernel
+  // TLS offload.
+  tsi::SslKtlsClearSecrets(impl->ssl);
   // Transfer ownership of ssl and network_io to the frame protector.
   protector_impl->ssl = impl->ssl;
   impl->ssl = nullptr;
@@ -2412,6 +2425,46 @@ static tsi_result ssl_handshaker_result_get_unused_bytes(
   return TSI_OK;
 }
 
+static tsi_result ssl_handshaker_result_install_kernel_tls(
+    tsi_handshaker_result* self, int fd) {
+  tsi_ssl_handshaker_result* impl =
+      reinterpret_cast<tsi_ssl_handshaker_result*>(self);
+  if (impl->ssl == nullptr || impl->kernel_tls_installed) {
+    return TSI_FAILED_PRECONDITION;
+  }
+  // A TLS 1.3 server may send NewSessionTicket (or KeyUpdate) records at any
+  // time after the handshake. The kernel would fail reads on them instead of
+  // handing them to us, so only servers offload record protection.
+  if (!SSL_is_server(impl->ssl)) return TSI_UNIMPLEMENTED;
+  std::string plaintext;
+  absl::Status status = tsi::SslKtlsInstall(
+      impl->ssl, impl->network_io, fd,
+      absl::string_view(reinterpret_cast<const char*>(impl->unused_bytes),
+                        impl->unused_bytes_size),
+      &plaintext);
+  // Whether or not the kernel took them, the secrets are not needed again.
+  tsi::SslKtlsClearSecrets(impl->ssl);
+  if (!status.ok()) {
+    if (absl::IsUnimplemented(status)) {
+      GRPC_TRACE_LOG(tsi, INFO) << "Kernel TLS offload not used: " << status;
+      return TSI_UNIMPLEMENTED;
+    }
+    LOG(ERROR) << "Kernel TLS offload failed: " << status;
+    return TSI_INTERNAL_ERROR;
+  }
+  // The unused bytes have been decrypted, so hand out the plaintext instead.
+  gpr_free(impl->unused_bytes);
+  impl->unused_bytes = nullptr;
+  impl->unused_bytes_size = plaintext.size();
+  if (!plaintext.empty()) {
+    impl->unused_bytes =
+        static_cast<unsigned char*>(gpr_malloc(plaintext.size()));
+    memcpy(impl->unused_bytes, plaintext.data(), plaintext.size());
+  }
+  impl->kernel_tls_installed = true;
+  return TSI_OK;
+}
+
 static void ssl_handshaker_result_destroy(tsi_handshaker_result* self) {
   tsi_ssl_handshaker_result* impl =
       reinterpret_cast<tsi_ssl_handshaker_result*>(self);
@@ -2427,6 +2480,7 @@ static const tsi_handshaker_result_vtable handshaker_result_vtable = {
     nullptr,  // create_zero_copy_grpc_protector
     ssl_handshaker_result_create_frame_protector,
     ssl_handshaker_result_get_unused_bytes,
+    ssl_handshaker_result_install_kernel_tls,
     ssl_handshaker_result_destroy,
 };
 
@@ -2539,6 +2593,8 @@ static SslHandshakeResult ssl_handshaker_do_handshake(tsi_ssl_handshaker* impl)
                                          err_str, verify_result_str,
                                          signer_error));
         impl->result = TSI_PROTOCOL_FAILURE;
+        // Traffic secrets captured before the failure are of no further use.
+        tsi::SslKtlsClearSecrets(impl->ssl);
         return {impl->result, ssl_result, err_code};
       }
     }
@@ -3242,13 +3298,20 @@ static int server_handshaker_factory_new_session_callback(
 }
 
 /// This callback is invoked at client or server when ssl/tls handshakes
-/// complete and keylogging is enabled.
+/// complete and keylogging is enabled. On servers with kernel TLS offload
+/// enabled, it also captures the traffic secrets for that.
 template <typename T>
 static void ssl_keylogging_callback(const SSL* ssl, const char* info) {
   SSL_CTX* ssl_context = SSL_get_SSL_CTX(ssl);
   GRPC_CHECK_NE(ssl_context, nullptr);
   void* arg = SSL_CTX_get_ex_data(ssl_context, g_ssl_ctx_ex_factory_index);
   T* factory = static_cast<T*>(arg);
+#ifdef TSI_SSL_KTLS_SUPPORTED
+  if constexpr (std::is_same_v<T, tsi_ssl_server_handshaker_factory>) {
+    if (factory->kernel_tls) tsi::SslKtlsCaptureSecret(ssl, info);
+  }
+#endif
+  if (factory->key_logger == nullptr) return;
   factory->key_logger->LogSessionKeys(ssl_context, info);
 }
 
@@ -3646,7 +3709,14 @@ tsi_result tsi_configure_server_ssl_context(
 
 #if OPENSSL_VERSION_NUMBER >= 0x10101000 && !defined(LIBRESSL_VERSION_NUMBER)
   // Register factory at index
-  if (options->key_logger != nullptr) {
+#ifdef TSI_SSL_KTLS_SUPPORTED
+  // The key log callback also captures the secrets needed for kernel TLS
+  // offload, when that is enabled.
+  const bool capture_kernel_tls_secrets = options->enable_kernel_tls;
+#else
+  const bool capture_kernel_tls_secrets = false;
+#endif
+  if (options->key_logger != nullptr || capture_kernel_tls_secrets) {
     // Need to set factory at g_ssl_ctx_ex_factory_index
     SSL_CTX_set_ex_data(ssl_context.ssl_ctx, g_ssl_ctx_ex_factory_index, impl);
     // SSL_CTX_set_keylog_callback is set here to register callback
@@ -3673,6 +3743,7 @@ tsi_result tsi_create_ssl_server_handshaker_factory_with_options(
   impl = new tsi_ssl_server_handshaker_factory();
   tsi_ssl_handshaker_factory_init(&impl->base);
   impl->base.vtable = &server_handshaker_factory_vtable;
+  impl->kernel_tls = options->enable_kernel_tls;
 
   tsi_result result = grpc_core::Match(
       options->key_cert_pairs_or_selector,
@@ -424,6 +424,12 @@ struct tsi_ssl_server_handshaker_options {
   // the handshaker, in order of preference.
   std::vector<grpc_tls_key_exchange_group> key_exchange_groups;
 
+  // If true, handshakes capture the TLS 1.3 traffic secrets, so that
+  // tsi_handshaker_result_install_kernel_tls() can move record protection
+  // into the kernel. Otherwise the secrets are never captured and kernel
+  // TLS offload is not available.
+  bool enable_kernel_tls;
+
   // TODO(gtcooke94) this ctor is not needed
   // https://github.com/grpc/grpc/pull/39708/files#r2143735662
   tsi_ssl_server_handshaker_options()
@@ -437,7 +443,8 @@ struct tsi_ssl_server_handshaker_options {
         max_tls_version(tsi_tls_version::TSI_TLS1_3),
         key_logger(nullptr),
         crl_directory(nullptr),
-        send_client_ca_list(true) {}
+        send_client_ca_list(true),
+        enable_kernel_tls(false) {}
 };
 
 // Creates a server handshaker factory.
@@ -124,6 +124,9 @@ struct tsi_handshaker_result_vtable {
   tsi_result (*get_unused_bytes)(const tsi_handshaker_result* self,
                                  const unsigned char** bytes,
                                  size_t* bytes_size);
+  // May be null if the implementation cannot move record protection into the
+  // kernel.
+  tsi_result (*install_kernel_tls)(tsi_handshaker_result* self, int fd);
   void (*destroy)(tsi_handshaker_result* self);
 };
 struct tsi_handshaker_result {
@@ -279,6 +279,17 @@ tsi_result tsi_handshaker_result_get_unused_bytes(
     const tsi_handshaker_result* self, const unsigned char** bytes,
     size_t* bytes_size);
 
+// This method moves record protection into the kernel (kTLS) of the socket
+// fd, so that the caller can read and write plaintext on it directly.
+// It must be called before any frame protector is created. On success,
+// tsi_handshaker_result_get_frame_protector_type() reports
+// TSI_FRAME_PROTECTOR_NONE and tsi_handshaker_result_get_unused_bytes()
+// returns the unused bytes already decrypted.
+// It returns TSI_UNIMPLEMENTED, leaving the result unchanged, when the
+// negotiated connection or the platform does not support kernel offload.
+tsi_result tsi_handshaker_result_install_kernel_tls(
+    tsi_handshaker_result* self, int fd);
+
 // This method releases the tsi_handshaker_handshaker object. After this method
 // is called, no other method can be called on the object.
 void tsi_handshaker_result_destroy(tsi_handshaker_result* self);
@@ -14,11 +14,14 @@
 
 #include "src/core/util/latent_see.h"
 
+#include <algorithm>
 #include <atomic>
 #include <cstdint>
 #include <cstdlib>
 #include <memory>
+#include <sstream>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "src/core/channelz/property_list.h"
@@ -88,8 +91,33 @@ namespace latent_see {
 
 namespace {
 const Duration kMaxBackoff = Duration::Milliseconds(300);
+
+Sink* GlobalSink() {
+  static Sink* sink = new Sink;
+  return sink;
+}
+
+// Serializes Collect() and starting and stopping the flight recorder, which
+// share the global sink.
+Mutex* CollectionMu() {
+  static Mutex* mu = new Mutex;
+  return mu;
+}
+
+struct FlightRecorderState {
+  Mutex mu;
+  bool running ABSL_GUARDED_BY(mu) = false;
+  absl::AnyInvocable<void(std::string)> on_slo_breach ABSL_GUARDED_BY(mu);
+};
+
+FlightRecorderState& GetFlightRecorderState() {
+  static FlightRecorderState* state = new FlightRecorderState;
+  return *state;
 }
 
+void Export(const Sink::EventDump& events, Output* output);
+}  // namespace
+
 void Appender::Enable(Sink* sink) {
   active_sink_.store(sink, std::memory_order_release);
 }
@@ -111,6 +139,10 @@ void Sink::Gather() {
                       .set_jitter(0.05)
                       .set_max_backoff(kMaxBackoff));
   while (true) {
+    if (GPR_UNLIKELY(dump_requested_.exchange(false,
+                                              std::memory_order_relaxed))) {
+      FlightRecorder::DumpForSloBreach(this);
+    }
     std::unique_ptr<Bin> bin(static_cast<Bin*>(appending_.Pop()));
     if (bin == nullptr) {
       absl::SleepFor(absl::Milliseconds(backoff.NextAttemptDelay().millis()));
@@ -135,6 +167,20 @@ std::unique_ptr<Sink::EventDump> Sink::Stop() {
   return events;
 }
 
+std::unique_ptr<Sink::EventDump> Sink::Drain() {
+  auto fresh = std::make_unique<EventDump>();
+  MutexLock lock(&mu_);
+  if (events_ == nullptr) return fresh;
+  return std::exchange(events_, std::move(fresh));
+}
+
+std::unique_ptr<Sink::EventDump> Sink::Snapshot(size_t max_bins) {
+  MutexLock lock(&mu_);
+  if (events_ == nullptr) return std::make_unique<EventDump>();
+  const size_t skip = events_->size() - std::min(events_->size(), max_bins);
+  return std::make_unique<EventDump>(events_->begin() + skip, events_->end());
+}
+
 void Sink::Record(std::unique_ptr<Bin> bin) {
   MutexLock lock(&mu_);
   if (events_ == nullptr) return;
@@ -145,19 +191,26 @@ void Sink::Record(std::unique_ptr<Bin> bin) {
 
 void Collect(Notification* n, absl::Duration timeout, size_t memory_limit,
              Output* output) {
-  static Sink* sink = new Sink;
-  static Mutex* mu = new Mutex;
+  Sink* sink = GlobalSink();
+  Mutex* mu = CollectionMu();
 
   // Collection phase - under a mutex to prevent multiple collections at once.
   mu->Lock();
-  // First we enable the appender and then wait for a short time to clear out
-  // any backoff
-  LOG(INFO) << "Latent-see collection enabling";
-  Appender::Enable(sink);
-  absl::SleepFor(2 * absl::Milliseconds(kMaxBackoff.millis()));
-  // Now we start the collection
-  LOG(INFO) << "Latent-see collection recording";
-  sink->Start(memory_limit / sizeof(Bin) + 1);
+  // If the flight recorder is running the sink is already recording, and we
+  // return a copy of everything it holds at the end, so that the recorder
+  // still has it for the next SLO breach. Only the newest bins that fit in
+  // memory_limit are copied.
+  const bool flight_recorder_running = FlightRecorder::IsRunning();
+  if (!flight_recorder_running) {
+    // First we enable the appender and then wait for a short time to clear
+    // out any backoff
+    LOG(INFO) << "Latent-see collection enabling";
+    Appender::Enable(sink);
+    absl::SleepFor(2 * absl::Milliseconds(kMaxBackoff.millis()));
+    // Now we start the collection
+    LOG(INFO) << "Latent-see collection recording";
+    sink->Start(memory_limit / sizeof(Bin) + 1);
+  }
   // If we got a Notification object, use that to sleep until we're notified;
   // if not just sleep.
   if (n == nullptr) {
@@ -167,18 +220,118 @@ void Collect(Notification* n, absl::Duration timeout, size_t memory_limit,
   }
   // Grab all events
   LOG(INFO) << "Latent-see collection stopping";
-  auto events = sink->Stop();
-  // Disable the sink
-  Appender::Disable();
+  std::unique_ptr<Sink::EventDump> events;
+  if (flight_recorder_running) {
+    events = sink->Snapshot(memory_limit / sizeof(Bin) + 1);
+  } else {
+    events = sink->Stop();
+    // Disable the sink
+    Appender::Disable();
+  }
   mu->Unlock();
   CHECK(events != nullptr);
   LOG(INFO) << "Latent-see collection stopped: processing " << events->size()
             << " bins";
+  Export(*events, output);
+  LOG(INFO) << "Latent-see collection complete";
+}
 
-  // Next: find the earliest timestamp
+void FlightRecorder::Start(FlightRecorderOptions options) {
+  MutexLock collection_lock(CollectionMu());
+  auto& state = GetFlightRecorderState();
+  MutexLock lock(&state.mu);
+  // Without a handler there is nothing to dump to, so skip the check.
+  latency_slo_ns_.store(options.on_slo_breach == nullptr
+                            ? std::numeric_limits<int64_t>::max()
+                            : absl::ToInt64Nanoseconds(options.latency_slo),
+                        std::memory_order_relaxed);
+  min_dump_interval_ns_.store(
+      absl::ToInt64Nanoseconds(options.min_dump_interval),
+      std::memory_order_relaxed);
+  state.on_slo_breach = std::move(options.on_slo_breach);
+  if (!state.running) {
+    state.running = true;
+    GlobalSink()->Start(options.memory_limit / sizeof(Bin) + 1);
+    Appender::Enable(GlobalSink());
+    LOG(INFO) << "Latent-see flight recorder started";
+  }
+}
+
+void FlightRecorder::Stop() {
+  MutexLock collection_lock(CollectionMu());
+  auto& state = GetFlightRecorderState();
+  MutexLock lock(&state.mu);
+  if (!state.running) return;
+  latency_slo_ns_.store(std::numeric_limits<int64_t>::max(),
+                        std::memory_order_relaxed);
+  state.running = false;
+  state.on_slo_breach = nullptr;
+  Appender::Disable();
+  GlobalSink()->Stop();
+  LOG(INFO) << "Latent-see flight recorder stopped";
+}
+
+bool FlightRecorder::IsRunning() {
+  auto& state = GetFlightRecorderState();
+  MutexLock lock(&state.mu);
+  return state.running;
+}
+
+void FlightRecorder::Dump(Output* output) {
+  std::unique_ptr<Sink::EventDump> events;
+  {
+    auto& state = GetFlightRecorderState();
+    MutexLock lock(&state.mu);
+    if (state.running) events = GlobalSink()->Drain();
+  }
+  if (events == nullptr) {
+    output->Finish();
+    return;
+  }
+  Export(*events, output);
+}
+
+void FlightRecorder::OnSloBreach() {
+  const int64_t now = absl::GetCurrentTimeNanos();
+  int64_t next_dump = next_dump_ns_.load(std::memory_order_relaxed);
+  if (now < next_dump) return;
+  // Only one of the calls that find the interval passed triggers a dump.
+  const int64_t interval =
+      min_dump_interval_ns_.load(std::memory_order_relaxed);
+  if (!next_dump_ns_.compare_exchange_strong(next_dump, now + interval,
+                                             std::memory_order_relaxed)) {
+    return;
+  }
+  // Events from the slow call itself are most likely still in this thread's
+  // bin.
+  Flush();
+  GlobalSink()->RequestDump();
+}
+
+void FlightRecorder::DumpForSloBreach(Sink* sink) {
+  auto& state = GetFlightRecorderState();
+  MutexLock lock(&state.mu);
+  if (!state.running || state.on_slo_breach == nullptr) return;
+  // Pick up the bin flushed by the thread that saw the breach.
+  while (auto* bin = static_cast<Bin*>(sink->appending_.Pop())) {
+    sink->Record(std::unique_ptr<Bin>(bin));
+  }
+  auto events = sink->Drain();
+  std::ostringstream out;
+  {
+    JsonOutput output(out);
+    Export(*events, &output);
+  }
+  state.on_slo_breach(out.str());
+}
+
+namespace {
+
+void Export(const Sink::EventDump& events, Output* output) {
+  // Find the earliest timestamp
   // We save a lot of bytes by subtracting that out
   int64_t earliest_timestamp = std::numeric_limits<int64_t>::max();
-  for (const auto& bin : *events) {
+  for (const auto& bin : events) {
     for (const auto& event : *bin) {
       // Exclude negative timestamps as they're used for event type markers
       if (event.timestamp_begin > 0) {
@@ -197,7 +350,7 @@ void Collect(Notification* n, absl::Duration timeout, size_t memory_limit,
       channelz::PropertyList().Set("actual_start_time", earliest_timestamp));
   // TODO(ctiller): Fuschia Trace Format backend
   absl::flat_hash_map<gpr_thd_id, size_t> thread_id_map;
-  for (const auto& bin : *events) {
+  for (const auto& bin : events) {
     size_t displayed_thread_id;
     auto it = thread_id_map.find(bin->thd_id);
     if (it == thread_id_map.end()) {
@@ -234,9 +387,10 @@ void Collect(Notification* n, absl::Duration timeout, size_t memory_limit,
     }
   }
   output->Finish();
-  LOG(INFO) << "Latent-see collection complete";
 }
 
+}  // namespace
+
 }  // namespace latent_see
 }  // namespace grpc_core
 #endif
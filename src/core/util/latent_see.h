@@ -24,6 +24,7 @@
 #include <cstdio>
 #include <cstdlib>
 #include <iterator>
+#include <limits>
 #include <memory>
 #include <string>
 #include <utility>
@@ -35,8 +36,10 @@
 #include "src/core/util/notification.h"
 #include "src/core/util/thd.h"
 #include "absl/container/flat_hash_map.h"
+#include "absl/functional/any_invocable.h"
 #include "absl/strings/string_view.h"
 #include "absl/time/clock.h"
+#include "absl/time/time.h"
 
 namespace grpc_core {
 namespace latent_see {
@@ -88,6 +91,21 @@ class JsonOutput final : public Output {
   const char* sep_ = "";
 };
 
+struct FlightRecorderOptions {
+  // Upper bound on the memory holding recorded events.  Once reached, the
+  // oldest events are overwritten.
+  size_t memory_limit = 1024 * 1024;
+  // A call reported to FlightRecorder::ReportLatency() taking longer than
+  // this triggers a dump to on_slo_breach.
+  absl::Duration latency_slo = absl::InfiniteDuration();
+  // Dumps triggered by SLO breaches are at least this far apart.
+  absl::Duration min_dump_interval = absl::Seconds(10);
+  // Receives dumps triggered by SLO breaches, as trace event JSON that
+  // chrome://tracing and Perfetto can load.  Called from a background
+  // thread, and must not call back into the FlightRecorder.
+  absl::AnyInvocable<void(std::string trace_json)> on_slo_breach;
+};
+
 }  // namespace latent_see
 }  // namespace grpc_core
 
@@ -225,7 +243,9 @@ void Collect(Notification* notification, absl::Duration timeout,
 
 class Sink {
  public:
-  using EventDump = std::deque<std::unique_ptr<Bin>>;
+  // Bins are immutable once recorded, so a dump can share them with the
+  // ring.
+  using EventDump = std::deque<std::shared_ptr<const Bin>>;
 
   Sink();
   ~Sink() = delete;
@@ -233,14 +253,24 @@ class Sink {
 
  private:
   friend void Collect(Notification*, absl::Duration, size_t, Output*);
+  friend class FlightRecorder;
 
   void Gather();
   void Record(std::unique_ptr<Bin> bin);
 
   void Start(size_t max_bins);
   std::unique_ptr<EventDump> Stop();
+  // Returns the events recorded so far, and keeps recording.
+  std::unique_ptr<EventDump> Drain();
+  // Like Drain(), but leaves the events in place and returns only the newest
+  // `max_bins` bins.
+  std::unique_ptr<EventDump> Snapshot(size_t max_bins);
+  void RequestDump() {
+    dump_requested_.store(true, std::memory_order_relaxed);
+  }
 
   MultiProducerSingleConsumerQueue appending_;
+  std::atomic<bool> dump_requested_{false};
   Thread gatherer_;
   Mutex mu_;
   std::unique_ptr<EventDump> events_ ABSL_GUARDED_BY(mu_);
@@ -305,6 +335,7 @@ class Appender {
 
  private:
   friend void Collect(Notification*, absl::Duration, size_t, Output*);
+  friend class FlightRecorder;
 
   static void Enable(Sink* sink);
   static void Disable();
@@ -320,6 +351,48 @@ inline void Flush() {
   appender.Flush();
 }
 
+// Always-on collection for diagnosing rare slow calls after the fact.
+//
+// While running, every thread's events are kept in a ring of bins bounded
+// by FlightRecorderOptions::memory_limit, oldest overwritten first.  Events
+// reach the ring a bin at a time, so each thread's most recent events stay
+// in its own bin until it fills or the thread calls Flush().
+//
+// Collect() while the recorder runs returns everything the ring holds, and
+// leaves it there.
+class FlightRecorder {
+ public:
+  // Starts recording, or replaces the options if already recording.
+  static void Start(FlightRecorderOptions options);
+  static void Stop();
+  static bool IsRunning();
+
+  // Writes out and clears what the ring holds.
+  static void Dump(Output* output);
+
+  // Dumps the ring to FlightRecorderOptions::on_slo_breach if latency is
+  // over the SLO.  Cheap enough to call for every call.
+  GPR_ATTRIBUTE_ALWAYS_INLINE_FUNCTION static void ReportLatency(
+      int64_t latency_ns) {
+    if (GPR_UNLIKELY(latency_ns >
+                     latency_slo_ns_.load(std::memory_order_relaxed))) {
+      OnSloBreach();
+    }
+  }
+
+ private:
+  friend class Sink;
+
+  static void OnSloBreach();
+  // Runs on the sink's gatherer thread after OnSloBreach() requested it.
+  static void DumpForSloBreach(Sink* sink);
+
+  static inline std::atomic<int64_t> latency_slo_ns_{
+      std::numeric_limits<int64_t>::max()};
+  static inline std::atomic<int64_t> min_dump_interval_ns_{0};
+  static inline std::atomic<int64_t> next_dump_ns_{0};
+};
+
 class Scope final {
  public:
   Scope(const Scope&) = delete;
@@ -524,6 +597,15 @@ struct Scope {
 inline void Collect(Notification*, absl::Duration, size_t, Output* output) {
   output->Finish();
 }
+
+class FlightRecorder {
+ public:
+  static void Start(FlightRecorderOptions) {}
+  static void Stop() {}
+  static bool IsRunning() { return false; }
+  static void Dump(Output* output) { output->Finish(); }
+  static void ReportLatency(int64_t) {}
+};
 }  // namespace latent_see
 }  // namespace grpc_core
 #define GRPC_LATENT_SEE_METADATA(name) nullptr
@@ -33,11 +33,12 @@ void RunPostMortem(std::ostream& out) {
       << StatsAsJson(global_stats().Collect().get()) << "\n";
 
   out << "❗ channelz entities:\n";
-  for (const auto& node : channelz::ChannelzRegistry::GetAllEntities()) {
-    out << "  🔴 [" << node->uuid() << ":"
-        << channelz::BaseNode::EntityTypeString(node->type())
-        << "]: " << node->RenderJsonString() << "\n";
-  }
+  channelz::ChannelzRegistry::ForEachEntity(
+      [&out](WeakRefCountedPtr<channelz::BaseNode> node) {
+        out << "  🔴 [" << node->uuid() << ":"
+            << channelz::BaseNode::EntityTypeString(node->type())
+            << "]: " << node->RenderJsonString() << "\n";
+      });
 }
 
 }  // namespace
@@ -37,6 +37,7 @@
 #include "opentelemetry/context/context.h"
 #include "opentelemetry/metrics/sync_instruments.h"
 #include "opentelemetry/trace/context.h"
+#include "opentelemetry/trace/default_span.h"
 #include "opentelemetry/trace/tracer.h"
 #include "src/core/call/metadata_batch.h"
 #include "src/core/call/status_util.h"
@@ -150,7 +151,11 @@ OpenTelemetryPluginImpl::ClientCallTracerInterface::
                /*optional_labels=*/{},
                /*is_client=*/true, parent_->otel_plugin_));
   }
-  if (parent_->otel_plugin_->tracer_ != nullptr) {
+  if (parent_->propagate_only_) {
+    span_ = parent_->span_;
+  } else if (parent_->span_ != nullptr) {
+    grpc_core::CallTraceSampler::CostScope cost(
+        parent_->otel_plugin_->trace_sampler_.get());
     std::array<std::pair<opentelemetry::nostd::string_view,
                          opentelemetry::common::AttributeValue>,
                2>
@@ -168,6 +173,8 @@ template <typename UnrefBehavior>
 OpenTelemetryPluginImpl::ClientCallTracerInterface::CallAttemptTracer<
     UnrefBehavior>::~CallAttemptTracer<UnrefBehavior>() {
   if (span_ != nullptr) {
+    grpc_core::CallTraceSampler::CostScope cost(
+        parent_->otel_plugin_->trace_sampler_.get());
     span_->End();
   }
 }
@@ -462,37 +469,52 @@ void OpenTelemetryPluginImpl::ClientCallTracerInterface::CallAttemptTracer<
 OpenTelemetryPluginImpl::ClientCallTracerInterface::ClientCallTracerInterface(
     const grpc_core::Slice& path, grpc_core::Arena* arena,
     bool registered_method, OpenTelemetryPluginImpl* otel_plugin,
-    std::shared_ptr<OpenTelemetryPluginImpl::ClientScopeConfig> scope_config)
+    std::shared_ptr<OpenTelemetryPluginImpl::ClientScopeConfig> scope_config,
+    OpenTelemetryPluginImpl::CallTracing tracing)
     : path_(path.Ref()),
       arena_(arena),
       registered_method_(registered_method),
       otel_plugin_(otel_plugin),
       scope_config_(std::move(scope_config)) {
-  if (otel_plugin_->tracer_ != nullptr) {
-    opentelemetry::trace::StartSpanOptions options;
-    // Get the parent span from the parent call if available, otherwise fall
-    // back to the threadlocal span.
-    // We are intentionally reusing census_context to save opentelemetry's Span
-    // on the context to avoid introducing a new type for opentelemetry inside
-    // gRPC Core. There's no risk of collisions since we do not allow multiple
-    // tracing systems active for the same call.
-    // TODO(yashykt) : We might want to allow multiple tracing systems. A
-    // potential idea is to expose arena based contexts via ServerContext and
-    // ClientContext to the application, allowing us to propagate multiple span
-    // contexts for the same call.
-    auto* parent_span = reinterpret_cast<opentelemetry::trace::Span*>(
-        arena->GetContext<census_context>());
-    if (parent_span != nullptr) {
-      options.parent = parent_span->GetContext();
-    } else {
-      options.parent =
-          opentelemetry::trace::Tracer::GetCurrentSpan()->GetContext();
+  switch (tracing) {
+    case OpenTelemetryPluginImpl::CallTracing::kNone:
+      break;
+    case OpenTelemetryPluginImpl::CallTracing::kPropagateOnly:
+      propagate_only_ = true;
+      span_ = opentelemetry::nostd::shared_ptr<opentelemetry::trace::Span>(
+          new opentelemetry::trace::DefaultSpan(ParentSpanContext(arena)));
+      break;
+    case OpenTelemetryPluginImpl::CallTracing::kSampled: {
+      grpc_core::CallTraceSampler::CostScope cost(
+          otel_plugin_->trace_sampler_.get());
+      opentelemetry::trace::StartSpanOptions options;
+      options.parent = ParentSpanContext(arena);
+      span_ = otel_plugin_->tracer_->StartSpan(
+          absl::StrCat("Sent.", GetMethodFromPath(path_)), options);
+      break;
     }
-    span_ = otel_plugin_->tracer_->StartSpan(
-        absl::StrCat("Sent.", GetMethodFromPath(path_)), options);
   }
 }
 
+opentelemetry::trace::SpanContext
+OpenTelemetryPluginImpl::ClientCallTracerInterface::ParentSpanContext(
+    grpc_core::Arena* arena) {
+  // Get the parent span from the parent call if available, otherwise fall
+  // back to the threadlocal span.
+  // We are intentionally reusing census_context to save opentelemetry's Span
+  // on the context to avoid introducing a new type for opentelemetry inside
+  // gRPC Core. There's no risk of collisions since we do not allow multiple
+  // tracing systems active for the same call.
+  // TODO(yashykt) : We might want to allow multiple tracing systems. A
+  // potential idea is to expose arena based contexts via ServerContext and
+  // ClientContext to the application, allowing us to propagate multiple span
+  // contexts for the same call.
+  auto* parent_span = reinterpret_cast<opentelemetry::trace::Span*>(
+      arena->GetContext<census_context>());
+  if (parent_span != nullptr) return parent_span->GetContext();
+  return opentelemetry::trace::Tracer::GetCurrentSpan()->GetContext();
+}
+
 OpenTelemetryPluginImpl::ClientCallTracerInterface::
     ~ClientCallTracerInterface() {
   absl::InlinedVector<std::pair<opentelemetry::nostd::string_view,
@@ -534,6 +556,8 @@ OpenTelemetryPluginImpl::ClientCallTracerInterface::
         opentelemetry::context::Context{});
   }
   if (span_ != nullptr) {
+    grpc_core::CallTraceSampler::CostScope cost(
+        otel_plugin_->trace_sampler_.get());
     span_->End();
   }
 }
@@ -144,9 +144,15 @@ class OpenTelemetryPluginImpl::ClientCallTracerInterface
   ClientCallTracerInterface(
       const grpc_core::Slice& path, grpc_core::Arena* arena,
       bool registered_method, OpenTelemetryPluginImpl* otel_plugin,
-      std::shared_ptr<OpenTelemetryPluginImpl::ClientScopeConfig> scope_config);
+      std::shared_ptr<OpenTelemetryPluginImpl::ClientScopeConfig> scope_config,
+      OpenTelemetryPluginImpl::CallTracing tracing);
   ~ClientCallTracerInterface() override;
 
+  // The span context a call started on \a arena is a child of: the server
+  // call it was started from, if any, otherwise the thread's current span.
+  static opentelemetry::trace::SpanContext ParentSpanContext(
+      grpc_core::Arena* arena);
+
   std::string TraceId() override {
     return OTelSpanTraceIdToString(span_.get());
   }
@@ -183,6 +189,9 @@ class OpenTelemetryPluginImpl::ClientCallTracerInterface
   absl::Duration retry_delay_ ABSL_GUARDED_BY(&mu_);
   absl::Time time_at_last_attempt_end_ ABSL_GUARDED_BY(&mu_);
   uint64_t num_active_attempts_ ABSL_GUARDED_BY(&mu_) = 0;
+  // If set, span_ only carries an unsampled parent's context, and attempts
+  // share it rather than starting spans of their own.
+  bool propagate_only_ = false;
   opentelemetry::nostd::shared_ptr<opentelemetry::trace::Span> span_;
 };
 
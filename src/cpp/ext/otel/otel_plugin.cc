@@ -265,6 +265,12 @@ OpenTelemetryPluginBuilderImpl::SetTextMapPropagator(
   return *this;
 }
 
+OpenTelemetryPluginBuilderImpl&
+OpenTelemetryPluginBuilderImpl::SetTracingCpuBudget(double cpu_budget) {
+  tracing_cpu_budget_ = cpu_budget;
+  return *this;
+}
+
 OpenTelemetryPluginBuilderImpl&
 OpenTelemetryPluginBuilderImpl::SetChannelScopeFilter(
     absl::AnyInvocable<
@@ -285,7 +291,8 @@ absl::Status OpenTelemetryPluginBuilderImpl::BuildAndRegisterGlobal() {
           std::move(generic_method_attribute_filter_),
           std::move(server_selector_), std::move(plugin_options_),
           std::move(optional_label_keys_), std::move(tracer_provider_),
-          std::move(text_map_propagator_), std::move(channel_scope_filter_)));
+          std::move(text_map_propagator_), std::move(channel_scope_filter_),
+          tracing_cpu_budget_));
   return absl::OkStatus();
 }
 
@@ -300,7 +307,7 @@ OpenTelemetryPluginBuilderImpl::Build() {
       std::move(generic_method_attribute_filter_), std::move(server_selector_),
       std::move(plugin_options_), std::move(optional_label_keys_),
       std::move(tracer_provider_), std::move(text_map_propagator_),
-      std::move(channel_scope_filter_));
+      std::move(channel_scope_filter_), tracing_cpu_budget_);
 }
 
 OpenTelemetryPluginImpl::CallbackMetricReporter::CallbackMetricReporter(
@@ -608,7 +615,8 @@ OpenTelemetryPluginImpl::OpenTelemetryPluginImpl(
     std::unique_ptr<TextMapPropagator> text_map_propagator,
     absl::AnyInvocable<
         bool(const OpenTelemetryPluginBuilder::ChannelScope& /*scope*/) const>
-        channel_scope_filter)
+        channel_scope_filter,
+    std::optional<double> tracing_cpu_budget)
     : meter_provider_(std::move(meter_provider)),
       server_selector_(std::move(server_selector)),
       target_attribute_filter_(std::move(target_attribute_filter)),
@@ -617,6 +625,11 @@ OpenTelemetryPluginImpl::OpenTelemetryPluginImpl(
       plugin_options_(std::move(plugin_options)),
       tracer_provider_(std::move(tracer_provider)),
       tracer_(MaybeMakeTracer(tracer_provider_.get())),
+      trace_sampler_(
+          tracer_ != nullptr && tracing_cpu_budget.has_value()
+              ? std::make_unique<grpc_core::CallTraceSampler>(
+                    *tracing_cpu_budget)
+              : nullptr),
       text_map_propagator_(std::move(text_map_propagator)),
       channel_scope_filter_(std::move(channel_scope_filter)) {
   if (meter_provider_ != nullptr) {
@@ -1323,17 +1336,26 @@ grpc_core::ClientCallTracerInterface*
 OpenTelemetryPluginImpl::GetClientCallTracer(
     const grpc_core::Slice& path, bool registered_method,
     std::shared_ptr<grpc_core::StatsPlugin::ScopeConfig> scope_config) {
-  return grpc_core::GetContext<grpc_core::Arena>()
-      ->ManagedNew<ClientCallTracerInterface>(
-          path, grpc_core::GetContext<grpc_core::Arena>(), registered_method,
-          this,
-          std::static_pointer_cast<OpenTelemetryPluginImpl::ClientScopeConfig>(
-              scope_config));
+  auto* arena = grpc_core::GetContext<grpc_core::Arena>();
+  const CallTracing tracing = ShouldTraceCall(
+      ClientCallTracerInterface::ParentSpanContext(arena));
+  // Without metrics, an untraced call has nothing to record.
+  if (tracing == CallTracing::kNone && meter_provider_ == nullptr) {
+    return nullptr;
+  }
+  return arena->ManagedNew<ClientCallTracerInterface>(
+      path, arena, registered_method, this,
+      std::static_pointer_cast<OpenTelemetryPluginImpl::ClientScopeConfig>(
+          scope_config),
+      tracing);
 }
 
 grpc_core::ServerCallTracerInterface*
 OpenTelemetryPluginImpl::GetServerCallTracer(
     std::shared_ptr<grpc_core::StatsPlugin::ScopeConfig> scope_config) {
+  // Whether the call is traced depends on the trace context in its
+  // metadata, so the tracer decides once that arrives.
+  if (tracer_ == nullptr && meter_provider_ == nullptr) return nullptr;
   auto arena = grpc_core::GetContext<grpc_core::Arena>();
   return arena
       ->MakeRefCounted<ServerCallTracerInterface>(
@@ -1618,6 +1640,12 @@ OpenTelemetryPluginBuilder& OpenTelemetryPluginBuilder::SetTextMapPropagator(
   return *this;
 }
 
+OpenTelemetryPluginBuilder& OpenTelemetryPluginBuilder::SetTracingCpuBudget(
+    double cpu_budget) {
+  impl_->SetTracingCpuBudget(cpu_budget);
+  return *this;
+}
+
 std::unique_ptr<TextMapPropagator>
 OpenTelemetryPluginBuilder::MakeGrpcTraceBinTextMapPropagator() {
   return std::make_unique<internal::GrpcTraceBinTextMapPropagator>();
@@ -36,9 +36,11 @@
 #include "opentelemetry/metrics/observer_result.h"
 #include "opentelemetry/metrics/sync_instruments.h"
 #include "opentelemetry/nostd/shared_ptr.h"
+#include "opentelemetry/trace/span_context.h"
 #include "opentelemetry/trace/tracer.h"
 #include "src/core/call/metadata_batch.h"
 #include "src/core/lib/channel/channel_args.h"
+#include "src/core/telemetry/call_trace_sampler.h"
 #include "src/core/telemetry/instrument.h"
 #include "src/core/telemetry/metrics.h"
 #include "src/core/util/down_cast.h"
@@ -186,6 +188,9 @@ class OpenTelemetryPluginBuilderImpl {
   OpenTelemetryPluginBuilderImpl& SetTextMapPropagator(
       std::unique_ptr<opentelemetry::context::propagation::TextMapPropagator>
           text_map_propagator);
+  // Sample calls for tracing so that tracing stays within \a cpu_budget of
+  // one CPU.
+  OpenTelemetryPluginBuilderImpl& SetTracingCpuBudget(double cpu_budget);
   // Set scope filter to choose which channels are recorded by this plugin.
   // Server-side recording remains unaffected.
   OpenTelemetryPluginBuilderImpl& SetChannelScopeFilter(
@@ -220,6 +225,7 @@ class OpenTelemetryPluginBuilderImpl {
   absl::AnyInvocable<bool(
       const OpenTelemetryPluginBuilder::ChannelScope& /*scope*/) const>
       channel_scope_filter_;
+  std::optional<double> tracing_cpu_budget_;
 };
 
 class OpenTelemetryPluginImpl
@@ -245,7 +251,8 @@ class OpenTelemetryPluginImpl
           text_map_propagator,
       absl::AnyInvocable<
           bool(const OpenTelemetryPluginBuilder::ChannelScope& /*scope*/) const>
-          channel_scope_filter);
+          channel_scope_filter,
+      std::optional<double> tracing_cpu_budget);
   ~OpenTelemetryPluginImpl() override;
 
   grpc_core::RefCountedPtr<grpc_core::CollectionScope> GetCollectionScope()
@@ -528,6 +535,31 @@ class OpenTelemetryPluginImpl
     return plugin_options_;
   }
 
+  // How a call is traced.
+  enum class CallTracing {
+    kNone,
+    // The call is part of a trace whose parent span was not sampled.  It
+    // starts no spans, but carries the parent's span context on so that
+    // downstream calls make the same decision.
+    kPropagateOnly,
+    kSampled,
+  };
+
+  // Decides, when a call starts, how it is traced.  A call inside an
+  // existing trace follows the decision of its local or remote \a parent;
+  // only calls that start a trace are sampled by trace_sampler_.
+  CallTracing ShouldTraceCall(
+      const opentelemetry::trace::SpanContext& parent) const {
+    if (tracer_ == nullptr) return CallTracing::kNone;
+    if (trace_sampler_ == nullptr) return CallTracing::kSampled;
+    if (parent.IsValid()) {
+      return parent.IsSampled() ? CallTracing::kSampled
+                                : CallTracing::kPropagateOnly;
+    }
+    return trace_sampler_->ShouldSample() ? CallTracing::kSampled
+                                          : CallTracing::kNone;
+  }
+
   template <typename ValueType>
   struct CallbackGaugeState {
     // It's possible to set values for multiple sets of labels at the same time
@@ -593,6 +625,8 @@ class OpenTelemetryPluginImpl
       plugin_options_;
   std::shared_ptr<opentelemetry::trace::TracerProvider> const tracer_provider_;
   opentelemetry::nostd::shared_ptr<opentelemetry::trace::Tracer> const tracer_;
+  // Decides which calls get spans.  Null if every call does.
+  std::unique_ptr<grpc_core::CallTraceSampler> const trace_sampler_;
   std::unique_ptr<opentelemetry::context::propagation::TextMapPropagator> const
       text_map_propagator_;
   absl::AnyInvocable<bool(
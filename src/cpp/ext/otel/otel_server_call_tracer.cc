@@ -30,6 +30,8 @@
 
 #include "opentelemetry/context/context.h"
 #include "opentelemetry/metrics/sync_instruments.h"
+#include "opentelemetry/trace/context.h"
+#include "opentelemetry/trace/default_span.h"
 #include "src/core/call/metadata_batch.h"
 #include "src/core/call/status_util.h"
 #include "src/core/lib/channel/channel_stack.h"
@@ -107,6 +109,8 @@ OpenTelemetryPluginImpl::ServerCallTracerInterface::ServerCallTracerInterface(
 OpenTelemetryPluginImpl::ServerCallTracerInterface::
     ~ServerCallTracerInterface() {
   if (span_ != nullptr) {
+    grpc_core::CallTraceSampler::CostScope cost(
+        otel_plugin_->trace_sampler_.get());
     span_->End();
   }
 }
@@ -141,15 +145,31 @@ void OpenTelemetryPluginImpl::ServerCallTracerInterface::
                             /*is_client=*/false, otel_plugin_));
   }
   if (otel_plugin_->tracer_ != nullptr) {
-    opentelemetry::trace::StartSpanOptions options;
+    opentelemetry::context::Context context;
     if (otel_plugin_->text_map_propagator_ != nullptr) {
       GrpcTextMapCarrier carrier(recv_initial_metadata);
-      opentelemetry::context::Context context;
       context = otel_plugin_->text_map_propagator_->Extract(carrier, context);
-      options.parent = context;
     }
-    span_ = otel_plugin_->tracer_->StartSpan(
-        absl::StrCat("Recv.", GetMethodFromPath(path_)), options);
+    const opentelemetry::trace::SpanContext parent =
+        opentelemetry::trace::GetSpan(context)->GetContext();
+    switch (otel_plugin_->ShouldTraceCall(parent)) {
+      case OpenTelemetryPluginImpl::CallTracing::kNone:
+        return;
+      case OpenTelemetryPluginImpl::CallTracing::kPropagateOnly:
+        // Child calls see this span and propagate the same decision.
+        span_ = opentelemetry::nostd::shared_ptr<opentelemetry::trace::Span>(
+            new opentelemetry::trace::DefaultSpan(parent));
+        break;
+      case OpenTelemetryPluginImpl::CallTracing::kSampled: {
+        grpc_core::CallTraceSampler::CostScope cost(
+            otel_plugin_->trace_sampler_.get());
+        opentelemetry::trace::StartSpanOptions options;
+        options.parent = context;
+        span_ = otel_plugin_->tracer_->StartSpan(
+            absl::StrCat("Recv.", GetMethodFromPath(path_)), options);
+        break;
+      }
+    }
     // We are intentionally reusing census_context to save opentelemetry's Span
     // on the context to avoid introducing a new type for opentelemetry inside
     // gRPC Core. There's no risk of collisions since we do not allow multiple
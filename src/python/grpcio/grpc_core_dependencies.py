@@ -51,6 +51,7 @@ CORE_SOURCE_FILES = [
     'src/core/client_channel/lb_metadata.cc',
     'src/core/client_channel/load_balanced_call_destination.cc',
     'src/core/client_channel/local_subchannel_pool.cc',
+    'src/core/client_channel/retry_buffer_budget.cc',
     'src/core/client_channel/retry_filter.cc',
     'src/core/client_channel/retry_filter_legacy_call_data.cc',
     'src/core/client_channel/retry_interceptor.cc',
@@ -182,6 +183,7 @@ CORE_SOURCE_FILES = [
     'src/core/ext/transport/chttp2/transport/transport_common.cc',
     'src/core/ext/transport/chttp2/transport/varint.cc',
     'src/core/ext/transport/chttp2/transport/write_cycle.cc',
+    'src/core/ext/transport/chttp2/transport/write_scheduler.cc',
     'src/core/ext/transport/chttp2/transport/write_size_policy.cc',
     'src/core/ext/transport/chttp2/transport/writing.cc',
     'src/core/ext/transport/inproc/inproc_transport.cc',
@@ -595,6 +597,7 @@ CORE_SOURCE_FILES = [
     'src/core/lib/event_engine/posix_engine/posix_interface_windows.cc',
     'src/core/lib/event_engine/posix_engine/posix_write_event_sink.cc',
     'src/core/lib/event_engine/posix_engine/set_socket_dualstack.cc',
+    'src/core/lib/event_engine/posix_engine/tcp_info_sampler.cc',
     'src/core/lib/event_engine/posix_engine/tcp_socket_utils.cc',
     'src/core/lib/event_engine/posix_engine/timer.cc',
     'src/core/lib/event_engine/posix_engine/timer_heap.cc',
@@ -750,6 +753,7 @@ CORE_SOURCE_FILES = [
     'src/core/lib/transport/error_utils.cc',
     'src/core/lib/transport/promise_endpoint.cc',
     'src/core/lib/transport/status_conversion.cc',
+    'src/core/lib/transport/tcp_info_bdp_estimator.cc',
     'src/core/lib/transport/timeout_encoding.cc',
     'src/core/lib/transport/transport.cc',
     'src/core/lib/transport/transport_op_string.cc',
@@ -765,11 +769,14 @@ CORE_SOURCE_FILES = [
     'src/core/load_balancing/health_check_client.cc',
     'src/core/load_balancing/lb_policy.cc',
     'src/core/load_balancing/lb_policy_registry.cc',
+    'src/core/load_balancing/least_request/least_request.cc',
     'src/core/load_balancing/oob_backend_metric.cc',
     'src/core/load_balancing/outlier_detection/outlier_detection.cc',
+    'src/core/load_balancing/peak_ewma/peak_ewma.cc',
     'src/core/load_balancing/pick_first/pick_first.cc',
     'src/core/load_balancing/priority/priority.cc',
     'src/core/load_balancing/ring_hash/ring_hash.cc',
+    'src/core/load_balancing/ring_hash/ring_hash_lookup.cc',
     'src/core/load_balancing/rls/rls.cc',
     'src/core/load_balancing/round_robin/round_robin.cc',
     'src/core/load_balancing/weighted_round_robin/static_stride_scheduler.cc',
@@ -813,6 +820,7 @@ CORE_SOURCE_FILES = [
     'src/core/service_config/service_config_channel_arg_filter.cc',
     'src/core/service_config/service_config_impl.cc',
     'src/core/service_config/service_config_parser.cc',
+    'src/core/telemetry/call_trace_sampler.cc',
     'src/core/telemetry/call_tracer.cc',
     'src/core/telemetry/context_list_entry.cc',
     'src/core/telemetry/default_tcp_tracer.cc',
@@ -848,6 +856,7 @@ CORE_SOURCE_FILES = [
     'src/core/tsi/fake_transport_security.cc',
     'src/core/tsi/local_transport_security.cc',
     'src/core/tsi/ssl/key_logging/ssl_key_logging.cc',
+    'src/core/tsi/ssl/ktls/ssl_ktls.cc',
     'src/core/tsi/ssl/session_cache/ssl_session_boringssl.cc',
     'src/core/tsi/ssl/session_cache/ssl_session_cache.cc',
     'src/core/tsi/ssl/session_cache/ssl_session_openssl.cc',
@@ -33,6 +33,7 @@
 #include "src/core/util/useful.h"
 #include "test/core/test_util/test_config.h"
 #include "gtest/gtest.h"
+#include "absl/hash/hash.h"
 #include "absl/log/log.h"
 
 namespace grpc_core {
@@ -120,6 +121,34 @@ TEST(ChannelArgsTest, ObjectApi) {
   EXPECT_EQ(a.GetObject<MyFancyObject>()->n, 42);
 }
 
+TEST(ChannelArgsTest, HashIsConsistentWithEquality) {
+  struct MyFancyObject : public RefCounted<MyFancyObject> {
+    explicit MyFancyObject(int n) : n(n) {}
+    static absl::string_view ChannelArgName() {
+      return "grpc.internal.my-fancy-object";
+    }
+    int n;
+    static int ChannelArgsCompare(const MyFancyObject* a,
+                                  const MyFancyObject* b) {
+      return a->n - b->n;
+    }
+  };
+  // Separately allocated strings and objects that compare equal.
+  auto a = ChannelArgs()
+               .Set("int", 1)
+               .Set("string", std::string("foo"))
+               .SetObject(MakeRefCounted<MyFancyObject>(42));
+  auto b = ChannelArgs()
+               .SetObject(MakeRefCounted<MyFancyObject>(42))
+               .Set("string", std::string("foo"))
+               .Set("int", 1);
+  ASSERT_EQ(a, b);
+  EXPECT_EQ(absl::HashOf(a), absl::HashOf(b));
+  EXPECT_NE(absl::HashOf(a), absl::HashOf(a.Set("int", 2)));
+  EXPECT_NE(absl::HashOf(a), absl::HashOf(a.Set("string", "bar")));
+  EXPECT_NE(absl::HashOf(a), absl::HashOf(a.Remove("int")));
+}
+
 TEST(ChannelArgsTest, ToAndFromC) {
   const grpc_arg_pointer_vtable malloc_vtable = {
       // copy
@@ -221,6 +221,37 @@ TEST_P(ChannelzRegistryTest, HugeNodeCountWithParents) {
   std::shuffle(nodes.begin(), nodes.end(), SharedBitGen());
 }
 
+TEST_P(ChannelzRegistryTest, ForEachEntityVisitsAllInOrder) {
+  std::vector<RefCountedPtr<BaseNode>> nodes;
+  for (int i = 0; i < 1000; ++i) {
+    nodes.push_back(MakeRefCounted<SocketNode>("x", "y", "z", nullptr));
+  }
+  std::vector<intptr_t> uuids;
+  ChannelzRegistry::ForEachEntity([&](WeakRefCountedPtr<BaseNode> node) {
+    uuids.push_back(node->uuid());
+  });
+  EXPECT_EQ(uuids.size(), nodes.size());
+  EXPECT_TRUE(std::is_sorted(uuids.begin(), uuids.end()));
+}
+
+TEST_P(ChannelzRegistryTest, ForEachEntitySkipsNodesRegisteredDuringWalk) {
+  std::vector<RefCountedPtr<BaseNode>> nodes;
+  for (int i = 0; i < 1000; ++i) {
+    nodes.push_back(MakeRefCounted<SocketNode>("x", "y", "z", nullptr));
+  }
+  std::vector<RefCountedPtr<BaseNode>> added_during_walk;
+  size_t visited = 0;
+  ChannelzRegistry::ForEachEntity([&](WeakRefCountedPtr<BaseNode>) {
+    ++visited;
+    // No registry lock is held here, so registering and numbering nodes
+    // must not deadlock.
+    added_during_walk.push_back(
+        MakeRefCounted<SocketNode>("x", "y", "z", nullptr));
+    added_during_walk.back()->uuid();
+  });
+  EXPECT_EQ(visited, nodes.size());
+}
+
 TEST_P(ChannelzRegistryTest, GetDescendants) {
   auto root = MakeRefCounted<ChannelNode>("root", 1, false);
   auto ch1 = MakeRefCounted<SubchannelNode>("ch1", 1);
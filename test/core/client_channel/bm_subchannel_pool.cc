@@ -0,0 +1,150 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Measures how fast channels can get their subchannels from the global
+// subchannel pool, as happens when many channels to overlapping backends
+// are created at once.
+
+#include <benchmark/benchmark.h>
+#include <grpc/grpc.h>
+#include <grpc/impl/channel_arg_names.h>
+
+#include <string>
+#include <vector>
+
+#include "src/core/client_channel/connector.h"
+#include "src/core/client_channel/global_subchannel_pool.h"
+#include "src/core/client_channel/subchannel.h"
+#include "src/core/client_channel/subchannel_pool_interface.h"
+#include "src/core/lib/address_utils/parse_address.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/event_engine/default_event_engine.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/resource_quota/resource_quota.h"
+#include "src/core/util/orphanable.h"
+#include "src/core/util/ref_counted_ptr.h"
+#include "src/core/util/uri.h"
+#include "absl/log/check.h"
+#include "absl/strings/str_cat.h"
+
+namespace grpc_core {
+namespace {
+
+class TestConnector final : public SubchannelConnector {
+ public:
+  void Connect(const Args&, Result*, grpc_closure*) override {}
+  void Shutdown(grpc_error_handle) override {}
+};
+
+// Roughly what a channel passes down to its subchannels.
+ChannelArgs MakeChannelArgs() {
+  return ChannelArgs()
+      .SetObject(GlobalSubchannelPool::instance())
+      .SetObject(ResourceQuota::Default())
+      .SetObject(grpc_event_engine::experimental::GetDefaultEventEngine())
+      .Set(GRPC_ARG_DEFAULT_AUTHORITY, "test.example.com")
+      .Set(GRPC_ARG_PRIMARY_USER_AGENT_STRING, "grpc-c++/benchmark")
+      .Set(GRPC_ARG_KEEPALIVE_TIME_MS, 30000)
+      .Set(GRPC_ARG_KEEPALIVE_TIMEOUT_MS, 10000)
+      .Set(GRPC_ARG_MAX_RECEIVE_MESSAGE_LENGTH, 16 * 1024 * 1024)
+      .Set(GRPC_ARG_INITIAL_RECONNECT_BACKOFF_MS, 1000)
+      .Set(GRPC_ARG_MAX_RECONNECT_BACKOFF_MS, 120000)
+      .Set(GRPC_ARG_ENABLE_CHANNELZ, false);
+}
+
+std::vector<grpc_resolved_address> MakeAddresses(int n) {
+  std::vector<grpc_resolved_address> addresses(n);
+  for (int i = 0; i < n; ++i) {
+    auto uri = URI::Parse(
+        absl::StrCat("ipv4:10.0.", i / 256, ".", i % 256, ":443"));
+    CHECK_OK(uri);
+    CHECK(grpc_parse_uri(*uri, &addresses[i]));
+  }
+  return addresses;
+}
+
+// Every channel looks up subchannels that already exist, which is the
+// common case when many channels go to the same backends.
+void BM_CreateExistingSubchannel(benchmark::State& state) {
+  static std::vector<grpc_resolved_address>* addresses;
+  static std::vector<RefCountedPtr<Subchannel>>* existing;
+  ExecCtx exec_ctx;
+  const ChannelArgs args = MakeChannelArgs();
+  if (state.thread_index() == 0) {
+    addresses = new std::vector<grpc_resolved_address>(
+        MakeAddresses(state.range(0)));
+    existing = new std::vector<RefCountedPtr<Subchannel>>();
+    for (const auto& address : *addresses) {
+      existing->push_back(Subchannel::Create(MakeOrphanable<TestConnector>(),
+                                             address, args));
+    }
+  }
+  size_t i = state.thread_index();
+  for (auto _ : state) {
+    auto subchannel = Subchannel::Create(
+        MakeOrphanable<TestConnector>(), (*addresses)[i % addresses->size()],
+        args);
+    benchmark::DoNotOptimize(subchannel);
+    ++i;
+  }
+  if (state.thread_index() == 0) {
+    delete existing;
+    delete addresses;
+  }
+}
+BENCHMARK(BM_CreateExistingSubchannel)
+    ->Arg(16)
+    ->Arg(1024)
+    ->ThreadRange(1, 16)
+    ->UseRealTime();
+
+// Every channel gets a new subchannel and drops it again, so each
+// iteration registers and unregisters a subchannel.
+void BM_CreateNewSubchannel(benchmark::State& state) {
+  ExecCtx exec_ctx;
+  const auto addresses = MakeAddresses(256);
+  const ChannelArgs args =
+      MakeChannelArgs().Set("grpc.test.thread", state.thread_index());
+  size_t i = 0;
+  for (auto _ : state) {
+    auto subchannel = Subchannel::Create(
+        MakeOrphanable<TestConnector>(), addresses[i % addresses.size()],
+        args);
+    benchmark::DoNotOptimize(subchannel);
+    subchannel.reset();
+    exec_ctx.Flush();
+    ++i;
+  }
+}
+BENCHMARK(BM_CreateNewSubchannel)->ThreadRange(1, 16)->UseRealTime();
+
+}  // namespace
+}  // namespace grpc_core
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  ::benchmark::Initialize(&argc, argv);
+  grpc_init();
+  {
+    auto ee = grpc_event_engine::experimental::GetDefaultEventEngine();
+    benchmark::RunTheBenchmarksNamespaced();
+  }
+  grpc_shutdown();
+  return 0;
+}
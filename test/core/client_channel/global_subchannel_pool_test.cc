@@ -0,0 +1,166 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/client_channel/global_subchannel_pool.h"
+
+#include <grpc/grpc.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "src/core/client_channel/connector.h"
+#include "src/core/client_channel/subchannel.h"
+#include "src/core/client_channel/subchannel_pool_interface.h"
+#include "src/core/lib/address_utils/parse_address.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/event_engine/default_event_engine.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/resource_quota/resource_quota.h"
+#include "src/core/util/orphanable.h"
+#include "src/core/util/ref_counted_ptr.h"
+#include "src/core/util/uri.h"
+#include "test/core/test_util/test_config.h"
+#include "gtest/gtest.h"
+#include "absl/strings/str_cat.h"
+
+namespace grpc_core {
+namespace testing {
+namespace {
+
+class TestConnector final : public SubchannelConnector {
+ public:
+  void Connect(const Args&, Result*, grpc_closure*) override {}
+  void Shutdown(grpc_error_handle) override {}
+};
+
+ChannelArgs MakeChannelArgs(int tag) {
+  return ChannelArgs()
+      .SetObject(GlobalSubchannelPool::instance())
+      .SetObject(ResourceQuota::Default())
+      .SetObject(grpc_event_engine::experimental::GetDefaultEventEngine())
+      .Set("grpc.test.tag", tag);
+}
+
+std::vector<grpc_resolved_address> MakeAddresses(int n) {
+  std::vector<grpc_resolved_address> addresses(n);
+  for (int i = 0; i < n; ++i) {
+    auto uri = URI::Parse(
+        absl::StrCat("ipv4:10.0.", i / 256, ".", i % 256, ":443"));
+    EXPECT_TRUE(uri.ok());
+    EXPECT_TRUE(grpc_parse_uri(*uri, &addresses[i]));
+  }
+  return addresses;
+}
+
+RefCountedPtr<Subchannel> Find(const grpc_resolved_address& address,
+                               const ChannelArgs& args) {
+  return GlobalSubchannelPool::instance()
+      ->FindSubchannel(SubchannelKey(address, args))
+      .TakeAsSubclass<Subchannel>();
+}
+
+RefCountedPtr<Subchannel> Create(const grpc_resolved_address& address,
+                                 const ChannelArgs& args) {
+  return Subchannel::Create(MakeOrphanable<TestConnector>(), address, args);
+}
+
+TEST(GlobalSubchannelPoolTest, ReturnsRegisteredSubchannel) {
+  ExecCtx exec_ctx;
+  const auto addresses = MakeAddresses(1);
+  const ChannelArgs args = MakeChannelArgs(0);
+  EXPECT_EQ(Find(addresses[0], args), nullptr);
+  auto subchannel = Create(addresses[0], args);
+  EXPECT_EQ(Find(addresses[0], args), subchannel);
+  EXPECT_EQ(Create(addresses[0], args), subchannel);
+  EXPECT_EQ(Find(addresses[0], MakeChannelArgs(1)), nullptr);
+  subchannel.reset();
+  exec_ctx.Flush();
+  EXPECT_EQ(Find(addresses[0], args), nullptr);
+}
+
+TEST(GlobalSubchannelPoolTest, UnregisterKeepsOtherSubchannels) {
+  // Enough subchannels that buckets hold several of them.
+  ExecCtx exec_ctx;
+  const auto addresses = MakeAddresses(8192);
+  const ChannelArgs args = MakeChannelArgs(2);
+  std::vector<RefCountedPtr<Subchannel>> subchannels;
+  for (const auto& address : addresses) {
+    subchannels.push_back(Create(address, args));
+  }
+  for (size_t i = 0; i < subchannels.size(); i += 2) subchannels[i].reset();
+  exec_ctx.Flush();
+  for (size_t i = 0; i < subchannels.size(); ++i) {
+    EXPECT_EQ(Find(addresses[i], args), subchannels[i]) << i;
+  }
+}
+
+TEST(GlobalSubchannelPoolTest, ConcurrentFindAndRegister) {
+  constexpr int kThreads = 4;
+  constexpr int kIterations = 2000;
+  ExecCtx exec_ctx;
+  const auto addresses = MakeAddresses(256);
+  const ChannelArgs stable_args = MakeChannelArgs(3);
+  std::vector<RefCountedPtr<Subchannel>> stable;
+  for (const auto& address : addresses) {
+    stable.push_back(Create(address, stable_args));
+  }
+  std::atomic<bool> done{false};
+  std::vector<std::thread> threads;
+  // Readers only look up subchannels that stay registered throughout.
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&, t]() {
+      ExecCtx exec_ctx;
+      size_t i = t;
+      while (!done.load(std::memory_order_relaxed)) {
+        const size_t n = i % addresses.size();
+        EXPECT_EQ(Find(addresses[n], stable_args), stable[n]);
+        ++i;
+      }
+    });
+  }
+  // Meanwhile writers register and unregister subchannels for the same
+  // addresses with other args, republishing buckets under the readers.
+  std::vector<std::thread> writers;
+  for (int t = 0; t < kThreads; ++t) {
+    writers.emplace_back([&, t]() {
+      ExecCtx exec_ctx;
+      const ChannelArgs args = MakeChannelArgs(100 + t);
+      for (int i = 0; i < kIterations; ++i) {
+        const auto& address = addresses[(i * 7 + t) % addresses.size()];
+        auto subchannel = Create(address, args);
+        EXPECT_EQ(Find(address, args), subchannel);
+        subchannel.reset();
+        exec_ctx.Flush();
+        EXPECT_EQ(Find(address, args), nullptr);
+      }
+    });
+  }
+  for (auto& writer : writers) writer.join();
+  done.store(true, std::memory_order_relaxed);
+  for (auto& thread : threads) thread.join();
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc_init();
+  int ret = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return ret;
+}
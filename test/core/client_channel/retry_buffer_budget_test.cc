@@ -0,0 +1,80 @@
+//
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include "src/core/client_channel/retry_buffer_budget.h"
+
+#include <grpc/impl/channel_arg_names.h>
+
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/resource_quota/resource_quota.h"
+#include "test/core/test_util/test_config.h"
+#include "gtest/gtest.h"
+
+namespace grpc_core {
+namespace {
+
+RefCountedPtr<RetryBufferBudget> MakeBudget(int max_bytes) {
+  return RetryBufferBudget::Create(
+      ChannelArgs()
+          .Set(GRPC_ARG_RETRY_BUFFER_CHANNEL_SIZE, max_bytes)
+          .SetObject(MakeResourceQuota("retry_buffer_budget_test")));
+}
+
+TEST(RetryBufferBudgetTest, DisabledByDefault) {
+  auto budget = RetryBufferBudget::Create(ChannelArgs());
+  EXPECT_FALSE(budget->enabled());
+  EXPECT_FALSE(budget->TryReserve(1));
+  EXPECT_EQ(budget->used_bytes(), 0);
+}
+
+TEST(RetryBufferBudgetTest, NegativeSizeDisables) {
+  EXPECT_FALSE(MakeBudget(-1)->enabled());
+}
+
+TEST(RetryBufferBudgetTest, ReservesUpToMax) {
+  auto budget = MakeBudget(1000);
+  EXPECT_TRUE(budget->enabled());
+  EXPECT_TRUE(budget->TryReserve(600));
+  EXPECT_EQ(budget->used_bytes(), 600);
+  // Would go past the max.
+  EXPECT_FALSE(budget->TryReserve(500));
+  EXPECT_EQ(budget->used_bytes(), 600);
+  // Fits exactly.
+  EXPECT_TRUE(budget->TryReserve(400));
+  EXPECT_EQ(budget->used_bytes(), 1000);
+  EXPECT_FALSE(budget->TryReserve(1));
+  budget->Release(1000);
+}
+
+TEST(RetryBufferBudgetTest, ReleaseMakesRoom) {
+  auto budget = MakeBudget(1000);
+  EXPECT_TRUE(budget->TryReserve(1000));
+  EXPECT_FALSE(budget->TryReserve(100));
+  budget->Release(300);
+  EXPECT_EQ(budget->used_bytes(), 700);
+  EXPECT_TRUE(budget->TryReserve(300));
+  budget->Release(1000);
+  EXPECT_EQ(budget->used_bytes(), 0);
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -17,10 +17,15 @@
 #include <grpc/grpc.h>
 
 #include <atomic>
+#include <chrono>
 #include <memory>
+#include <optional>
 #include <queue>
 
+#include "src/core/client_channel/retry_throttle.h"
 #include "src/core/lib/resource_quota/resource_quota.h"
+#include "src/core/service_config/service_config_call_data.h"
+#include "src/core/service_config/service_config_impl.h"
 #include "test/core/call/yodel/yodel_test.h"
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
@@ -53,10 +58,23 @@ class RetryInterceptorTest : public YodelTest {
     return client_initial_metadata;
   }
 
+  // Calls made after this see `json` as the channel's service config.
+  void SetServiceConfig(absl::string_view json) {
+    service_config_ = ServiceConfigImpl::Create(ChannelArgs(), json).value();
+  }
+
   CallInitiatorAndHandler MakeCall(
       ClientMetadataHandle client_initial_metadata) {
     auto arena = call_arena_allocator_->MakeArena();
     arena->SetContext<EventEngine>(event_engine().get());
+    if (service_config_ != nullptr) {
+      auto* service_config_call_data =
+          arena->New<ServiceConfigCallData>(arena.get());
+      service_config_call_data->SetServiceConfig(
+          service_config_,
+          service_config_->GetMethodParsedConfigVector(
+              Slice::FromCopiedString(kTestPath).c_slice()));
+    }
     return MakeCallPair(std::move(client_initial_metadata), std::move(arena));
   }
 
@@ -69,6 +87,58 @@ class RetryInterceptorTest : public YodelTest {
     return TickUntil(absl::FunctionRef<Poll<CallHandler>()>(poll));
   }
 
+  // Returns the next attempt if one has started, without waiting.
+  std::optional<CallHandler> PopStartedCall() {
+    return call_destination_->PopHandler();
+  }
+
+  // Starts `call` through the interceptor as a unary call.  `status` is set
+  // once the call finishes.
+  void StartUnaryCall(CallInitiatorAndHandler call,
+                      std::optional<grpc_status_code>* status) {
+    SpawnTestSeq(
+        call.initiator, "initiator",
+        [this, handler = std::move(call.handler),
+         initiator = call.initiator]() mutable {
+          destination_under_test().StartCall(handler);
+          return initiator.PushMessage(Arena::MakePooled<Message>(
+              SliceBuffer(Slice::FromCopiedString("hello")), 0));
+        },
+        [initiator = call.initiator](StatusFlag result) mutable {
+          EXPECT_TRUE(result.ok());
+          initiator.FinishSends();
+          return initiator.PullServerTrailingMetadata();
+        },
+        [status](ServerMetadataHandle md) {
+          *status = md->get(GrpcStatusMetadata()).value_or(GRPC_STATUS_UNKNOWN);
+        });
+  }
+
+  // Finishes an attempt with a trailers-only response.
+  void FinishAttempt(CallHandler attempt, grpc_status_code status,
+                     std::optional<Duration> server_pushback = std::nullopt) {
+    SpawnTestSeq(attempt, "finish_attempt",
+                 [attempt, status, server_pushback]() mutable {
+                   auto md = Arena::MakePooledForOverwrite<ServerMetadata>();
+                   md->Set(GrpcStatusMetadata(), status);
+                   if (server_pushback.has_value()) {
+                     md->Set(GrpcRetryPushbackMsMetadata(), *server_pushback);
+                   }
+                   attempt.PushServerTrailingMetadata(std::move(md));
+                 });
+  }
+
+  void ExpectCancelled(CallHandler attempt) {
+    SpawnTestSeq(
+        attempt, "expect_cancelled",
+        [attempt]() mutable { return attempt.WasCancelled(); },
+        [](bool cancelled) { EXPECT_TRUE(cancelled); });
+  }
+
+  EventEngine::Duration Now() {
+    return event_engine()->Now().time_since_epoch();
+  }
+
   UnstartedCallDestination& destination_under_test() {
     CHECK(destination_under_test_ != nullptr);
     return *destination_under_test_;
@@ -97,11 +167,13 @@ class RetryInterceptorTest : public YodelTest {
   void InitCoreConfiguration() override {}
 
   void Shutdown() override {
+    service_config_.reset();
     call_destination_.reset();
     destination_under_test_.reset();
     call_arena_allocator_.reset();
   }
 
+  RefCountedPtr<ServiceConfig> service_config_;
   RefCountedPtr<TestCallDestination> call_destination_ =
       MakeRefCounted<TestCallDestination>();
   RefCountedPtr<UnstartedCallDestination> destination_under_test_;
@@ -145,6 +217,199 @@ RETRY_INTERCEPTOR_TEST(StartCall) {
   WaitForAllPendingWork();
 }
 
+// Hedging policy used by the tests below unless they say otherwise.
+constexpr absl::string_view kHedgingServiceConfig = R"json({
+  "methodConfig": [{
+    "name": [{}],
+    "hedgingPolicy": {
+      "maxAttempts": 3,
+      "hedgingDelay": "1s",
+      "nonFatalStatusCodes": ["UNAVAILABLE", "RESOURCE_EXHAUSTED"]
+    }
+  }]
+})json";
+
+RETRY_INTERCEPTOR_TEST(HedgedAttemptStartsAfterHedgingDelay) {
+  SetServiceConfig(kHedgingServiceConfig);
+  InitInterceptor(ChannelArgs());
+  std::optional<grpc_status_code> status;
+  StartUnaryCall(MakeCall(MakeClientInitialMetadata()), &status);
+  auto first = TickUntilCallStarted();
+  const auto start = Now();
+  event_engine()->TickForDuration(std::chrono::milliseconds(900));
+  EXPECT_FALSE(PopStartedCall().has_value());
+  auto second = TickUntilCallStarted();
+  EXPECT_GE(Now() - start, std::chrono::seconds(1));
+  ExpectCancelled(first);
+  FinishAttempt(second, GRPC_STATUS_OK);
+  WaitForAllPendingWork();
+  EXPECT_EQ(status, GRPC_STATUS_OK);
+}
+
+RETRY_INTERCEPTOR_TEST(FirstResponseCancelsOtherAttempts) {
+  SetServiceConfig(kHedgingServiceConfig);
+  InitInterceptor(ChannelArgs());
+  std::optional<grpc_status_code> status;
+  StartUnaryCall(MakeCall(MakeClientInitialMetadata()), &status);
+  auto first = TickUntilCallStarted();
+  auto second = TickUntilCallStarted();
+  auto third = TickUntilCallStarted();
+  ExpectCancelled(first);
+  ExpectCancelled(third);
+  SpawnTestSeq(
+      second, "respond",
+      [second]() mutable {
+        auto md = Arena::MakePooledForOverwrite<ServerMetadata>();
+        md->Set(ContentTypeMetadata(), ContentTypeMetadata::kApplicationGrpc);
+        return second.PushServerInitialMetadata(std::move(md));
+      },
+      [second](StatusFlag result) mutable {
+        EXPECT_TRUE(result.ok());
+        auto md = Arena::MakePooledForOverwrite<ServerMetadata>();
+        md->Set(GrpcStatusMetadata(), GRPC_STATUS_OK);
+        second.PushServerTrailingMetadata(std::move(md));
+      });
+  WaitForAllPendingWork();
+  EXPECT_EQ(status, GRPC_STATUS_OK);
+  // Hedging stopped once an attempt was committed.
+  event_engine()->TickForDuration(std::chrono::seconds(5));
+  EXPECT_FALSE(PopStartedCall().has_value());
+}
+
+RETRY_INTERCEPTOR_TEST(NonFatalStatusStartsNextAttemptImmediately) {
+  SetServiceConfig(kHedgingServiceConfig);
+  InitInterceptor(ChannelArgs());
+  std::optional<grpc_status_code> status;
+  StartUnaryCall(MakeCall(MakeClientInitialMetadata()), &status);
+  auto first = TickUntilCallStarted();
+  const auto start = Now();
+  FinishAttempt(first, GRPC_STATUS_UNAVAILABLE);
+  auto second = TickUntilCallStarted();
+  EXPECT_LT(Now() - start, std::chrono::seconds(1));
+  FinishAttempt(second, GRPC_STATUS_OK);
+  WaitForAllPendingWork();
+  EXPECT_EQ(status, GRPC_STATUS_OK);
+}
+
+RETRY_INTERCEPTOR_TEST(FatalStatusIsReturnedImmediately) {
+  SetServiceConfig(kHedgingServiceConfig);
+  InitInterceptor(ChannelArgs());
+  std::optional<grpc_status_code> status;
+  StartUnaryCall(MakeCall(MakeClientInitialMetadata()), &status);
+  auto first = TickUntilCallStarted();
+  FinishAttempt(first, GRPC_STATUS_INVALID_ARGUMENT);
+  WaitForAllPendingWork();
+  EXPECT_EQ(status, GRPC_STATUS_INVALID_ARGUMENT);
+  EXPECT_FALSE(PopStartedCall().has_value());
+}
+
+RETRY_INTERCEPTOR_TEST(ServerPushbackDelaysNextAttempt) {
+  SetServiceConfig(kHedgingServiceConfig);
+  InitInterceptor(ChannelArgs());
+  std::optional<grpc_status_code> status;
+  StartUnaryCall(MakeCall(MakeClientInitialMetadata()), &status);
+  auto first = TickUntilCallStarted();
+  const auto start = Now();
+  FinishAttempt(first, GRPC_STATUS_UNAVAILABLE, Duration::Seconds(5));
+  // Neither the failure nor the hedging delay starts an attempt before the
+  // server's push-back has passed.
+  event_engine()->TickForDuration(std::chrono::milliseconds(4900));
+  EXPECT_FALSE(PopStartedCall().has_value());
+  auto second = TickUntilCallStarted();
+  EXPECT_GE(Now() - start, std::chrono::seconds(5));
+  FinishAttempt(second, GRPC_STATUS_OK);
+  WaitForAllPendingWork();
+  EXPECT_EQ(status, GRPC_STATUS_OK);
+}
+
+RETRY_INTERCEPTOR_TEST(NegativeServerPushbackStopsHedging) {
+  SetServiceConfig(kHedgingServiceConfig);
+  InitInterceptor(ChannelArgs());
+  std::optional<grpc_status_code> status;
+  StartUnaryCall(MakeCall(MakeClientInitialMetadata()), &status);
+  auto first = TickUntilCallStarted();
+  FinishAttempt(first, GRPC_STATUS_UNAVAILABLE, Duration::Milliseconds(-1));
+  WaitForAllPendingWork();
+  EXPECT_EQ(status, GRPC_STATUS_UNAVAILABLE);
+  EXPECT_FALSE(PopStartedCall().has_value());
+}
+
+RETRY_INTERCEPTOR_TEST(ThrottledHedgingStartsNoNewAttempts) {
+  SetServiceConfig(kHedgingServiceConfig);
+  // Two failures take the throttler down to its threshold.
+  auto throttler = RetryThrottler::Create(4000, 1000, nullptr);
+  throttler->RecordFailure();
+  throttler->RecordFailure();
+  ASSERT_TRUE(throttler->IsThrottled());
+  InitInterceptor(ChannelArgs().SetObject(throttler));
+  std::optional<grpc_status_code> status;
+  StartUnaryCall(MakeCall(MakeClientInitialMetadata()), &status);
+  auto first = TickUntilCallStarted();
+  event_engine()->TickForDuration(std::chrono::seconds(5));
+  EXPECT_FALSE(PopStartedCall().has_value());
+  // The attempt in flight still gets to finish the call.
+  FinishAttempt(first, GRPC_STATUS_UNAVAILABLE);
+  WaitForAllPendingWork();
+  EXPECT_EQ(status, GRPC_STATUS_UNAVAILABLE);
+  EXPECT_FALSE(PopStartedCall().has_value());
+}
+
+RETRY_INTERCEPTOR_TEST(OnlyFinalFailureIsReturned) {
+  SetServiceConfig(kHedgingServiceConfig);
+  InitInterceptor(ChannelArgs());
+  std::optional<grpc_status_code> status;
+  StartUnaryCall(MakeCall(MakeClientInitialMetadata()), &status);
+  auto first = TickUntilCallStarted();
+  auto second = TickUntilCallStarted();
+  auto third = TickUntilCallStarted();
+  FinishAttempt(first, GRPC_STATUS_UNAVAILABLE);
+  FinishAttempt(second, GRPC_STATUS_UNAVAILABLE);
+  event_engine()->TickForDuration(std::chrono::seconds(1));
+  EXPECT_FALSE(status.has_value());
+  FinishAttempt(third, GRPC_STATUS_RESOURCE_EXHAUSTED);
+  WaitForAllPendingWork();
+  EXPECT_EQ(status, GRPC_STATUS_RESOURCE_EXHAUSTED);
+}
+
+RETRY_INTERCEPTOR_TEST(AdaptiveHedgingDelayFollowsSlowBackend) {
+  SetServiceConfig(R"json({
+    "methodConfig": [{
+      "name": [{}],
+      "hedgingPolicy": {
+        "maxAttempts": 2,
+        "hedgingDelay": "0.05s",
+        "hedgingDelayPercentile": 50,
+        "nonFatalStatusCodes": ["UNAVAILABLE"]
+      }
+    }]
+  })json");
+  InitInterceptor(ChannelArgs());
+  // Every attempt takes 2s to answer, so each call hedges and the hedge
+  // loses.  That must not drag the delay down to the configured 50ms floor.
+  constexpr auto kBackendLatency = std::chrono::seconds(2);
+  for (int i = 0; i < 60; ++i) {
+    std::optional<grpc_status_code> status;
+    StartUnaryCall(MakeCall(MakeClientInitialMetadata()), &status);
+    auto first = TickUntilCallStarted();
+    event_engine()->TickUntil(event_engine()->Now() + kBackendLatency);
+    auto hedge = PopStartedCall();
+    if (hedge.has_value()) ExpectCancelled(*hedge);
+    FinishAttempt(first, GRPC_STATUS_OK);
+    WaitForAllPendingWork();
+    EXPECT_EQ(status, GRPC_STATUS_OK);
+  }
+  std::optional<grpc_status_code> status;
+  StartUnaryCall(MakeCall(MakeClientInitialMetadata()), &status);
+  auto first = TickUntilCallStarted();
+  const auto start = Now();
+  auto hedge = TickUntilCallStarted();
+  EXPECT_GE(Now() - start, std::chrono::seconds(1));
+  ExpectCancelled(hedge);
+  FinishAttempt(first, GRPC_STATUS_OK);
+  WaitForAllPendingWork();
+  EXPECT_EQ(status, GRPC_STATUS_OK);
+}
+
 // TODO(roth, ctiller): more tests
 
 }  // namespace grpc_core
@@ -104,6 +104,25 @@ TEST(RetryThrottler, Replacement) {
   EXPECT_FALSE(throttler->RecordFailure());
 }
 
+TEST(RetryThrottler, IsThrottled) {
+  // Max token count is 4, so threshold for retrying is 2.
+  // Token count starts at 4.
+  // Each failure decrements by 1.  Each success increments by 1.
+  auto throttler = RetryThrottler::Create(4000, 1000, nullptr);
+  EXPECT_FALSE(throttler->IsThrottled());
+  // Failure: token_count=3.  Above threshold.
+  EXPECT_TRUE(throttler->RecordFailure());
+  EXPECT_FALSE(throttler->IsThrottled());
+  // Failure: token_count=2.  At threshold.
+  EXPECT_FALSE(throttler->RecordFailure());
+  EXPECT_TRUE(throttler->IsThrottled());
+  // Success: token_count=3.  Above threshold.
+  throttler->RecordSuccess();
+  EXPECT_FALSE(throttler->IsThrottled());
+  // Checking does not consume any tokens.
+  EXPECT_EQ(throttler->milli_tokens(), 3000);
+}
+
 }  // namespace
 }  // namespace internal
 }  // namespace grpc_core
@@ -70,6 +70,26 @@ TEST(SubchannelStreamLimiterTest, DecreaseLimit) {
   EXPECT_TRUE(limiter.ReturnQuotaForRpc());
 }
 
+TEST(SubchannelStreamLimiterTest, GetUsage) {
+  SubchannelStreamLimiter limiter(/*max_concurrent_streams=*/2);
+  auto usage = limiter.GetUsage();
+  EXPECT_EQ(usage.rpcs_in_flight, 0);
+  EXPECT_EQ(usage.max_concurrent_streams, 2);
+  EXPECT_TRUE(usage.HasQuota());
+  // Allocate all quota.
+  EXPECT_TRUE(limiter.GetQuotaForRpc());
+  EXPECT_TRUE(limiter.GetQuotaForRpc());
+  usage = limiter.GetUsage();
+  EXPECT_EQ(usage.rpcs_in_flight, 2);
+  EXPECT_FALSE(usage.HasQuota());
+  // Raising the limit gives more quota without changing the RPC count.
+  EXPECT_TRUE(limiter.SetMaxConcurrentStreams(3));
+  usage = limiter.GetUsage();
+  EXPECT_EQ(usage.rpcs_in_flight, 2);
+  EXPECT_EQ(usage.max_concurrent_streams, 3);
+  EXPECT_TRUE(usage.HasQuota());
+}
+
 }  // namespace
 }  // namespace grpc_core
 
@@ -0,0 +1,158 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/event_engine/posix_engine/tcp_info_sampler.h"
+
+#include <grpc/grpc.h>
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "src/core/lib/iomgr/port.h"
+#include "src/core/telemetry/instrument.h"
+#include "src/core/util/time.h"
+#include "test/core/test_util/test_config.h"
+#include "gtest/gtest.h"
+
+// This test won't work except with posix sockets enabled
+#ifdef GRPC_POSIX_SOCKET_TCP
+
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "src/core/lib/event_engine/default_event_engine.h"
+#include "src/core/lib/event_engine/posix_engine/posix_interface.h"
+
+namespace grpc_event_engine {
+namespace experimental {
+namespace {
+
+// A connected pair of loopback TCP sockets.
+class LoopbackConnection {
+ public:
+  LoopbackConnection() {
+    int listener = socket(AF_INET, SOCK_STREAM, 0);
+    EXPECT_GE(listener, 0);
+    sockaddr_in addr = {};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    socklen_t len = sizeof(addr);
+    EXPECT_EQ(bind(listener, reinterpret_cast<sockaddr*>(&addr), len), 0);
+    EXPECT_EQ(listen(listener, 1), 0);
+    EXPECT_EQ(getsockname(listener, reinterpret_cast<sockaddr*>(&addr), &len),
+              0);
+    client_ = socket(AF_INET, SOCK_STREAM, 0);
+    EXPECT_EQ(connect(client_, reinterpret_cast<sockaddr*>(&addr), len), 0);
+    server_ = accept(listener, nullptr, nullptr);
+    EXPECT_GE(server_, 0);
+    close(listener);
+  }
+  ~LoopbackConnection() {
+    close(client_);
+    close(server_);
+  }
+
+  int client() const { return client_; }
+
+ private:
+  int client_;
+  int server_;
+};
+
+grpc_core::InstrumentStorageRefPtr<grpc_core::TcpInfoMetricsDomain>
+TestStorage() {
+  return grpc_core::TcpInfoMetricsDomain::GetStorage(
+      grpc_core::GlobalCollectionScope(), "test_target");
+}
+
+TEST(TcpInfoSamplerTest, SamplersAreSharedPerInterval) {
+  auto* sampler = TcpInfoSampler::Get(grpc_core::Duration::Seconds(1));
+  EXPECT_EQ(sampler, TcpInfoSampler::Get(grpc_core::Duration::Seconds(1)));
+  EXPECT_NE(sampler, TcpInfoSampler::Get(grpc_core::Duration::Seconds(2)));
+  EXPECT_EQ(sampler->interval(), grpc_core::Duration::Seconds(1));
+}
+
+TEST(TcpInfoSamplerTest, RegistrationIsDroppedOnDestruction) {
+  LoopbackConnection connection;
+  EventEnginePosixInterface posix_interface;
+  auto* sampler = TcpInfoSampler::Get(grpc_core::Duration::Hours(1));
+  auto registration = sampler->Register(
+      GetDefaultEventEngine(), posix_interface.Adopt(connection.client()),
+      &posix_interface, TestStorage());
+  EXPECT_EQ(sampler->num_registered(), 1);
+  EXPECT_FALSE(registration->last_sample().has_value());
+  registration.reset();
+  EXPECT_EQ(sampler->num_registered(), 0);
+}
+
+TEST(TcpInfoSamplerTest, RegistrationsComeAndGoDuringSweeps) {
+  constexpr int kConnections = 8;
+  std::vector<LoopbackConnection> connections(kConnections);
+  EventEnginePosixInterface posix_interface;
+  auto* sampler = TcpInfoSampler::Get(grpc_core::Duration::Hours(1));
+  std::atomic<bool> done{false};
+  std::thread sweeper([&]() {
+    while (!done.load(std::memory_order_relaxed)) sampler->SampleAll();
+  });
+  for (int round = 0; round < 100; ++round) {
+    std::vector<std::unique_ptr<TcpInfoSampler::Registration>> registrations;
+    for (const auto& connection : connections) {
+      registrations.push_back(sampler->Register(
+          GetDefaultEventEngine(), posix_interface.Adopt(connection.client()),
+          &posix_interface, TestStorage()));
+    }
+    for (const auto& registration : registrations) {
+      registration->last_sample();
+    }
+  }
+  done.store(true, std::memory_order_relaxed);
+  sweeper.join();
+  EXPECT_EQ(sampler->num_registered(), 0);
+}
+
+#ifdef GRPC_LINUX_ERRQUEUE
+TEST(TcpInfoSamplerTest, SamplesEstablishedConnection) {
+  LoopbackConnection connection;
+  char byte = 0;
+  ASSERT_EQ(write(connection.client(), &byte, 1), 1);
+  EventEnginePosixInterface posix_interface;
+  auto* sampler = TcpInfoSampler::Get(grpc_core::Duration::Hours(1));
+  auto registration = sampler->Register(
+      GetDefaultEventEngine(), posix_interface.Adopt(connection.client()),
+      &posix_interface, TestStorage());
+  sampler->SampleAll();
+  auto sample = registration->last_sample();
+  ASSERT_TRUE(sample.has_value());
+  EXPECT_GT(sample->congestion_window_bytes, 0);
+  EXPECT_FALSE(sample->ToPropertyList().empty());
+}
+#endif  // GRPC_LINUX_ERRQUEUE
+
+}  // namespace
+}  // namespace experimental
+}  // namespace grpc_event_engine
+
+#endif  // GRPC_POSIX_SOCKET_TCP
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc_init();
+  int r = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return r;
+}
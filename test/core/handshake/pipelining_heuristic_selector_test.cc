@@ -0,0 +1,140 @@
+//
+//
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#include "src/core/handshaker/security/pipelining_heuristic_selector.h"
+
+#include <chrono>
+
+#include "gtest/gtest.h"
+
+namespace grpc_core {
+namespace {
+
+using HeuristicType = PipeliningHeuristicSelector::HeuristicType;
+
+constexpr size_t kReadSize = 64 * 1024;
+
+// Feeds the selector `n` reads of kReadSize bytes, each taking
+// `nanos_per_byte` to unprotect.
+void RecordReads(PipeliningHeuristicSelector& selector, int n,
+                 double nanos_per_byte) {
+  for (int i = 0; i < n; ++i) {
+    selector.RecordRead(kReadSize);
+    selector.RecordUnprotect(
+        kReadSize, std::chrono::nanoseconds(
+                       static_cast<int64_t>(nanos_per_byte * kReadSize)));
+  }
+}
+
+TEST(PipeliningHeuristicSelectorTest, ParseHeuristicType) {
+  EXPECT_EQ(PipeliningHeuristicSelector::ParseHeuristicType("moving_average"),
+            HeuristicType::kMovingAverage);
+  EXPECT_EQ(
+      PipeliningHeuristicSelector::ParseHeuristicType("consecutive_small_reads"),
+      HeuristicType::kConsecutiveSmallReads);
+  EXPECT_EQ(PipeliningHeuristicSelector::ParseHeuristicType("adaptive_cost"),
+            HeuristicType::kAdaptiveCost);
+  EXPECT_EQ(PipeliningHeuristicSelector::ParseHeuristicType("always_on"),
+            HeuristicType::kAlwaysOn);
+  EXPECT_EQ(PipeliningHeuristicSelector::ParseHeuristicType("always_off"),
+            HeuristicType::kAlwaysOff);
+  EXPECT_EQ(PipeliningHeuristicSelector::ParseHeuristicType("bogus"),
+            std::nullopt);
+}
+
+TEST(PipeliningHeuristicSelectorTest, OnlyAdaptiveCostWantsTimings) {
+  EXPECT_FALSE(PipeliningHeuristicSelector(HeuristicType::kMovingAverage)
+                   .WantsTimings());
+  EXPECT_TRUE(PipeliningHeuristicSelector(HeuristicType::kAdaptiveCost)
+                  .WantsTimings());
+}
+
+TEST(PipeliningHeuristicSelectorTest, AdaptiveCostStaysOffForCheapUnprotect) {
+  PipeliningHeuristicSelector selector(HeuristicType::kAdaptiveCost);
+  // 64KiB at 0.1ns/byte is ~6.5us of work: not worth a thread handoff.
+  RecordReads(selector, 100, 0.1);
+  EXPECT_FALSE(selector.IsPipeliningEnabled());
+}
+
+TEST(PipeliningHeuristicSelectorTest, AdaptiveCostEnablesForCostlyUnprotect) {
+  PipeliningHeuristicSelector selector(HeuristicType::kAdaptiveCost);
+  // 64KiB at 5ns/byte is ~330us of work per read.
+  RecordReads(selector, 100, 5);
+  EXPECT_TRUE(selector.IsPipeliningEnabled());
+  PipeliningTelemetry telemetry = selector.GetTelemetry();
+  EXPECT_EQ(telemetry.reads, 100u);
+  EXPECT_EQ(telemetry.bytes_read, 100u * kReadSize);
+  EXPECT_EQ(telemetry.transitions, 1u);
+  EXPECT_GT(telemetry.pipelined_reads, 0u);
+  ASSERT_TRUE(telemetry.unprotect_nanos_per_byte.has_value());
+  EXPECT_NEAR(*telemetry.unprotect_nanos_per_byte, 5, 0.01);
+}
+
+TEST(PipeliningHeuristicSelectorTest, AdaptiveCostDisablesWhenQueueIsSlow) {
+  PipeliningHeuristicSelector selector(HeuristicType::kAdaptiveCost);
+  RecordReads(selector, 100, 5);
+  ASSERT_TRUE(selector.IsPipeliningEnabled());
+  // An overloaded event engine makes the handoff more expensive than the work
+  // it saves.
+  for (int i = 0; i < 100; ++i) {
+    selector.RecordOffloadDelay(std::chrono::milliseconds(5));
+  }
+  RecordReads(selector, 1, 5);
+  EXPECT_FALSE(selector.IsPipeliningEnabled());
+  EXPECT_EQ(selector.GetTelemetry().transitions, 2u);
+}
+
+TEST(PipeliningHeuristicSelectorTest, AdaptiveCostRecoversFromSlowQueue) {
+  PipeliningHeuristicSelector selector(HeuristicType::kAdaptiveCost);
+  RecordReads(selector, 100, 5);
+  for (int i = 0; i < 100; ++i) {
+    selector.RecordOffloadDelay(std::chrono::milliseconds(5));
+  }
+  RecordReads(selector, 1, 5);
+  ASSERT_FALSE(selector.IsPipeliningEnabled());
+  // No offloaded reads run while pipelining is off, so the stale delay must
+  // fade on its own for pipelining to come back.
+  RecordReads(selector, 500, 5);
+  EXPECT_TRUE(selector.IsPipeliningEnabled());
+  EXPECT_EQ(selector.GetTelemetry().transitions, 3u);
+  // Offloaded reads that are fast again keep it on.
+  for (int i = 0; i < 100; ++i) {
+    selector.RecordOffloadDelay(std::chrono::microseconds(10));
+  }
+  RecordReads(selector, 100, 5);
+  EXPECT_TRUE(selector.IsPipeliningEnabled());
+  EXPECT_EQ(selector.GetTelemetry().transitions, 3u);
+}
+
+TEST(PipeliningHeuristicSelectorTest, TelemetryWithoutTimings) {
+  PipeliningHeuristicSelector selector(HeuristicType::kAlwaysOn);
+  EXPECT_FALSE(selector.RecordRead(10));
+  PipeliningTelemetry telemetry = selector.GetTelemetry();
+  EXPECT_EQ(telemetry.reads, 1u);
+  EXPECT_EQ(telemetry.pipelined_reads, 1u);
+  EXPECT_FALSE(telemetry.unprotect_nanos_per_byte.has_value());
+  EXPECT_FALSE(telemetry.offload_delay_nanos.has_value());
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
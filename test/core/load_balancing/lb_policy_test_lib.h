@@ -1233,6 +1233,39 @@ class LoadBalancingPolicyTest : public ::testing::Test {
         MakeEndpointAddressesListFromAddressList(addresses), location);
   }
 
+  // Sends an update with the given addresses, one per endpoint, and has all
+  // of their subchannels report CONNECTING.  Then makes the first num_ready
+  // of them READY, without checking the picks, and returns the last picker
+  // reported.  Useful for policies that do not pick in a fixed order.
+  RefCountedPtr<LoadBalancingPolicy::SubchannelPicker> StartWithReady(
+      absl::Span<const absl::string_view> addresses,
+      RefCountedPtr<LoadBalancingPolicy::Config> config, size_t num_ready,
+      SourceLocation location = SourceLocation()) {
+    EXPECT_EQ(ApplyUpdate(BuildUpdate(addresses, std::move(config)),
+                          lb_policy()),
+              absl::OkStatus())
+        << location.file() << ":" << location.line();
+    for (size_t i = 0; i < addresses.size(); ++i) {
+      auto* subchannel = FindSubchannel(addresses[i]);
+      EXPECT_NE(subchannel, nullptr)
+          << addresses[i] << "\n"
+          << location.file() << ":" << location.line();
+      if (subchannel == nullptr) return nullptr;
+      EXPECT_TRUE(subchannel->ConnectionRequested())
+          << location.file() << ":" << location.line();
+      subchannel->SetConnectivityState(GRPC_CHANNEL_CONNECTING);
+      if (i == 0) ExpectConnectingUpdate(location);
+    }
+    RefCountedPtr<LoadBalancingPolicy::SubchannelPicker> picker;
+    for (size_t i = 0; i < num_ready; ++i) {
+      FindSubchannel(addresses[i])->SetConnectivityState(GRPC_CHANNEL_READY);
+      picker = i == 0 ? WaitForConnected(location)
+                      : ExpectState(GRPC_CHANNEL_READY, absl::OkStatus(),
+                                    location);
+    }
+    return picker;
+  }
+
   // Expects zero or more picker updates, each of which returns
   // round-robin picks for the specified set of addresses.
   RefCountedPtr<LoadBalancingPolicy::SubchannelPicker>
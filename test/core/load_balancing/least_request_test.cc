@@ -0,0 +1,143 @@
+//
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <grpc/grpc.h>
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "src/core/config/core_configuration.h"
+#include "src/core/load_balancing/lb_policy.h"
+#include "src/core/util/json/json.h"
+#include "src/core/util/json/json_reader.h"
+#include "src/core/util/ref_counted_ptr.h"
+#include "test/core/load_balancing/lb_policy_test_lib.h"
+#include "test/core/test_util/test_config.h"
+#include "gtest/gtest.h"
+#include "absl/status/status.h"
+#include "absl/strings/string_view.h"
+
+namespace grpc_core {
+namespace testing {
+namespace {
+
+class LeastRequestTest : public LoadBalancingPolicyTest {
+ protected:
+  LeastRequestTest() : LoadBalancingPolicyTest("least_request_experimental") {}
+
+  static RefCountedPtr<LoadBalancingPolicy::Config> MakeLeastRequestConfig(
+      std::optional<int> choice_count = std::nullopt) {
+    Json::Object fields;
+    if (choice_count.has_value()) {
+      fields["choiceCount"] = Json::FromNumber(*choice_count);
+    }
+    return MakeConfig(Json::FromArray({Json::FromObject(
+        {{"least_request_experimental", Json::FromObject(fields)}})}));
+  }
+};
+
+TEST_F(LeastRequestTest, Basic) {
+  const std::array<absl::string_view, 3> kAddresses = {
+      "ipv4:127.0.0.1:441", "ipv4:127.0.0.1:442", "ipv4:127.0.0.1:443"};
+  auto picker =
+      StartWithReady(kAddresses, MakeLeastRequestConfig(), kAddresses.size());
+  // With no RPCs in flight, picks are spread across all endpoints.
+  auto picks = GetCompletePicks(picker.get(), 300);
+  ASSERT_TRUE(picks.has_value());
+  for (absl::string_view address : kAddresses) {
+    EXPECT_GT(std::count(picks->begin(), picks->end(), address), 50)
+        << address;
+  }
+}
+
+TEST_F(LeastRequestTest, PrefersEndpointWithFewerCallsInFlight) {
+  const std::array<absl::string_view, 2> kAddresses = {"ipv4:127.0.0.1:441",
+                                                       "ipv4:127.0.0.1:442"};
+  auto picker = StartWithReady(kAddresses, MakeLeastRequestConfig(), 1);
+  ASSERT_NE(picker, nullptr);
+  // Start 10 calls on the first endpoint and keep them in flight.
+  std::vector<
+      std::unique_ptr<LoadBalancingPolicy::SubchannelCallTrackerInterface>>
+      trackers;
+  auto picks = GetCompletePicks(picker.get(), 10, {}, &trackers);
+  ASSERT_TRUE(picks.has_value());
+  EXPECT_EQ(std::count(picks->begin(), picks->end(), kAddresses[0]), 10);
+  // Now the second endpoint becomes READY.  A pick only goes to the first
+  // endpoint if both choices land on it, which happens about a quarter of
+  // the time.
+  FindSubchannel(kAddresses[1])->SetConnectivityState(GRPC_CHANNEL_READY);
+  picker = ExpectState(GRPC_CHANNEL_READY);
+  picks = GetCompletePicks(picker.get(), 200);
+  ASSERT_TRUE(picks.has_value());
+  EXPECT_LT(std::count(picks->begin(), picks->end(), kAddresses[0]), 100);
+  // Once the in-flight calls finish, picks are balanced again.
+  for (auto& tracker : trackers) {
+    ReportCompletionToCallTracker(std::move(tracker), kAddresses[0]);
+  }
+  picks = GetCompletePicks(picker.get(), 200);
+  ASSERT_TRUE(picks.has_value());
+  EXPECT_GT(std::count(picks->begin(), picks->end(), kAddresses[0]), 50);
+  EXPECT_GT(std::count(picks->begin(), picks->end(), kAddresses[1]), 50);
+}
+
+TEST_F(LeastRequestTest, AbandonedPickDoesNotLeakInFlightCount) {
+  const std::array<absl::string_view, 2> kAddresses = {"ipv4:127.0.0.1:441",
+                                                       "ipv4:127.0.0.1:442"};
+  auto picker = StartWithReady(kAddresses, MakeLeastRequestConfig(), 1);
+  ASSERT_NE(picker, nullptr);
+  // Picks whose trackers are destroyed without Finish() being called, as
+  // happens when the call is cancelled before it is started, must not
+  // keep counting against the endpoint.
+  {
+    std::vector<
+        std::unique_ptr<LoadBalancingPolicy::SubchannelCallTrackerInterface>>
+        trackers;
+    ASSERT_TRUE(GetCompletePicks(picker.get(), 10, {}, &trackers).has_value());
+  }
+  FindSubchannel(kAddresses[1])->SetConnectivityState(GRPC_CHANNEL_READY);
+  picker = ExpectState(GRPC_CHANNEL_READY);
+  auto picks = GetCompletePicks(picker.get(), 200);
+  ASSERT_TRUE(picks.has_value());
+  EXPECT_GT(std::count(picks->begin(), picks->end(), kAddresses[0]), 50);
+  EXPECT_GT(std::count(picks->begin(), picks->end(), kAddresses[1]), 50);
+}
+
+TEST_F(LeastRequestTest, ChoiceCountMustBeAtLeastTwo) {
+  auto json = JsonParse(
+      "[{\"least_request_experimental\":{\"choiceCount\":1}}]");
+  ASSERT_TRUE(json.ok()) << json.status();
+  auto config =
+      CoreConfiguration::Get().lb_policy_registry().ParseLoadBalancingConfig(
+          *json);
+  EXPECT_EQ(config.status(),
+            absl::InvalidArgumentError(
+                "errors validating least_request LB policy config: ["
+                "field:choiceCount error:must be at least 2]"));
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc::testing::TestEnvironment env(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,177 @@
+//
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <grpc/grpc.h>
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "src/core/config/core_configuration.h"
+#include "src/core/load_balancing/lb_policy.h"
+#include "src/core/util/json/json.h"
+#include "src/core/util/json/json_reader.h"
+#include "src/core/util/ref_counted_ptr.h"
+#include "src/core/util/time.h"
+#include "test/core/load_balancing/lb_policy_test_lib.h"
+#include "test/core/test_util/test_config.h"
+#include "gtest/gtest.h"
+#include "absl/status/status.h"
+#include "absl/strings/string_view.h"
+
+namespace grpc_core {
+namespace testing {
+namespace {
+
+class PeakEwmaTest : public LoadBalancingPolicyTest {
+ protected:
+  PeakEwmaTest() : LoadBalancingPolicyTest("peak_ewma_experimental") {}
+
+  static RefCountedPtr<LoadBalancingPolicy::Config> MakePeakEwmaConfig(
+      Json::Object fields = {}) {
+    return MakeConfig(Json::FromArray({Json::FromObject(
+        {{"peak_ewma_experimental", Json::FromObject(std::move(fields))}})}));
+  }
+};
+
+TEST_F(PeakEwmaTest, Basic) {
+  const std::array<absl::string_view, 3> kAddresses = {
+      "ipv4:127.0.0.1:441", "ipv4:127.0.0.1:442", "ipv4:127.0.0.1:443"};
+  auto picker =
+      StartWithReady(kAddresses, MakePeakEwmaConfig(), kAddresses.size());
+  // With no latency samples yet, picks are spread across all endpoints.
+  auto picks = GetCompletePicks(picker.get(), 300);
+  ASSERT_TRUE(picks.has_value());
+  for (absl::string_view address : kAddresses) {
+    EXPECT_GT(std::count(picks->begin(), picks->end(), address), 50)
+        << address;
+  }
+}
+
+TEST_F(PeakEwmaTest, PrefersEndpointWithFewerCallsInFlight) {
+  const std::array<absl::string_view, 2> kAddresses = {"ipv4:127.0.0.1:441",
+                                                       "ipv4:127.0.0.1:442"};
+  auto picker = StartWithReady(kAddresses, MakePeakEwmaConfig(), 1);
+  // Start 5 calls on the first endpoint and keep them in flight.
+  std::vector<
+      std::unique_ptr<LoadBalancingPolicy::SubchannelCallTrackerInterface>>
+      trackers;
+  ASSERT_TRUE(GetCompletePicks(picker.get(), 5, {}, &trackers).has_value());
+  // Both endpoints start out with the same latency estimate, so the second
+  // endpoint is cheaper until it has as many calls in flight.
+  FindSubchannel(kAddresses[1])->SetConnectivityState(GRPC_CHANNEL_READY);
+  picker = ExpectState(GRPC_CHANNEL_READY);
+  auto picks = GetCompletePicks(picker.get(), 4, {}, &trackers);
+  ASSERT_TRUE(picks.has_value());
+  EXPECT_EQ(std::count(picks->begin(), picks->end(), kAddresses[1]), 4);
+}
+
+TEST_F(PeakEwmaTest, AvoidsSlowEndpoint) {
+  const std::array<absl::string_view, 2> kAddresses = {"ipv4:127.0.0.1:441",
+                                                       "ipv4:127.0.0.1:442"};
+  auto picker = StartWithReady(
+      kAddresses,
+      MakePeakEwmaConfig({{"defaultRtt", Json::FromString("0.001s")}}),
+      kAddresses.size());
+  // Get a pick for the first endpoint, and make that call slow.
+  std::unique_ptr<LoadBalancingPolicy::SubchannelCallTrackerInterface>
+      slow_tracker;
+  for (int i = 0; i < 100 && slow_tracker == nullptr; ++i) {
+    std::unique_ptr<LoadBalancingPolicy::SubchannelCallTrackerInterface>
+        tracker;
+    auto address = ExpectPickComplete(picker.get(), {}, {}, &tracker);
+    ASSERT_TRUE(address.has_value());
+    if (*address == kAddresses[0]) {
+      slow_tracker = std::move(tracker);
+    } else {
+      ReportCompletionToCallTracker(std::move(tracker), *address);
+    }
+  }
+  ASSERT_NE(slow_tracker, nullptr);
+  IncrementTimeBy(Duration::Milliseconds(50));
+  ReportCompletionToCallTracker(std::move(slow_tracker), kAddresses[0]);
+  slow_tracker.reset();
+  // The slow call raises the first endpoint's estimate to its latency right
+  // away, so picks now go to the second endpoint.
+  auto picks = GetCompletePicks(picker.get(), 100);
+  ASSERT_TRUE(picks.has_value());
+  EXPECT_LT(std::count(picks->begin(), picks->end(), kAddresses[0]), 10);
+}
+
+TEST_F(PeakEwmaTest, AvoidsEndpointThatStopsResponding) {
+  const std::array<absl::string_view, 2> kAddresses = {"ipv4:127.0.0.1:441",
+                                                       "ipv4:127.0.0.1:442"};
+  auto picker = StartWithReady(
+      kAddresses,
+      MakePeakEwmaConfig({{"defaultRtt", Json::FromString("0.001s")},
+                          {"decayTime", Json::FromString("0.02s")}}),
+      kAddresses.size());
+  // The first endpoint stops responding: calls sent to it never finish,
+  // while calls sent to the second finish right away.
+  std::vector<
+      std::unique_ptr<LoadBalancingPolicy::SubchannelCallTrackerInterface>>
+      hung_trackers;
+  auto send_calls = [&](size_t num_calls) {
+    size_t hung = 0;
+    for (size_t i = 0; i < num_calls; ++i) {
+      std::unique_ptr<LoadBalancingPolicy::SubchannelCallTrackerInterface>
+          tracker;
+      auto address = ExpectPickComplete(picker.get(), {}, {}, &tracker);
+      EXPECT_TRUE(address.has_value());
+      if (!address.has_value()) return hung;
+      if (*address == kAddresses[0]) {
+        hung_trackers.push_back(std::move(tracker));
+        ++hung;
+      } else {
+        ReportCompletionToCallTracker(std::move(tracker), *address);
+      }
+    }
+    return hung;
+  };
+  while (hung_trackers.empty()) send_calls(1);
+  // Wait for several decay times, so that without completions the first
+  // endpoint's latency estimate has decayed away.
+  IncrementTimeBy(Duration::Milliseconds(200));
+  // The calls stuck on the first endpoint keep it more expensive than the
+  // second one.
+  EXPECT_LT(send_calls(100), 5u);
+}
+
+TEST_F(PeakEwmaTest, DecayTimeMustBePositive) {
+  auto json =
+      JsonParse("[{\"peak_ewma_experimental\":{\"decayTime\":\"0s\"}}]");
+  ASSERT_TRUE(json.ok()) << json.status();
+  auto config =
+      CoreConfiguration::Get().lb_policy_registry().ParseLoadBalancingConfig(
+          *json);
+  EXPECT_EQ(config.status(),
+            absl::InvalidArgumentError(
+                "errors validating peak_ewma LB policy config: ["
+                "field:decayTime error:must be greater than 0]"));
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc::testing::TestEnvironment env(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,187 @@
+//
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+// Compares the ways ring_hash can map a request hash to an endpoint: a binary
+// search over the whole ring, the prefix-indexed ring lookup table, and a
+// Maglev table, both in pick latency and in the time to rebuild them.
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "src/core/load_balancing/ring_hash/ring_hash_lookup.h"
+#include "src/core/util/xxhash_inline.h"
+#include "absl/random/random.h"
+#include "absl/strings/str_cat.h"
+
+namespace grpc_core {
+namespace {
+
+constexpr int kNumEndpoints = 100;
+constexpr int kRingSizeLow = 1024;
+constexpr int kRingSizeHigh = 1024 * 1024;
+constexpr int kNumRequestHashes = 4096;
+
+struct RingEntry {
+  uint64_t hash;
+  size_t endpoint_index;
+};
+
+std::vector<std::string> HashKeys() {
+  std::vector<std::string> hash_keys;
+  for (int i = 0; i < kNumEndpoints; ++i) {
+    hash_keys.push_back(absl::StrCat("10.0.", i / 256, ".", i % 256, ":443"));
+  }
+  return hash_keys;
+}
+
+// Builds a ring the way ring_hash does for endpoints of equal weight.
+std::vector<RingEntry> BuildRing(const std::vector<std::string>& hash_keys,
+                                 size_t ring_size) {
+  std::vector<RingEntry> ring;
+  ring.reserve(ring_size);
+  for (size_t i = 0; i < ring_size; ++i) {
+    const size_t endpoint_index = i % hash_keys.size();
+    const std::string key =
+        absl::StrCat(hash_keys[endpoint_index], "_", i / hash_keys.size());
+    ring.push_back({XXH64(key.data(), key.size(), 0), endpoint_index});
+  }
+  std::sort(ring.begin(), ring.end(),
+            [](const RingEntry& lhs, const RingEntry& rhs) {
+              return lhs.hash < rhs.hash;
+            });
+  return ring;
+}
+
+RingHashLookupTable BuildLookupTable(const std::vector<RingEntry>& ring) {
+  std::vector<uint64_t> hashes;
+  hashes.reserve(ring.size());
+  for (const RingEntry& entry : ring) hashes.push_back(entry.hash);
+  return RingHashLookupTable(std::move(hashes));
+}
+
+std::vector<uint64_t> RequestHashes() {
+  absl::BitGen bit_gen;
+  std::vector<uint64_t> request_hashes;
+  for (int i = 0; i < kNumRequestHashes; ++i) {
+    request_hashes.push_back(absl::Uniform<uint64_t>(bit_gen));
+  }
+  return request_hashes;
+}
+
+void BM_RingBinarySearchPick(benchmark::State& state) {
+  const std::vector<RingEntry> ring = BuildRing(HashKeys(), state.range(0));
+  const std::vector<uint64_t> request_hashes = RequestHashes();
+  size_t i = 0;
+  for (auto _ : state) {
+    const uint64_t hash = request_hashes[i++ % request_hashes.size()];
+    auto it = std::lower_bound(ring.begin(), ring.end(), hash,
+                               [](const RingEntry& entry, uint64_t value) {
+                                 return entry.hash < value;
+                               });
+    if (it == ring.end()) it = ring.begin();
+    benchmark::DoNotOptimize(it->endpoint_index);
+  }
+}
+BENCHMARK(BM_RingBinarySearchPick)
+    ->RangeMultiplier(4)
+    ->Range(kRingSizeLow, kRingSizeHigh);
+
+void BM_RingLookupTablePick(benchmark::State& state) {
+  const std::vector<RingEntry> ring = BuildRing(HashKeys(), state.range(0));
+  const RingHashLookupTable table = BuildLookupTable(ring);
+  const std::vector<uint64_t> request_hashes = RequestHashes();
+  size_t i = 0;
+  for (auto _ : state) {
+    const uint64_t hash = request_hashes[i++ % request_hashes.size()];
+    benchmark::DoNotOptimize(ring[table.Find(hash)].endpoint_index);
+  }
+}
+BENCHMARK(BM_RingLookupTablePick)
+    ->RangeMultiplier(4)
+    ->Range(kRingSizeLow, kRingSizeHigh);
+
+void BM_MaglevPick(benchmark::State& state) {
+  const std::vector<std::string> hash_keys = HashKeys();
+  const std::vector<uint32_t> weights(hash_keys.size(), 1);
+  const std::vector<size_t> table = BuildMaglevTable(
+      hash_keys, weights, MaglevTableSize(state.range(0)));
+  const std::vector<uint64_t> request_hashes = RequestHashes();
+  size_t i = 0;
+  for (auto _ : state) {
+    const uint64_t hash = request_hashes[i++ % request_hashes.size()];
+    benchmark::DoNotOptimize(table[hash % table.size()]);
+  }
+}
+BENCHMARK(BM_MaglevPick)
+    ->RangeMultiplier(4)
+    ->Range(kRingSizeLow, kRingSizeHigh);
+
+void BM_RingBuild(benchmark::State& state) {
+  const std::vector<std::string> hash_keys = HashKeys();
+  for (auto _ : state) {
+    const std::vector<RingEntry> ring = BuildRing(hash_keys, state.range(0));
+    benchmark::DoNotOptimize(ring.data());
+  }
+}
+BENCHMARK(BM_RingBuild)
+    ->RangeMultiplier(4)
+    ->Range(kRingSizeLow, kRingSizeHigh);
+
+void BM_RingLookupTableBuild(benchmark::State& state) {
+  const std::vector<std::string> hash_keys = HashKeys();
+  for (auto _ : state) {
+    const std::vector<RingEntry> ring = BuildRing(hash_keys, state.range(0));
+    const RingHashLookupTable table = BuildLookupTable(ring);
+    benchmark::DoNotOptimize(&table);
+  }
+}
+BENCHMARK(BM_RingLookupTableBuild)
+    ->RangeMultiplier(4)
+    ->Range(kRingSizeLow, kRingSizeHigh);
+
+void BM_MaglevBuild(benchmark::State& state) {
+  const std::vector<std::string> hash_keys = HashKeys();
+  const std::vector<uint32_t> weights(hash_keys.size(), 1);
+  const size_t table_size = MaglevTableSize(state.range(0));
+  for (auto _ : state) {
+    const std::vector<size_t> table =
+        BuildMaglevTable(hash_keys, weights, table_size);
+    benchmark::DoNotOptimize(table.data());
+  }
+}
+BENCHMARK(BM_MaglevBuild)
+    ->RangeMultiplier(4)
+    ->Range(kRingSizeLow, kRingSizeHigh);
+
+}  // namespace
+}  // namespace grpc_core
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
@@ -0,0 +1,172 @@
+//
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include "src/core/load_balancing/ring_hash/ring_hash_lookup.h"
+
+#include <stdint.h>
+
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "absl/types/span.h"
+
+namespace grpc_core {
+namespace {
+
+// The owner of a request hash as found by a plain binary search.
+size_t FindByBinarySearch(const std::vector<uint64_t>& hashes, uint64_t hash) {
+  const size_t index =
+      std::lower_bound(hashes.begin(), hashes.end(), hash) - hashes.begin();
+  return index == hashes.size() ? 0 : index;
+}
+
+TEST(RingHashLookupTableTest, EmptyRing) {
+  RingHashLookupTable table({});
+  EXPECT_EQ(table.Find(0), 0);
+  EXPECT_EQ(table.Find(std::numeric_limits<uint64_t>::max()), 0);
+}
+
+TEST(RingHashLookupTableTest, Boundaries) {
+  const std::vector<uint64_t> hashes = {0, 100, 100, 1ull << 63,
+                                        std::numeric_limits<uint64_t>::max()};
+  RingHashLookupTable table(hashes);
+  EXPECT_EQ(table.Find(0), 0);
+  EXPECT_EQ(table.Find(1), 1);
+  EXPECT_EQ(table.Find(100), 1);
+  EXPECT_EQ(table.Find(101), 3);
+  EXPECT_EQ(table.Find(1ull << 63), 3);
+  EXPECT_EQ(table.Find((1ull << 63) + 1), 4);
+  EXPECT_EQ(table.Find(std::numeric_limits<uint64_t>::max()), 4);
+}
+
+TEST(RingHashLookupTableTest, WrapsAroundToFirstEntry) {
+  RingHashLookupTable table({10, 20, 30});
+  EXPECT_EQ(table.Find(5), 0);
+  EXPECT_EQ(table.Find(31), 0);
+  EXPECT_EQ(table.Find(std::numeric_limits<uint64_t>::max()), 0);
+}
+
+TEST(RingHashLookupTableTest, MatchesBinarySearch) {
+  std::mt19937_64 rng(0);
+  for (size_t ring_size : {1, 2, 3, 100, 1024, 4096, 100000}) {
+    std::vector<uint64_t> hashes;
+    for (size_t i = 0; i < ring_size; ++i) {
+      hashes.push_back(rng());
+    }
+    std::sort(hashes.begin(), hashes.end());
+    RingHashLookupTable table(hashes);
+    for (int i = 0; i < 10000; ++i) {
+      const uint64_t hash = rng();
+      ASSERT_EQ(table.Find(hash), FindByBinarySearch(hashes, hash))
+          << "ring_size=" << ring_size << " hash=" << hash;
+    }
+    // Also probe the ring hashes themselves and their neighbours.
+    for (uint64_t hash : hashes) {
+      ASSERT_EQ(table.Find(hash), FindByBinarySearch(hashes, hash));
+      ASSERT_EQ(table.Find(hash + 1), FindByBinarySearch(hashes, hash + 1));
+      ASSERT_EQ(table.Find(hash - 1), FindByBinarySearch(hashes, hash - 1));
+    }
+  }
+}
+
+TEST(MaglevTableSizeTest, RoundsUpToPrime) {
+  EXPECT_EQ(MaglevTableSize(0), 2);
+  EXPECT_EQ(MaglevTableSize(2), 2);
+  EXPECT_EQ(MaglevTableSize(4), 5);
+  EXPECT_EQ(MaglevTableSize(1024), 1031);
+  EXPECT_EQ(MaglevTableSize(65537), 65537);
+}
+
+std::vector<std::string> MakeHashKeys(size_t num_endpoints) {
+  std::vector<std::string> hash_keys;
+  for (size_t i = 0; i < num_endpoints; ++i) {
+    hash_keys.push_back("10.0.0." + std::to_string(i) + ":443");
+  }
+  return hash_keys;
+}
+
+std::vector<size_t> CountSlots(const std::vector<size_t>& table,
+                               size_t num_endpoints) {
+  std::vector<size_t> counts(num_endpoints);
+  for (size_t endpoint_index : table) {
+    EXPECT_LT(endpoint_index, num_endpoints);
+    if (endpoint_index < num_endpoints) ++counts[endpoint_index];
+  }
+  return counts;
+}
+
+TEST(BuildMaglevTableTest, NoEndpoints) {
+  EXPECT_TRUE(BuildMaglevTable({}, {}, 7).empty());
+}
+
+TEST(BuildMaglevTableTest, EqualWeightsSplitSlotsEvenly) {
+  constexpr size_t kNumEndpoints = 10;
+  const size_t table_size = MaglevTableSize(1000);
+  const std::vector<std::string> hash_keys = MakeHashKeys(kNumEndpoints);
+  const std::vector<uint32_t> weights(kNumEndpoints, 1);
+  const std::vector<size_t> table =
+      BuildMaglevTable(hash_keys, weights, table_size);
+  ASSERT_EQ(table.size(), table_size);
+  for (size_t count : CountSlots(table, kNumEndpoints)) {
+    EXPECT_GE(count, table_size / kNumEndpoints);
+    EXPECT_LE(count, table_size / kNumEndpoints + 1);
+  }
+}
+
+TEST(BuildMaglevTableTest, SlotsFollowWeights) {
+  const size_t table_size = MaglevTableSize(6000);
+  const std::vector<std::string> hash_keys = MakeHashKeys(3);
+  const std::vector<uint32_t> weights = {1, 2, 3};
+  const std::vector<size_t> counts =
+      CountSlots(BuildMaglevTable(hash_keys, weights, table_size), 3);
+  EXPECT_NEAR(counts[0], table_size / 6, 2);
+  EXPECT_NEAR(counts[1], table_size / 3, 2);
+  EXPECT_NEAR(counts[2], table_size / 2, 2);
+}
+
+TEST(BuildMaglevTableTest, RemovingEndpointMovesFewSlots) {
+  constexpr size_t kNumEndpoints = 20;
+  const size_t table_size = MaglevTableSize(4096);
+  std::vector<std::string> hash_keys = MakeHashKeys(kNumEndpoints);
+  const std::vector<uint32_t> weights(kNumEndpoints, 1);
+  const std::vector<size_t> before =
+      BuildMaglevTable(hash_keys, weights, table_size);
+  // Remove the last endpoint, so that the remaining indexes are unchanged.
+  hash_keys.pop_back();
+  const std::vector<size_t> after = BuildMaglevTable(
+      hash_keys, absl::MakeConstSpan(weights).subspan(1), table_size);
+  size_t moved = 0;
+  for (size_t slot = 0; slot < table_size; ++slot) {
+    if (before[slot] != kNumEndpoints - 1 && before[slot] != after[slot]) {
+      ++moved;
+    }
+  }
+  // Only the removed endpoint's slots have to move; Maglev keeps the extra
+  // disruption to a small fraction of the table.
+  EXPECT_LT(moved, table_size / 10);
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -28,6 +28,7 @@
 #include <vector>
 
 #include "src/core/load_balancing/lb_policy.h"
+#include "src/core/load_balancing/ring_hash/ring_hash_lookup.h"
 #include "src/core/resolver/endpoint_addresses.h"
 #include "src/core/util/json/json.h"
 #include "src/core/util/ref_counted_ptr.h"
@@ -356,6 +357,41 @@ TEST_F(RingHashTest, EndpointHashKeys) {
   EXPECT_EQ(address, kAddresses[1]);
 }
 
+TEST_F(RingHashTest, Maglev) {
+  const std::array<absl::string_view, 3> kAddresses = {
+      "ipv4:127.0.0.1:441", "ipv4:127.0.0.1:442", "ipv4:127.0.0.1:443"};
+  const ChannelArgs args =
+      ChannelArgs().Set(GRPC_ARG_RING_HASH_LB_USE_MAGLEV, true);
+  EXPECT_EQ(ApplyUpdate(BuildUpdate(kAddresses, MakeRingHashConfig(), args),
+                        lb_policy()),
+            absl::OkStatus());
+  // The default min ring size of 1024 is rounded up to a prime.
+  const std::vector<size_t> table = BuildMaglevTable(
+      {"127.0.0.1:441", "127.0.0.1:442", "127.0.0.1:443"}, {1, 1, 1},
+      MaglevTableSize(1024));
+  ASSERT_EQ(table.size(), 1031);
+  // Find a hash owned by the second endpoint.
+  uint64_t hash = 0;
+  while (table[hash % table.size()] != 1) ++hash;
+  attribute_storage_.emplace_back(std::make_unique<RequestHashAttribute>(hash));
+  auto* hash_attribute = attribute_storage_.back().get();
+  auto picker = ExpectState(GRPC_CHANNEL_IDLE);
+  ExpectPickQueued(picker.get(), {hash_attribute});
+  WaitForWorkSerializerToFlush();
+  WaitForWorkSerializerToFlush();
+  auto* subchannel = FindSubchannel(kAddresses[1]);
+  ASSERT_NE(subchannel, nullptr);
+  EXPECT_TRUE(subchannel->ConnectionRequested());
+  EXPECT_EQ(nullptr, FindSubchannel(kAddresses[0]));
+  EXPECT_EQ(nullptr, FindSubchannel(kAddresses[2]));
+  subchannel->SetConnectivityState(GRPC_CHANNEL_CONNECTING);
+  picker = ExpectState(GRPC_CHANNEL_CONNECTING);
+  subchannel->SetConnectivityState(GRPC_CHANNEL_READY);
+  picker = ExpectState(GRPC_CHANNEL_READY);
+  auto address = ExpectPickComplete(picker.get(), {hash_attribute});
+  EXPECT_EQ(address, kAddresses[1]);
+}
+
 TEST_F(RingHashTest, PickFailsWithoutRequestHashAttribute) {
   const std::array<absl::string_view, 3> kAddresses = {
       "ipv4:127.0.0.1:441", "ipv4:127.0.0.1:442", "ipv4:127.0.0.1:443"};
@@ -0,0 +1,337 @@
+//
+//
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+// Measures what idle connections and idle streams cost.
+//
+// The client and server share this process, so that transports without a
+// network endpoint (inproc) are measured the same way as the others.  Each
+// side gets its own resource quota: the quota figures are split by side,
+// while RSS covers the whole process.
+
+#include <grpc/credentials.h>
+#include <grpc/grpc.h>
+#include <grpc/grpc_security.h>
+#include <grpc/impl/channel_arg_names.h>
+#include <grpc/impl/propagation_bits.h>
+#include <grpc/slice.h>
+#include <grpc/support/time.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "src/core/ext/transport/chaotic_good/chaotic_good.h"
+#include "src/core/ext/transport/inproc/inproc_transport.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/resource_quota/resource_quota.h"
+#include "src/core/transport/endpoint_transport.h"
+#include "src/core/util/grpc_check.h"
+#include "test/core/end2end/data/ssl_test_data.h"
+#include "test/core/memory_usage/memstats.h"
+#include "test/core/test_util/port.h"
+#include "test/core/test_util/resolve_localhost_ip46.h"
+#include "test/core/test_util/test_config.h"
+#include "absl/flags/flag.h"
+#include "absl/flags/parse.h"
+#include "absl/log/log.h"
+
+ABSL_FLAG(int, connections, 100, "Number of idle connections");
+ABSL_FLAG(int, streams_per_connection, 10,
+          "Number of idle streams to open on each connection");
+ABSL_FLAG(bool, secure, false, "Use security");
+ABSL_FLAG(bool, minstack, false, "Use minimal stack");
+ABSL_FLAG(bool, chaotic_good, false, "Use chaotic good");
+ABSL_FLAG(bool, inproc, false, "Use the in-process transport");
+ABSL_FLAG(bool, channelz, true, "Enable channelz on both sides");
+ABSL_FLAG(int, hpack_table_size, -1,
+          "If non-negative, the HPACK table size both sides use");
+ABSL_FLAG(std::string, results_file, "",
+          "Where to write the figures, one 'name value' pair per line");
+
+static grpc_completion_queue* cq;
+static grpc_server* server;
+
+// Tags for the completion queue: streams are tagged with their index, shifted
+// so that they can't collide with these.
+enum : intptr_t {
+  kWatchTag = 1,
+  kShutdownTag,
+  kFirstStreamTag,
+};
+
+static void* tag(intptr_t t) { return reinterpret_cast<void*>(t); }
+
+struct IdleStream {
+  // Client side.
+  grpc_call* client_call = nullptr;
+  grpc_metadata_array initial_metadata_recv;
+  // Server side.
+  grpc_call* server_call = nullptr;
+  grpc_call_details call_details;
+  grpc_metadata_array request_metadata_recv;
+};
+
+struct Sample {
+  long rss_kb;
+  size_t client_quota;
+  size_t server_quota;
+};
+
+static Sample TakeSample(grpc_core::ResourceQuota* client_quota,
+                         grpc_core::ResourceQuota* server_quota) {
+  return Sample{MemStats::Snapshot().rss,
+                client_quota->memory_quota()->InstantaneousUsage(),
+                server_quota->memory_quota()->InstantaneousUsage()};
+}
+
+static grpc_core::ChannelArgs CommonArgs() {
+  grpc_core::ChannelArgs args =
+      grpc_core::ChannelArgs().Set(GRPC_ARG_ENABLE_CHANNELZ,
+                                   absl::GetFlag(FLAGS_channelz));
+  if (absl::GetFlag(FLAGS_minstack)) {
+    args = args.Set(GRPC_ARG_MINIMAL_STACK, true);
+  }
+  const int hpack_table_size = absl::GetFlag(FLAGS_hpack_table_size);
+  if (hpack_table_size >= 0) {
+    args = args.Set(GRPC_ARG_HTTP2_HPACK_TABLE_SIZE_DECODER, hpack_table_size)
+               .Set(GRPC_ARG_HTTP2_HPACK_TABLE_SIZE_ENCODER, hpack_table_size);
+  }
+  if (absl::GetFlag(FLAGS_chaotic_good)) {
+    args = args.Set(GRPC_ARG_PREFERRED_TRANSPORT_PROTOCOLS,
+                    grpc_core::chaotic_good::WireFormatPreferences());
+  }
+  return args;
+}
+
+// Waits until `channel` is connected.
+static void WaitForReady(grpc_channel* channel) {
+  grpc_connectivity_state state =
+      grpc_channel_check_connectivity_state(channel, /*try_to_connect=*/1);
+  while (state != GRPC_CHANNEL_READY) {
+    grpc_channel_watch_connectivity_state(channel, state,
+                                          grpc_timeout_seconds_to_deadline(30),
+                                          cq, tag(kWatchTag));
+    grpc_event ev = grpc_completion_queue_next(
+        cq, gpr_inf_future(GPR_CLOCK_REALTIME), nullptr);
+    GRPC_CHECK(ev.type == GRPC_OP_COMPLETE);
+    GRPC_CHECK(ev.tag == tag(kWatchTag));
+    GRPC_CHECK(ev.success) << "timed out connecting";
+    state = grpc_channel_check_connectivity_state(channel, 1);
+  }
+}
+
+// Opens a stream on `channel` and leaves it open with initial metadata
+// exchanged in both directions.  Completions are left on the queue.
+static void StartIdleStream(grpc_channel* channel, IdleStream* stream,
+                            intptr_t stream_tag) {
+  grpc_metadata_array_init(&stream->request_metadata_recv);
+  grpc_call_details_init(&stream->call_details);
+  GRPC_CHECK(GRPC_CALL_OK ==
+             grpc_server_request_call(server, &stream->server_call,
+                                      &stream->call_details,
+                                      &stream->request_metadata_recv, cq, cq,
+                                      tag(stream_tag)));
+  grpc_metadata_array_init(&stream->initial_metadata_recv);
+  grpc_slice method = grpc_slice_from_static_string("/memory_usage/Idle");
+  stream->client_call = grpc_channel_create_call(
+      channel, nullptr, GRPC_PROPAGATE_DEFAULTS, cq, method, nullptr,
+      gpr_inf_future(GPR_CLOCK_REALTIME), nullptr);
+  grpc_op ops[2] = {};
+  ops[0].op = GRPC_OP_SEND_INITIAL_METADATA;
+  ops[0].flags = GRPC_INITIAL_METADATA_WAIT_FOR_READY;
+  ops[1].op = GRPC_OP_RECV_INITIAL_METADATA;
+  ops[1].data.recv_initial_metadata.recv_initial_metadata =
+      &stream->initial_metadata_recv;
+  GRPC_CHECK(GRPC_CALL_OK == grpc_call_start_batch(stream->client_call, ops,
+                                                   2, nullptr, nullptr));
+}
+
+// Drains the queue until every stream is open on both sides.
+static void AwaitIdleStreams(std::vector<IdleStream>& streams) {
+  // Each stream completes a server request and a server batch, both tagged
+  // with the stream, and an untagged client batch.
+  size_t pending = 3 * streams.size();
+  std::vector<bool> accepted(streams.size(), false);
+  while (pending > 0) {
+    grpc_event ev = grpc_completion_queue_next(
+        cq, gpr_inf_future(GPR_CLOCK_REALTIME), nullptr);
+    GRPC_CHECK(ev.type == GRPC_OP_COMPLETE);
+    GRPC_CHECK(ev.success);
+    --pending;
+    if (ev.tag == nullptr) continue;
+    const size_t i = reinterpret_cast<intptr_t>(ev.tag) - kFirstStreamTag;
+    GRPC_CHECK_LT(i, streams.size());
+    if (accepted[i]) continue;
+    accepted[i] = true;
+    grpc_op op = {};
+    op.op = GRPC_OP_SEND_INITIAL_METADATA;
+    GRPC_CHECK(GRPC_CALL_OK == grpc_call_start_batch(streams[i].server_call,
+                                                     &op, 1, ev.tag, nullptr));
+  }
+}
+
+static void DestroyIdleStream(IdleStream* stream) {
+  grpc_call_cancel(stream->client_call, nullptr);
+  grpc_call_unref(stream->client_call);
+  grpc_call_cancel(stream->server_call, nullptr);
+  grpc_call_unref(stream->server_call);
+  grpc_metadata_array_destroy(&stream->initial_metadata_recv);
+  grpc_metadata_array_destroy(&stream->request_metadata_recv);
+  grpc_call_details_destroy(&stream->call_details);
+}
+
+int main(int argc, char** argv) {
+  absl::ParseCommandLine(argc, argv);
+  grpc::testing::TestEnvironment env(&argc, argv);
+  grpc_init();
+
+  const int num_connections = absl::GetFlag(FLAGS_connections);
+  const int streams_per_connection =
+      absl::GetFlag(FLAGS_streams_per_connection);
+  const bool inproc = absl::GetFlag(FLAGS_inproc);
+  GRPC_CHECK_GT(num_connections, 0);
+  GRPC_CHECK(!inproc || !absl::GetFlag(FLAGS_secure))
+      << "inproc has no security to configure";
+
+  auto client_quota = grpc_core::MakeResourceQuota("memory_usage_client");
+  auto server_quota = grpc_core::MakeResourceQuota("memory_usage_server");
+  cq = grpc_completion_queue_create_for_next(nullptr);
+
+  server = grpc_server_create(
+      CommonArgs().SetObject(server_quota).ToC().get(), nullptr);
+  grpc_server_register_completion_queue(server, cq, nullptr);
+  const std::string addr =
+      grpc_core::LocalIpAndPort(grpc_pick_unused_port_or_die());
+  if (!inproc) {
+    grpc_server_credentials* server_creds;
+    if (absl::GetFlag(FLAGS_secure)) {
+      grpc_ssl_pem_key_cert_pair pem_key_cert_pair = {test_server1_key,
+                                                      test_server1_cert};
+      server_creds = grpc_ssl_server_credentials_create(
+          nullptr, &pem_key_cert_pair, 1, 0, nullptr);
+    } else {
+      server_creds = grpc_insecure_server_credentials_create();
+    }
+    GRPC_CHECK(grpc_server_add_http2_port(server, addr.c_str(), server_creds));
+    grpc_server_credentials_release(server_creds);
+  }
+  grpc_server_start(server);
+
+  // Every channel gets its own subchannel, and so its own connection.
+  grpc_core::ChannelArgs client_args =
+      CommonArgs()
+          .SetObject(client_quota)
+          .Set(GRPC_ARG_USE_LOCAL_SUBCHANNEL_POOL, true)
+          .Set(GRPC_ARG_ENABLE_RETRIES, false);
+  grpc_channel_credentials* client_creds;
+  if (absl::GetFlag(FLAGS_secure)) {
+    client_args =
+        client_args.Set(GRPC_SSL_TARGET_NAME_OVERRIDE_ARG, "foo.test.google.fr");
+    client_creds =
+        grpc_ssl_credentials_create(test_root_cert, nullptr, nullptr, nullptr);
+  } else {
+    client_creds = grpc_insecure_credentials_create();
+  }
+
+  const Sample baseline = TakeSample(client_quota.get(), server_quota.get());
+
+  std::vector<grpc_channel*> channels;
+  channels.reserve(num_connections);
+  for (int i = 0; i < num_connections; ++i) {
+    if (inproc) {
+      channels.push_back(
+          grpc_inproc_channel_create(server, client_args.ToC().get(), nullptr));
+    } else {
+      channels.push_back(grpc_channel_create(addr.c_str(), client_creds,
+                                             client_args.ToC().get()));
+      WaitForReady(channels.back());
+    }
+  }
+  // Give handshakes and settings exchanges time to finish.
+  gpr_sleep_until(grpc_timeout_seconds_to_deadline(1));
+  const Sample connected = TakeSample(client_quota.get(), server_quota.get());
+
+  std::vector<IdleStream> streams(num_connections * streams_per_connection);
+  for (size_t i = 0; i < streams.size(); ++i) {
+    StartIdleStream(channels[i / streams_per_connection], &streams[i],
+                    kFirstStreamTag + i);
+  }
+  AwaitIdleStreams(streams);
+  gpr_sleep_until(grpc_timeout_seconds_to_deadline(1));
+  const Sample streaming = TakeSample(client_quota.get(), server_quota.get());
+
+  for (auto& stream : streams) DestroyIdleStream(&stream);
+  for (grpc_channel* channel : channels) grpc_channel_destroy(channel);
+  grpc_channel_credentials_release(client_creds);
+  grpc_server_shutdown_and_notify(server, cq, tag(kShutdownTag));
+  grpc_server_cancel_all_calls(server);
+  grpc_completion_queue_shutdown(cq);
+  while (grpc_completion_queue_next(cq, gpr_inf_future(GPR_CLOCK_REALTIME),
+                                    nullptr)
+             .type != GRPC_QUEUE_SHUTDOWN) {
+  }
+  grpc_server_destroy(server);
+  grpc_completion_queue_destroy(cq);
+  grpc_shutdown_blocking();
+
+  // Quota figures are already in bytes; RSS is in kb.
+  auto per = [](double delta, size_t n) {
+    return n == 0 ? 0.0 : delta / static_cast<double>(n);
+  };
+  const size_t num_streams = streams.size();
+  const std::vector<std::pair<std::string, double>> figures = {
+      {"connection_rss",
+       per((connected.rss_kb - baseline.rss_kb) * 1024.0, num_connections)},
+      {"connection_client_quota",
+       per(static_cast<double>(connected.client_quota) -
+               static_cast<double>(baseline.client_quota),
+           num_connections)},
+      {"connection_server_quota",
+       per(static_cast<double>(connected.server_quota) -
+               static_cast<double>(baseline.server_quota),
+           num_connections)},
+      {"stream_rss",
+       per((streaming.rss_kb - connected.rss_kb) * 1024.0, num_streams)},
+      {"stream_client_quota",
+       per(static_cast<double>(streaming.client_quota) -
+               static_cast<double>(connected.client_quota),
+           num_streams)},
+      {"stream_server_quota",
+       per(static_cast<double>(streaming.server_quota) -
+               static_cast<double>(connected.server_quota),
+           num_streams)},
+  };
+  for (const auto& figure : figures) {
+    LOG(INFO) << figure.first << ": " << figure.second << " bytes";
+  }
+  const std::string results_file = absl::GetFlag(FLAGS_results_file);
+  if (!results_file.empty()) {
+    std::ofstream out(results_file);
+    for (const auto& figure : figures) {
+      out << figure.first << " " << figure.second << "\n";
+    }
+    if (!out) {
+      fprintf(stderr, "failed to write %s\n", results_file.c_str());
+      return 1;
+    }
+  }
+  return 0;
+}
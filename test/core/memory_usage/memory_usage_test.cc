@@ -17,6 +17,7 @@
 //
 
 #include <grpc/grpc.h>
+#include <grpc/support/alloc.h>
 #include <grpc/support/time.h>
 #include <grpcpp/security/server_credentials.h>
 #include <grpcpp/server.h>
@@ -26,10 +27,13 @@
 #include <string.h>
 
 #include <algorithm>
+#include <cstdio>
+#include <fstream>
 #include <iterator>
 #include <limits>
 #include <map>
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -40,6 +44,7 @@
 #include "src/core/config/config_vars.h"
 #include "src/core/util/env.h"
 #include "src/core/util/subprocess.h"
+#include "src/core/util/tmpfile.h"
 #include "test/core/test_util/port.h"
 #include "test/core/test_util/resolve_localhost_ip46.h"
 #include "test/core/test_util/test_config.h"
@@ -58,21 +63,36 @@ using grpc::testing::XdsResourceUtils;
 
 // Default all benchmarks in order to trigger CI testing for each one
 ABSL_FLAG(std::string, benchmark_names, "",
-          "Which benchmark to run.  If empty, defaults to 'call,channel' "
+          "Which benchmark to run.  If empty, defaults to 'call,channel,idle' "
           "if --use_xds is false, or 'call,channel,channel_multi_address' "
-          "if --use_xds is true.");
+          "if --use_xds is true.  Scenarios that can't span processes only "
+          "run 'idle'.");
 
 ABSL_FLAG(int, size, 1000, "Number of channels/calls");
 ABSL_FLAG(
     std::string, scenario_config, "insecure",
     "Possible Values: minstack (Use minimal stack), resource_quota, insecure, "
-    "secure (Use SSL credentials on server), chaotic_good");
+    "secure (Use SSL credentials on server), chaotic_good, ph2 (Use the "
+    "promise based HTTP/2 transport), secure_ph2, inproc");
 ABSL_FLAG(bool, memory_profiling, false,
           "Run memory profiling");  // TODO (chennancy) Connect this flag
 ABSL_FLAG(bool, use_xds, false, "Use xDS");
+ABSL_FLAG(int, idle_connections, 100,
+          "Number of connections the idle benchmark holds open");
+ABSL_FLAG(int, idle_streams_per_connection, 10,
+          "Number of streams the idle benchmark holds open per connection");
 
 // TODO(roth, ctiller): Add support for multiple addresses per channel.
 
+struct ScenarioArgs {
+  std::vector<std::string> client;
+  std::vector<std::string> server;
+  // Flags for memory_usage_idle, which hosts both sides in one process.
+  std::vector<std::string> idle;
+  // False for transports that only work within a process.
+  bool cross_process = true;
+};
+
 class Subprocess {
  public:
   explicit Subprocess(std::vector<std::string> args) {
@@ -197,6 +217,94 @@ int RunChannelBenchmark(const std::vector<int>& server_ports, char* root) {
   return retval;
 }
 
+// Runs memory_usage_idle once and returns the per connection and per stream
+// figures it reports, in bytes.
+std::optional<std::map<std::string, double>> RunIdleProcess(
+    char* root, const std::vector<std::string>& scenario_flags,
+    std::vector<std::string> variant_flags) {
+  char* results_file = nullptr;
+  FILE* f = gpr_tmpfile("memory_usage_idle", &results_file);
+  if (f == nullptr) return std::nullopt;
+  fclose(f);
+  std::vector<std::string> flags = {
+      absl::StrCat(root, "/memory_usage_idle",
+                   gpr_subprocess_binary_extension()),
+      "--grpc_experiments",
+      std::string(grpc_core::ConfigVars::Get().Experiments()),
+      absl::StrCat("--connections=", absl::GetFlag(FLAGS_idle_connections)),
+      absl::StrCat("--streams_per_connection=",
+                   absl::GetFlag(FLAGS_idle_streams_per_connection)),
+      absl::StrCat("--results_file=", results_file)};
+  absl::c_copy(scenario_flags, std::back_inserter(flags));
+  absl::c_move(variant_flags, std::back_inserter(flags));
+  int status;
+  {
+    Subprocess idle(flags);
+    status = idle.Join();
+  }
+  std::map<std::string, double> figures;
+  std::ifstream in(results_file);
+  std::string name;
+  double value;
+  while (in >> name >> value) figures[name] = value;
+  in.close();
+  remove(results_file);
+  gpr_free(results_file);
+  if (status != 0 || figures.empty()) {
+    printf("memory_usage_idle failed with: %d\n", status);
+    return std::nullopt;
+  }
+  return figures;
+}
+
+// Per idle connection and per idle stream benchmark.
+//
+// Memory quota accounting gives each side's reservations, which for an idle
+// connection are mostly endpoint and transport buffers, and for an idle stream
+// mostly the call arenas.  Components that are not charged to the quota are
+// measured by turning them off and comparing RSS.
+int RunIdleBenchmark(char* root, const ScenarioArgs& scenario) {
+  auto base = RunIdleProcess(root, scenario.idle, {});
+  if (!base.has_value()) return 1;
+  auto without_channelz = RunIdleProcess(root, scenario.idle, {"--nochannelz"});
+  if (!without_channelz.has_value()) return 1;
+  // Only the HTTP/2 transports have HPACK tables.
+  std::optional<std::map<std::string, double>> without_hpack;
+  if (!absl::c_linear_search(scenario.idle, "--chaotic_good") &&
+      !absl::c_linear_search(scenario.idle, "--inproc")) {
+    without_hpack =
+        RunIdleProcess(root, scenario.idle, {"--hpack_table_size=0"});
+    if (!without_hpack.has_value()) return 1;
+  }
+
+  struct Unit {
+    const char* name;
+    // What dominates the quota figures for this unit.
+    const char* quota_contents;
+  };
+  for (const Unit& unit : {Unit{"connection", "endpoint buffers, transport"},
+                           Unit{"stream", "arenas"}}) {
+    auto figure = [&unit](std::map<std::string, double>& figures,
+                          absl::string_view name) {
+      return figures[absl::StrCat(unit.name, "_", name)];
+    };
+    printf("---------idle %s stats--------\n", unit.name);
+    printf("idle %s memory usage: %f bytes per %s\n", unit.name,
+           figure(*base, "rss"), unit.name);
+    printf("  client quota (%s): %f bytes\n", unit.quota_contents,
+           figure(*base, "client_quota"));
+    printf("  server quota (%s): %f bytes\n", unit.quota_contents,
+           figure(*base, "server_quota"));
+    printf("  channelz: %f bytes\n",
+           figure(*base, "rss") - figure(*without_channelz, "rss"));
+    if (without_hpack.has_value()) {
+      printf("  hpack tables: %f bytes\n",
+             figure(*base, "rss") - figure(*without_hpack, "rss"));
+    }
+  }
+  return 0;
+}
+
 struct XdsServer {
   std::shared_ptr<grpc::testing::AdsServiceImpl> ads_service;
   std::unique_ptr<grpc::Server> server;
@@ -252,9 +360,14 @@ XdsServer StartXdsServerAndConfigureBootstrap(
 }
 
 int RunBenchmark(char* root, absl::string_view benchmark,
-                 std::vector<std::string> server_scenario_flags,
-                 std::vector<std::string> client_scenario_flags) {
+                 const ScenarioArgs& scenario) {
   LOG(INFO) << "running benchmark: " << benchmark;
+  if (benchmark == "idle") return RunIdleBenchmark(root, scenario);
+  if (!scenario.cross_process) {
+    LOG(INFO) << "Benchmark " << benchmark
+              << " needs a transport that spans processes";
+    return 4;
+  }
   const size_t num_ports = benchmark == "channel_multi_address" ? 10 : 1;
   std::vector<int> server_ports;
   server_ports.reserve(num_ports);
@@ -268,8 +381,8 @@ int RunBenchmark(char* root, absl::string_view benchmark,
   }
   int retval;
   if (benchmark == "call") {
-    retval = RunCallBenchmark(server_ports[0], root, server_scenario_flags,
-                              client_scenario_flags);
+    retval = RunCallBenchmark(server_ports[0], root, scenario.server,
+                              scenario.client);
   } else if (benchmark == "channel" || benchmark == "channel_multi_address") {
     retval = RunChannelBenchmark(server_ports, root);
   } else {
@@ -298,17 +411,31 @@ int main(int argc, char** argv) {
   }
 
   // Set configurations based off scenario_config
-  struct ScenarioArgs {
-    std::vector<std::string> client;
-    std::vector<std::string> server;
+  // The ph2 experiments are added to whatever experiments we were given.
+  const std::string experiments(grpc_core::ConfigVars::Get().Experiments());
+  auto with_experiments = [&experiments](absl::string_view extra) {
+    return absl::StrCat("--grpc_experiments=", experiments,
+                        experiments.empty() ? "" : ",", extra);
   };
+  const std::string ph2_client = with_experiments("ph2_client");
+  const std::string ph2_server = with_experiments("ph2_server");
+  const std::string ph2_both = with_experiments("ph2_client,ph2_server");
   // TODO(chennancy): add in resource quota parameter setting later
   const std::map<std::string /*scenario*/, ScenarioArgs> scenarios = {
-      {"secure", {/*client=*/{}, /*server=*/{"--secure"}}},
-      {"resource_quota", {/*client=*/{}, /*server=*/{"--secure"}}},
-      {"minstack", {/*client=*/{"--minstack"}, /*server=*/{"--minstack"}}},
-      {"insecure", {{}, {}}},
-      {"chaotic_good", {{"--chaotic_good"}, {"--chaotic_good"}}}};
+      {"secure",
+       {/*client=*/{}, /*server=*/{"--secure"}, /*idle=*/{"--secure"}}},
+      {"resource_quota",
+       {/*client=*/{}, /*server=*/{"--secure"}, /*idle=*/{"--secure"}}},
+      {"minstack",
+       {/*client=*/{"--minstack"}, /*server=*/{"--minstack"},
+        /*idle=*/{"--minstack"}}},
+      {"insecure", {{}, {}, {}}},
+      {"chaotic_good",
+       {{"--chaotic_good"}, {"--chaotic_good"}, {"--chaotic_good"}}},
+      {"ph2", {{ph2_client}, {ph2_server}, {ph2_both}}},
+      {"secure_ph2",
+       {{ph2_client}, {"--secure", ph2_server}, {"--secure", ph2_both}}},
+      {"inproc", {{}, {}, {"--inproc"}, /*cross_process=*/false}}};
   auto it_scenario = scenarios.find(absl::GetFlag(FLAGS_scenario_config));
   if (it_scenario == scenarios.end()) {
     printf("No scenario matching the name could be found\n");
@@ -319,15 +446,18 @@ int main(int argc, char** argv) {
   // scenario)
   std::string benchmark_names = absl::GetFlag(FLAGS_benchmark_names);
   if (benchmark_names.empty()) {
-    benchmark_names = absl::GetFlag(FLAGS_use_xds)
-                          ? "call,channel,channel_multi_address"
-                          : "call,channel";
+    if (!it_scenario->second.cross_process) {
+      benchmark_names = "idle";
+    } else if (absl::GetFlag(FLAGS_use_xds)) {
+      benchmark_names = "call,channel,channel_multi_address";
+    } else {
+      benchmark_names = "call,channel,idle";
+    }
   }
   auto benchmarks = absl::StrSplit(benchmark_names, ',');
   grpc_init();
   for (const auto& benchmark : benchmarks) {
-    int r = RunBenchmark(root, benchmark, it_scenario->second.server,
-                         it_scenario->second.client);
+    int r = RunBenchmark(root, benchmark, it_scenario->second);
     if (r != 0) return r;
   }
   grpc_shutdown();
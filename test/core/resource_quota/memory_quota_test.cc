@@ -151,6 +151,19 @@ TEST(MemoryQuotaTest, ReserveRangeNoPressure) {
   memory_allocator.Release(total);
 }
 
+TEST(MemoryQuotaTest, InstantaneousUsageTracksReservations) {
+  ExecCtx exec_ctx;
+  MemoryQuota memory_quota(MakeRefCounted<channelz::ResourceQuotaNode>("foo"));
+  auto memory_allocator = memory_quota.CreateMemoryAllocator("bar");
+  const size_t before = memory_quota.InstantaneousUsage();
+  auto n = memory_allocator.Reserve(MemoryRequest(40000));
+  EXPECT_GE(memory_quota.InstantaneousUsage(), before + n);
+  // Resizing the quota moves free bytes, not taken ones.
+  memory_quota.SetSize(1024 * 1024 * 1024);
+  EXPECT_GE(memory_quota.InstantaneousUsage(), before + n);
+  memory_allocator.Release(n);
+}
+
 TEST(MemoryQuotaTest, MakeSlice) {
   MemoryQuota memory_quota(MakeRefCounted<channelz::ResourceQuotaNode>("foo"));
   auto memory_allocator = memory_quota.CreateMemoryAllocator("bar");
@@ -15,6 +15,7 @@
 #include <benchmark/benchmark.h>
 
 #include <random>
+#include <string>
 #include <thread>
 
 #include "src/core/telemetry/instrument.h"
@@ -38,6 +39,21 @@ class HighContentionDomain : public InstrumentDomain<HighContentionDomain> {
   GRPC_EMPTY_INSTRUMENT_DOMAIN_LABELS();
   static inline const auto kCounter =
       RegisterCounter("high_contention", "Desc", "unit");
+  static inline const auto kHistogram =
+      RegisterHistogram<ExponentialHistogramShape>("high_contention_histogram",
+                                                   "Desc", "unit", 1024, 20);
+};
+
+class PerCpuDomain : public InstrumentDomain<PerCpuDomain> {
+ public:
+  using Backend = PerCpuBackend;
+  static constexpr absl::string_view kName = "per_cpu";
+  GRPC_EMPTY_INSTRUMENT_DOMAIN_LABELS();
+  static inline const auto kCounter =
+      RegisterCounter("per_cpu", "Desc", "unit");
+  static inline const auto kHistogram =
+      RegisterHistogram<ExponentialHistogramShape>("per_cpu_histogram", "Desc",
+                                                   "unit", 1024, 20);
 };
 
 void BM_IncrementLowContentionInstrument(benchmark::State& state) {
@@ -57,6 +73,69 @@ void BM_IncrementHighContentionInstrument(benchmark::State& state) {
 }
 BENCHMARK(BM_IncrementHighContentionInstrument)->ThreadRange(1, 64);
 
+void BM_IncrementPerCpuInstrument(benchmark::State& state) {
+  auto storage = PerCpuDomain::GetStorage(CreateCollectionScope({}, {}));
+  for (auto _ : state) {
+    storage->Increment(PerCpuDomain::kCounter);
+  }
+}
+BENCHMARK(BM_IncrementPerCpuInstrument)->ThreadRange(1, 64);
+
+void BM_IncrementHighContentionHistogram(benchmark::State& state) {
+  auto storage =
+      HighContentionDomain::GetStorage(CreateCollectionScope({}, {}));
+  int64_t value = state.thread_index();
+  for (auto _ : state) {
+    storage->Increment(HighContentionDomain::kHistogram, value);
+    value = (value + 37) % 1024;
+  }
+}
+BENCHMARK(BM_IncrementHighContentionHistogram)->ThreadRange(1, 64);
+
+void BM_IncrementPerCpuHistogram(benchmark::State& state) {
+  auto storage = PerCpuDomain::GetStorage(CreateCollectionScope({}, {}));
+  int64_t value = state.thread_index();
+  for (auto _ : state) {
+    storage->Increment(PerCpuDomain::kHistogram, value);
+    value = (value + 37) % 1024;
+  }
+}
+BENCHMARK(BM_IncrementPerCpuHistogram)->ThreadRange(1, 64);
+
+// Reads pay for the sharding: a query sums every shard.
+void BM_QueryPerCpuInstrument(benchmark::State& state) {
+  class NullSink final : public MetricsSink {
+   public:
+    void Counter(InstrumentLabelList, absl::Span<const std::string>,
+                 absl::string_view, uint64_t value) override {
+      benchmark::DoNotOptimize(value);
+    }
+    void UpDownCounter(InstrumentLabelList, absl::Span<const std::string>,
+                       absl::string_view, uint64_t) override {}
+    void Histogram(InstrumentLabelList, absl::Span<const std::string>,
+                   absl::string_view, HistogramBuckets,
+                   absl::Span<const uint64_t> counts) override {
+      benchmark::DoNotOptimize(counts.data());
+    }
+    void DoubleGauge(InstrumentLabelList, absl::Span<const std::string>,
+                     absl::string_view, double) override {}
+    void IntGauge(InstrumentLabelList, absl::Span<const std::string>,
+                  absl::string_view, int64_t) override {}
+    void UintGauge(InstrumentLabelList, absl::Span<const std::string>,
+                   absl::string_view, uint64_t) override {}
+  };
+  auto scope = CreateCollectionScope({}, {});
+  auto storage = PerCpuDomain::GetStorage(scope);
+  storage->Increment(PerCpuDomain::kCounter);
+  NullSink sink;
+  for (auto _ : state) {
+    MetricsQuery()
+        .OnlyMetrics({"per_cpu", "per_cpu_histogram"})
+        .Run(scope, sink);
+  }
+}
+BENCHMARK(BM_QueryPerCpuInstrument);
+
 }  // namespace
 }  // namespace grpc_core
 
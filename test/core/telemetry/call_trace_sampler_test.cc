@@ -0,0 +1,96 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/telemetry/call_trace_sampler.h"
+
+#include "src/core/util/time.h"
+#include "test/core/test_util/test_config.h"
+#include "gtest/gtest.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+
+namespace grpc_core {
+namespace {
+
+// Records a millisecond of tracing work.
+void SpendTracingTime(CallTraceSampler& sampler) {
+  CallTraceSampler::CostScope cost(&sampler);
+  absl::SleepFor(absl::Milliseconds(1));
+}
+
+TEST(CallTraceSamplerTest, TracesEveryCallInitially) {
+  CallTraceSampler sampler(0.01);
+  EXPECT_EQ(sampler.rate(), 1.0);
+  for (int i = 0; i < 1000; ++i) {
+    EXPECT_TRUE(sampler.ShouldSample());
+  }
+}
+
+TEST(CallTraceSamplerTest, WaitsForAdjustPeriod) {
+  CallTraceSampler sampler(1e-9);
+  SpendTracingTime(sampler);
+  sampler.MaybeAdjustRate(Timestamp::Now());
+  EXPECT_EQ(sampler.rate(), 1.0);
+}
+
+TEST(CallTraceSamplerTest, BacksOffWhenOverBudget) {
+  CallTraceSampler sampler(1e-9);
+  SpendTracingTime(sampler);
+  sampler.MaybeAdjustRate(Timestamp::Now() + CallTraceSampler::AdjustPeriod());
+  // A millisecond of work against a nanosecond budget takes the rate as
+  // low as it goes.
+  EXPECT_EQ(sampler.rate(), CallTraceSampler::MinRate());
+  int sampled = 0;
+  for (int i = 0; i < 100000; ++i) {
+    if (sampler.ShouldSample()) ++sampled;
+  }
+  EXPECT_LT(sampled, 100);
+}
+
+TEST(CallTraceSamplerTest, RecoversGraduallyWhenIdle) {
+  CallTraceSampler sampler(1e-9);
+  SpendTracingTime(sampler);
+  Timestamp now = Timestamp::Now() + CallTraceSampler::AdjustPeriod();
+  sampler.MaybeAdjustRate(now);
+  ASSERT_EQ(sampler.rate(), CallTraceSampler::MinRate());
+  now += CallTraceSampler::AdjustPeriod();
+  sampler.MaybeAdjustRate(now);
+  EXPECT_EQ(sampler.rate(), 2 * CallTraceSampler::MinRate());
+  now += CallTraceSampler::AdjustPeriod();
+  sampler.MaybeAdjustRate(now);
+  EXPECT_EQ(sampler.rate(), 4 * CallTraceSampler::MinRate());
+}
+
+TEST(CallTraceSamplerTest, RateNeverExceedsOne) {
+  CallTraceSampler sampler(1.0);
+  Timestamp now = Timestamp::Now();
+  for (int i = 0; i < 3; ++i) {
+    now += CallTraceSampler::AdjustPeriod();
+    sampler.MaybeAdjustRate(now);
+    EXPECT_EQ(sampler.rate(), 1.0);
+  }
+}
+
+TEST(CallTraceSamplerTest, NullCostScopeIsNoOp) {
+  CallTraceSampler::CostScope cost(nullptr);
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -130,6 +130,21 @@ class HighContentionDomain final
       RegisterCounter("high_contention", "Desc", "unit");
 };
 
+class PerCpuDomain final : public InstrumentDomain<PerCpuDomain> {
+ public:
+  using Backend = PerCpuBackend;
+  static constexpr absl::string_view kName = "per_cpu";
+  GRPC_EMPTY_INSTRUMENT_DOMAIN_LABELS();
+
+  static inline const auto kCounter =
+      RegisterCounter("per_cpu", "Desc", "unit");
+  static inline const auto kHistogram =
+      RegisterHistogram<ExponentialHistogramShape>("per_cpu_histogram", "Desc",
+                                                   "unit", 1024, 20);
+  static inline const auto kUpDownCounter =
+      RegisterUpDownCounter("per_cpu_up_down", "Desc", "unit");
+};
+
 class LowContentionDomain final : public InstrumentDomain<LowContentionDomain> {
  public:
   using Backend = LowContentionBackend;
@@ -295,6 +310,62 @@ TEST_F(MetricsQueryTest, HighContention) {
   MetricsQuery().OnlyMetrics({"high_contention"}).Run(scope, sink);
 }
 
+// Tests a per-CPU domain updated from many threads.  Verifies that the
+// shards are summed when queried, including for histogram buckets that live
+// on different cache lines and for up-down counters that are incremented
+// and decremented on different threads.
+TEST_F(MetricsQueryTest, PerCpu) {
+  auto scope = CreateCollectionScope({}, {});
+  auto storage = PerCpuDomain::GetStorage(scope);
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 8; ++i) {
+    threads.emplace_back([&storage]() {
+      for (int j = 0; j < 1000; ++j) {
+        storage->Increment(PerCpuDomain::kCounter);
+        storage->Increment(PerCpuDomain::kHistogram, 0);
+        storage->Increment(PerCpuDomain::kHistogram, 1 << 20);
+        storage->Increment(PerCpuDomain::kUpDownCounter);
+      }
+    });
+    threads.emplace_back([&storage]() {
+      for (int j = 0; j < 500; ++j) {
+        storage->Increment(PerCpuDomain::kUpDownCounter);
+        storage->Decrement(PerCpuDomain::kUpDownCounter);
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+  ::testing::StrictMock<MockMetricsSink> sink;
+  EXPECT_CALL(
+      sink,
+      Counter(InstrumentLabelListElementsAreArray(std::vector<std::string>{}),
+              ::testing::ElementsAreArray(absl::Span<const std::string>()),
+              "per_cpu", 8000));
+  EXPECT_CALL(sink, UpDownCounter(InstrumentLabelListElementsAreArray(
+                                      std::vector<std::string>{}),
+                                  ::testing::ElementsAreArray(
+                                      absl::Span<const std::string>()),
+                                  "per_cpu_up_down", 8000));
+  std::vector<uint64_t> counts;
+  EXPECT_CALL(sink, Histogram(InstrumentLabelListElementsAreArray(
+                                  std::vector<std::string>{}),
+                              ::testing::ElementsAreArray(
+                                  absl::Span<const std::string>()),
+                              "per_cpu_histogram", ::testing::_, ::testing::_))
+      .WillOnce([&counts](auto, auto, auto, auto, auto c) {
+        counts.assign(c.begin(), c.end());
+      });
+  MetricsQuery()
+      .OnlyMetrics({"per_cpu", "per_cpu_up_down", "per_cpu_histogram"})
+      .Run(scope, sink);
+  ASSERT_GT(counts.size(), 8);
+  EXPECT_EQ(counts.front(), 8000);
+  EXPECT_EQ(counts.back(), 8000);
+  uint64_t total = 0;
+  for (uint64_t count : counts) total += count;
+  EXPECT_EQ(total, 16000);
+}
+
 // Tests basic counter functionality in a low-contention domain (one label).
 // Verifies that increments are recorded for the correct label and that storage
 // is reset after being released.
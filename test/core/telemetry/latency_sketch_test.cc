@@ -0,0 +1,92 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/telemetry/latency_sketch.h"
+
+#include <optional>
+
+#include "src/core/util/time.h"
+#include "gtest/gtest.h"
+
+namespace grpc_core {
+namespace {
+
+TEST(LatencySketchTest, NoSamples) {
+  LatencySketch sketch;
+  EXPECT_EQ(sketch.Percentile(50, 0), std::nullopt);
+}
+
+TEST(LatencySketchTest, NeedsMinSamples) {
+  LatencySketch sketch;
+  for (int i = 0; i < 9; ++i) sketch.Record(Duration::Milliseconds(10));
+  EXPECT_EQ(sketch.Percentile(50, 10), std::nullopt);
+  sketch.Record(Duration::Milliseconds(10));
+  EXPECT_NE(sketch.Percentile(50, 10), std::nullopt);
+}
+
+TEST(LatencySketchTest, PercentileIsWithinOneBucket) {
+  LatencySketch sketch;
+  // 1ms, 2ms, ..., 100ms.
+  for (int i = 1; i <= 100; ++i) sketch.Record(Duration::Milliseconds(i));
+  auto p50 = sketch.Percentile(50, 0);
+  ASSERT_TRUE(p50.has_value());
+  EXPECT_GT(*p50, Duration::Milliseconds(50));
+  EXPECT_LE(*p50, Duration::Milliseconds(50 * 1.15));
+  auto p95 = sketch.Percentile(95, 0);
+  ASSERT_TRUE(p95.has_value());
+  EXPECT_GT(*p95, Duration::Milliseconds(95));
+  EXPECT_LE(*p95, Duration::Milliseconds(95 * 1.15));
+}
+
+TEST(LatencySketchTest, OutOfRangeSamples) {
+  LatencySketch sketch;
+  sketch.Record(Duration::Hours(1));
+  EXPECT_EQ(sketch.Percentile(50, 0),
+            Duration::Milliseconds(LatencySketch::kMaxMillis));
+  LatencySketch sketch2;
+  sketch2.Record(Duration::Milliseconds(-5));
+  auto p50 = sketch2.Percentile(50, 0);
+  ASSERT_TRUE(p50.has_value());
+  EXPECT_LE(*p50, Duration::Milliseconds(2));
+}
+
+TEST(LatencySketchTest, FollowsShiftInLatency) {
+  LatencySketch sketch;
+  for (uint64_t i = 0; i < 2 * LatencySketch::kDecaySamples; ++i) {
+    sketch.Record(Duration::Milliseconds(10));
+  }
+  auto p50 = sketch.Percentile(50, 0);
+  ASSERT_TRUE(p50.has_value());
+  EXPECT_LE(*p50, Duration::Milliseconds(12));
+  // Latency goes up.  Since old samples decay, it takes fewer new samples
+  // than were ever recorded before for the median to follow.
+  for (uint64_t i = 0; i < 2 * LatencySketch::kDecaySamples; ++i) {
+    sketch.Record(Duration::Milliseconds(200));
+  }
+  p50 = sketch.Percentile(50, 0);
+  ASSERT_TRUE(p50.has_value());
+  EXPECT_GT(*p50, Duration::Milliseconds(200));
+  // But the old samples still show up in the lower percentiles.
+  auto p10 = sketch.Percentile(10, 0);
+  ASSERT_TRUE(p10.has_value());
+  EXPECT_LE(*p10, Duration::Milliseconds(12));
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -104,10 +104,8 @@ class FakeCallTracer final : public CallTracerInterface {
 }  // namespace grpc_core
 
 grpc_slice EncodeHeaderIntoBytes(
-    bool is_eof,
+    grpc_core::HPackCompressor* compressor, bool is_eof,
     const std::vector<std::pair<std::string, std::string>>& header_fields) {
-  std::unique_ptr<grpc_core::HPackCompressor> compressor =
-      std::make_unique<grpc_core::HPackCompressor>();
   grpc_metadata_batch b;
 
   for (const auto& field : header_fields) {
@@ -135,6 +133,13 @@ grpc_slice EncodeHeaderIntoBytes(
   return ret;
 }
 
+grpc_slice EncodeHeaderIntoBytes(
+    bool is_eof,
+    const std::vector<std::pair<std::string, std::string>>& header_fields) {
+  grpc_core::HPackCompressor compressor;
+  return EncodeHeaderIntoBytes(&compressor, is_eof, header_fields);
+}
+
 // verify that the output generated by encoding the stream matches the
 // hexstring passed in
 static void verify(
@@ -167,6 +172,15 @@ MATCHER(HasLiteralHeaderFieldNewNameFlagIncrementalIndexing, "") {
           kLiteralHeaderFieldNewNameFlagIncrementalIndexing);
 }
 
+MATCHER(HasIndexedHeaderField, "") {
+  constexpr size_t kHttp2FrameHeaderSize = 9u;
+  /// Reference: https://httpwg.org/specs/rfc7541.html#rfc.section.6.1
+  /// The first byte of an indexed header field has its high bit set.
+  constexpr uint8_t kIndexedHeaderFieldFlag = 0x80;
+  return (GRPC_SLICE_START_PTR(arg)[kHttp2FrameHeaderSize] &
+          kIndexedHeaderFieldFlag) == kIndexedHeaderFieldFlag;
+}
+
 MATCHER(HasLiteralHeaderFieldNewNameFlagNoIndexing, "") {
   constexpr size_t kHttp2FrameHeaderSize = 9u;
   /// Reference: https://httpwg.org/specs/rfc7541.html#rfc.section.6.2.2
@@ -249,6 +263,27 @@ TEST(HpackEncoderTest, UserAgentMetadataNoIndexing) {
   grpc_slice_unref(encoded_header);
 }
 
+TEST(HpackEncoderTest, ReleaseCachedValuesStopsIndexedEncoding) {
+  grpc_core::ExecCtx exec_ctx;
+  grpc_core::HPackCompressor compressor;
+  const std::vector<std::pair<std::string, std::string>> header_fields = {
+      {grpc_core::UserAgentMetadata::key().data(), "value"}};
+
+  grpc_slice first = EncodeHeaderIntoBytes(&compressor, false, header_fields);
+  EXPECT_THAT(first, HasLiteralHeaderFieldNewNameFlagIncrementalIndexing());
+  grpc_slice_unref(first);
+
+  // The value is in the dynamic table now, so it is sent as an index.
+  grpc_slice second = EncodeHeaderIntoBytes(&compressor, false, header_fields);
+  EXPECT_THAT(second, HasIndexedHeaderField());
+  grpc_slice_unref(second);
+
+  compressor.ReleaseCachedValues();
+  grpc_slice third = EncodeHeaderIntoBytes(&compressor, false, header_fields);
+  EXPECT_THAT(third, HasLiteralHeaderFieldNewNameFlagIncrementalIndexing());
+  grpc_slice_unref(third);
+}
+
 static void verify_continuation_headers(const char* key, const char* value,
                                         bool is_eof) {
   grpc_core::MemoryAllocator memory_allocator =
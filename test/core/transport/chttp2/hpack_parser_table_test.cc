@@ -22,6 +22,7 @@
 
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/slice/slice.h"
@@ -126,7 +127,7 @@ TEST(HpackParserTableTest, ManyAdditions) {
             std::move(key_slice), std::move(value_slice),
             key.length() + value.length() + 32),
         nullptr};
-    ASSERT_TRUE(tbl.Add(std::move(memento)));
+    ASSERT_TRUE(tbl.Add(std::move(memento), value));
     AssertIndex(&tbl, 1 + hpack_constants::kLastStaticEntry, key.c_str(),
                 value.c_str());
     if (i) {
@@ -144,6 +145,129 @@ TEST(HpackParserTableTest, ManyAdditions) {
   EXPECT_EQ(stats_after->http2_hpack_misses, stats_before->http2_hpack_misses);
 }
 
+TEST(HpackParserTableTest, OlderEntriesAreRebuiltOnLookup) {
+  HPackTable tbl;
+
+  ExecCtx exec_ctx;
+
+  // Lengths vary so that entries wrap around the end of the table's storage
+  // at different points.
+  std::vector<std::pair<std::string, std::string>> added;
+  for (int i = 0; i < 1000; i++) {
+    std::string key = absl::StrCat("key-", std::string(i % 7, 'k'), i);
+    std::string value = absl::StrCat(std::string(i % 31, 'v'), i);
+    auto memento = HPackTable::Memento{
+        ParsedMetadata<grpc_metadata_batch>(
+            ParsedMetadata<grpc_metadata_batch>::FromSlicePair{},
+            Slice::FromCopiedString(key), Slice::FromCopiedString(value),
+            key.length() + value.length() + 32),
+        nullptr};
+    ASSERT_TRUE(tbl.Add(std::move(memento), value));
+    added.emplace_back(std::move(key), std::move(value));
+    // Look up every entry, oldest first, so most have to be rebuilt from the
+    // stored bytes.
+    for (uint32_t j = tbl.num_entries(); j > 0; j--) {
+      const auto& [expected_key, expected_value] = added[added.size() - j];
+      AssertIndex(&tbl, j + hpack_constants::kLastStaticEntry,
+                  expected_key.c_str(), expected_value.c_str());
+    }
+  }
+  EXPECT_LE(tbl.test_only_bytes_capacity(), hpack_constants::kInitialTableSize);
+}
+
+TEST(HpackParserTableTest, MementosAreKeptOnlyForLookedUpEntries) {
+  HPackTable tbl;
+
+  ExecCtx exec_ctx;
+
+  auto add = [&tbl](int i) {
+    std::string key = absl::StrCat("k", i);
+    std::string value = absl::StrCat("v", i);
+    auto memento = HPackTable::Memento{
+        ParsedMetadata<grpc_metadata_batch>(
+            ParsedMetadata<grpc_metadata_batch>::FromSlicePair{},
+            Slice::FromCopiedString(key), Slice::FromCopiedString(value),
+            key.length() + value.length() + 32),
+        nullptr};
+    ASSERT_TRUE(tbl.Add(std::move(memento), value));
+  };
+  for (int i = 0; i < 32; i++) add(i);
+  EXPECT_EQ(tbl.test_only_materialized_capacity(), 0u);
+
+  // First lookups only need room for a few mementos.
+  for (uint32_t j = 1; j <= 32; j++) {
+    AssertIndex(&tbl, j + hpack_constants::kLastStaticEntry,
+                absl::StrCat("k", 32 - j).c_str(),
+                absl::StrCat("v", 32 - j).c_str());
+  }
+  EXPECT_GT(tbl.test_only_materialized_capacity(), 0u);
+  EXPECT_LT(tbl.test_only_materialized_capacity(), 32u);
+  EXPECT_EQ(tbl.test_only_num_kept_mementos(), 0u);
+
+  // Entries looked up again keep their mementos, so later lookups return
+  // the same parsed memento rather than parsing the entry again.
+  std::vector<const HPackTable::Memento*> kept;
+  for (uint32_t j = 1; j <= 32; j++) {
+    kept.push_back(tbl.Lookup(j + hpack_constants::kLastStaticEntry));
+  }
+  EXPECT_EQ(tbl.test_only_num_kept_mementos(), 32u);
+  for (int round = 0; round < 8; round++) {
+    for (uint32_t j = 1; j <= 32; j++) {
+      EXPECT_EQ(tbl.Lookup(j + hpack_constants::kLastStaticEntry),
+                kept[j - 1]);
+      AssertIndex(&tbl, j + hpack_constants::kLastStaticEntry,
+                  absl::StrCat("k", 32 - j).c_str(),
+                  absl::StrCat("v", 32 - j).c_str());
+    }
+  }
+
+  // Adding an entry evicts nothing here, and does not disturb them.
+  add(32);
+  EXPECT_EQ(tbl.test_only_num_kept_mementos(), 32u);
+  EXPECT_EQ(tbl.Lookup(2 + hpack_constants::kLastStaticEntry), kept[0]);
+
+  tbl.SetMaxBytes(0);
+  EXPECT_EQ(tbl.test_only_materialized_capacity(), 0u);
+  EXPECT_EQ(tbl.test_only_num_kept_mementos(), 0u);
+}
+
+TEST(HpackParserTableTest, ShrinkingReleasesStorage) {
+  HPackTable tbl;
+
+  ExecCtx exec_ctx;
+
+  for (int i = 0; i < 10; i++) {
+    std::string key = absl::StrCat("K.", i);
+    std::string value = absl::StrCat("VALUE.", i);
+    auto memento = HPackTable::Memento{
+        ParsedMetadata<grpc_metadata_batch>(
+            ParsedMetadata<grpc_metadata_batch>::FromSlicePair{},
+            Slice::FromCopiedString(key), Slice::FromCopiedString(value),
+            key.length() + value.length() + 32),
+        nullptr};
+    ASSERT_TRUE(tbl.Add(std::move(memento), value));
+  }
+  EXPECT_GE(tbl.test_only_capacity(), 10u);
+
+  tbl.SetMaxBytes(0);
+  EXPECT_EQ(tbl.num_entries(), 0u);
+  EXPECT_EQ(tbl.test_only_table_size(), 0u);
+  EXPECT_EQ(tbl.test_only_capacity(), 0u);
+  EXPECT_EQ(tbl.test_only_bytes_capacity(), 0u);
+
+  // The table is usable again once the limit is raised.
+  tbl.SetMaxBytes(hpack_constants::kInitialTableSize);
+  ASSERT_TRUE(tbl.SetCurrentTableSize(hpack_constants::kInitialTableSize));
+  auto memento = HPackTable::Memento{
+      ParsedMetadata<grpc_metadata_batch>(
+          ParsedMetadata<grpc_metadata_batch>::FromSlicePair{},
+          Slice::FromCopiedString("key"), Slice::FromCopiedString("value"),
+          3 + 5 + 32),
+      nullptr};
+  ASSERT_TRUE(tbl.Add(std::move(memento), "value"));
+  AssertIndex(&tbl, 1 + hpack_constants::kLastStaticEntry, "key", "value");
+}
+
 TEST(HpackParserTableTest, ManyUnusedAdditions) {
   auto tbl = std::make_unique<HPackTable>();
   int i;
@@ -164,7 +288,7 @@ TEST(HpackParserTableTest, ManyUnusedAdditions) {
             std::move(key_slice), std::move(value_slice),
             key.length() + value.length() + 32),
         nullptr};
-    ASSERT_TRUE(tbl->Add(std::move(memento)));
+    ASSERT_TRUE(tbl->Add(std::move(memento), value));
   }
 
   tbl.reset();
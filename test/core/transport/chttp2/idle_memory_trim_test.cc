@@ -0,0 +1,453 @@
+//
+//
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+// Drives a chttp2 server transport from a hand written client and checks
+// the SETTINGS it sends while trimming the memory of idle connections.
+
+#include <grpc/grpc.h>
+#include <grpc/impl/channel_arg_names.h>
+#include <grpc/slice.h>
+#include <grpc/slice_buffer.h>
+#include <grpc/support/alloc.h>
+#include <limits.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "src/core/ext/transport/chttp2/transport/chttp2_transport.h"
+#include "src/core/ext/transport/chttp2/transport/http2_settings.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/iomgr/closure.h"
+#include "src/core/lib/iomgr/endpoint.h"
+#include "src/core/lib/iomgr/endpoint_pair.h"
+#include "src/core/lib/iomgr/error.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/resource_quota/resource_quota.h"
+#include "src/core/lib/slice/slice.h"
+#include "src/core/lib/slice/slice_internal.h"
+#include "src/core/lib/slice/slice_string_helpers.h"
+#include "src/core/lib/surface/completion_queue.h"
+#include "src/core/server/server.h"
+#include "src/core/util/crash.h"
+#include "src/core/util/grpc_check.h"
+#include "src/core/util/notification.h"
+#include "src/core/util/orphanable.h"
+#include "src/core/util/sync.h"
+#include "test/core/end2end/cq_verifier.h"
+#include "test/core/test_util/test_config.h"
+#include "gtest/gtest.h"
+#include "absl/base/thread_annotations.h"
+#include "absl/log/log.h"
+#include "absl/status/status.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+
+namespace grpc_core {
+namespace {
+
+void* Tag(intptr_t t) { return reinterpret_cast<void*>(t); }
+
+constexpr uint8_t kRstStreamFrame = 0x03;
+constexpr uint8_t kSettingsFrame = 0x04;
+constexpr uint8_t kAckFlag = 0x01;
+constexpr uint16_t kHeaderTableSizeSetting = 0x01;
+constexpr size_t kQuotaSize = 1024 * 1024 * 1024;
+
+constexpr char kSettingsAck[] = "\x00\x00\x00\x04\x01\x00\x00\x00\x00";
+
+struct Frame {
+  uint8_t type;
+  uint8_t flags;
+  uint32_t stream_id;
+  std::string payload;
+};
+
+uint32_t ReadBigEndian(absl::string_view bytes) {
+  uint32_t value = 0;
+  for (char c : bytes) value = value << 8 | static_cast<uint8_t>(c);
+  return value;
+}
+
+void AppendBigEndian(uint32_t value, std::string* out) {
+  for (int shift = 24; shift >= 0; shift -= 8) {
+    out->push_back(static_cast<char>((value >> shift) & 0xff));
+  }
+}
+
+std::map<uint16_t, uint32_t> ParseSettings(const Frame& frame) {
+  std::map<uint16_t, uint32_t> settings;
+  for (size_t i = 0; i + 6 <= frame.payload.size(); i += 6) {
+    settings[ReadBigEndian(frame.payload.substr(i, 2))] =
+        ReadBigEndian(frame.payload.substr(i + 2, 4));
+  }
+  return settings;
+}
+
+// A request that only uses literals the decoder does not index, so it can
+// be sent whatever the HPACK table size is.
+std::string RequestFrame(uint32_t stream_id) {
+  constexpr char kRequestFrame[] =
+      "\x00\x00\xbe\x01\x05"
+      "\x10\x05:path\x08/foo/bar"
+      "\x10\x07:scheme\x04http"
+      "\x10\x07:method\x04POST"
+      "\x10\x0a:authority\x09localhost"
+      "\x10\x0c"
+      "content-type\x10"
+      "application/grpc"
+      "\x10\x14grpc-accept-encoding\x15identity,deflate,gzip"
+      "\x10\x02te\x08trailers"
+      "\x10\x0auser-agent\x17grpc-c/0.12.0.0 (linux)";
+  absl::string_view frame(kRequestFrame, sizeof(kRequestFrame) - 1);
+  std::string result(frame.substr(0, 5));
+  AppendBigEndian(stream_id, &result);
+  absl::StrAppend(&result, frame.substr(5));
+  return result;
+}
+
+std::string CancelFrame(uint32_t stream_id) {
+  std::string result("\x00\x00\x04\x03\x00", 5);
+  AppendBigEndian(stream_id, &result);
+  AppendBigEndian(/*CANCEL*/ 8, &result);
+  return result;
+}
+
+class IdleMemoryTrimTest : public ::testing::Test {
+ protected:
+  ~IdleMemoryTrimTest() override {
+    if (server_ != nullptr) ShutdownAndDestroy();
+  }
+
+  // Sets up a server transport with \a args, exchanges the initial
+  // SETTINGS with it and leaves the connection without streams.
+  void SetupAndStart(const ChannelArgs& args) {
+    ExecCtx exec_ctx;
+    cq_ = grpc_completion_queue_create_for_next(nullptr);
+    cqv_ = std::make_unique<CqVerifier>(cq_);
+    quota_ = MakeResourceQuota("idle_memory_trim_test");
+    quota_->memory_quota()->SetSize(kQuotaSize);
+    auto server_args = args.Set(GRPC_ARG_HTTP2_BDP_PROBE, 0)
+                           .Set(GRPC_ARG_KEEPALIVE_TIME_MS, INT_MAX)
+                           .SetObject(quota_)
+                           .ToC();
+    server_ = grpc_server_create(server_args.get(), nullptr);
+    auto* core_server = Server::FromC(server_);
+    grpc_server_register_completion_queue(server_, cq_, nullptr);
+    grpc_server_start(server_);
+    fds_ = grpc_iomgr_create_endpoint_pair("fixture", nullptr);
+    auto* transport = grpc_create_chttp2_transport(
+        core_server->channel_args(), OrphanablePtr<grpc_endpoint>(fds_.server),
+        false);
+    grpc_endpoint_add_to_pollset(fds_.server, grpc_cq_pollset(cq_));
+    GRPC_CHECK(core_server->SetupTransport(transport, nullptr,
+                                           core_server->channel_args()) ==
+               absl::OkStatus());
+    grpc_chttp2_transport_start_reading(transport, nullptr, nullptr, nullptr,
+                                        nullptr);
+    Notification client_poller_thread_started_notification;
+    client_poll_thread_ = std::make_unique<std::thread>(
+        [this, &client_poller_thread_started_notification]() {
+          grpc_completion_queue* client_cq =
+              grpc_completion_queue_create_for_next(nullptr);
+          {
+            ExecCtx exec_ctx;
+            grpc_endpoint_add_to_pollset(fds_.client,
+                                         grpc_cq_pollset(client_cq));
+            grpc_endpoint_add_to_pollset(fds_.server,
+                                         grpc_cq_pollset(client_cq));
+          }
+          client_poller_thread_started_notification.Notify();
+          while (!shutdown_) {
+            GRPC_CHECK(grpc_completion_queue_next(
+                           client_cq, grpc_timeout_milliseconds_to_deadline(10),
+                           nullptr)
+                           .type == GRPC_QUEUE_TIMEOUT);
+          }
+          grpc_completion_queue_destroy(client_cq);
+        });
+    client_poller_thread_started_notification.WaitForNotification();
+    constexpr char kPrefix[] =
+        "PRI * HTTP/2.0\r\n\r\nSM\r\n\r\n\x00\x00\x00\x04\x00\x00\x00\x00\x00";
+    Write(absl::string_view(kPrefix, sizeof(kPrefix) - 1));
+    grpc_slice_buffer_init(&read_buffer_);
+    GRPC_CLOSURE_INIT(&on_read_done_, OnReadDone, this, nullptr);
+    GRPC_CLOSURE_INIT(&on_read_done_scheduler_, OnReadDoneScheduler, this,
+                      nullptr);
+    grpc_endpoint_read(fds_.client, &read_buffer_, &on_read_done_, false,
+                       /*min_progress_size=*/1);
+    // The server's first SETTINGS must be acked before it can send others.
+    GRPC_CHECK(NextSettings(absl::Seconds(30)).has_value());
+    AckSettings();
+  }
+
+  void ShutdownAndDestroy() {
+    shutdown_ = true;
+    ExecCtx exec_ctx;
+    {
+      MutexLock lock(&ep_destroy_mu_);
+      grpc_endpoint_destroy(fds_.client);
+      fds_.client = nullptr;
+    }
+    ExecCtx::Get()->Flush();
+    client_poll_thread_->join();
+    GRPC_CHECK(read_end_notification_.WaitForNotificationWithTimeout(
+        absl::Seconds(5)));
+    grpc_server_shutdown_and_notify(server_, cq_, Tag(1000));
+    cqv_->Expect(Tag(1000), true);
+    cqv_->Verify();
+    grpc_server_destroy(server_);
+    server_ = nullptr;
+    cqv_.reset();
+    grpc_completion_queue_destroy(cq_);
+  }
+
+  static void OnReadDone(void* arg, grpc_error_handle error) {
+    IdleMemoryTrimTest* self = static_cast<IdleMemoryTrimTest*>(arg);
+    if (error.ok()) {
+      {
+        MutexLock lock(&self->mu_);
+        for (size_t i = 0; i < self->read_buffer_.count; ++i) {
+          char* dump = grpc_dump_slice(self->read_buffer_.slices[i],
+                                       GPR_DUMP_HEX | GPR_DUMP_ASCII);
+          LOG(INFO) << "Read: " << dump;
+          gpr_free(dump);
+          absl::StrAppend(&self->read_bytes_,
+                          StringViewFromSlice(self->read_buffer_.slices[i]));
+        }
+        self->read_cv_.SignalAll();
+      }
+      MutexLock lock(&self->ep_destroy_mu_);
+      if (self->fds_.client != nullptr) {
+        grpc_slice_buffer_reset_and_unref(&self->read_buffer_);
+        grpc_endpoint_read(self->fds_.client, &self->read_buffer_,
+                           &self->on_read_done_scheduler_, false,
+                           /*min_progress_size=*/1);
+        return;
+      }
+    }
+    grpc_slice_buffer_destroy(&self->read_buffer_);
+    self->read_end_notification_.Notify();
+  }
+
+  // Do async hop for OnReadDone() in case grpc_endpoint_read() invokes
+  // us synchronously while we're holding the lock.
+  static void OnReadDoneScheduler(void* arg, grpc_error_handle error) {
+    IdleMemoryTrimTest* self = static_cast<IdleMemoryTrimTest*>(arg);
+    ExecCtx::Run(DEBUG_LOCATION, &self->on_read_done_, std::move(error));
+  }
+
+  // Returns the next frame the server sent, or nullopt if none arrives
+  // within \a timeout.
+  std::optional<Frame> NextFrame(absl::Duration timeout) {
+    const absl::Time deadline = absl::Now() + timeout;
+    MutexLock lock(&mu_);
+    while (true) {
+      if (read_bytes_.size() >= 9) {
+        const size_t length = ReadBigEndian(read_bytes_.substr(0, 3));
+        if (read_bytes_.size() >= 9 + length) {
+          Frame frame{static_cast<uint8_t>(read_bytes_[3]),
+                      static_cast<uint8_t>(read_bytes_[4]),
+                      ReadBigEndian(read_bytes_.substr(5, 4)) & 0x7fffffff,
+                      read_bytes_.substr(9, length)};
+          read_bytes_ = read_bytes_.substr(9 + length);
+          return frame;
+        }
+      }
+      if (absl::Now() >= deadline) return std::nullopt;
+      read_cv_.WaitWithDeadline(&mu_, deadline);
+    }
+  }
+
+  // Returns the next SETTINGS frame (not a SETTINGS ACK) the server sent,
+  // or nullopt if none arrives within \a timeout. Frames of other types
+  // are skipped, and appended to \a skipped if given.
+  std::optional<Frame> NextSettings(absl::Duration timeout,
+                                    std::vector<Frame>* skipped = nullptr) {
+    const absl::Time deadline = absl::Now() + timeout;
+    while (true) {
+      auto frame = NextFrame(deadline - absl::Now());
+      if (!frame.has_value()) return std::nullopt;
+      if (frame->type == kSettingsFrame && !(frame->flags & kAckFlag)) {
+        return frame;
+      }
+      if (skipped != nullptr) skipped->push_back(std::move(*frame));
+    }
+  }
+
+  // Waits for the server to advertise a new header table size and returns
+  // it.
+  std::optional<uint32_t> NextHeaderTableSize(
+      absl::Duration timeout, std::vector<Frame>* skipped = nullptr) {
+    const absl::Time deadline = absl::Now() + timeout;
+    while (true) {
+      auto frame = NextSettings(deadline - absl::Now(), skipped);
+      if (!frame.has_value()) return std::nullopt;
+      auto settings = ParseSettings(*frame);
+      auto it = settings.find(kHeaderTableSizeSetting);
+      if (it != settings.end()) return it->second;
+    }
+  }
+
+  void AckSettings() {
+    Write(absl::string_view(kSettingsAck, sizeof(kSettingsAck) - 1));
+  }
+
+  // This is a blocking call. It waits for the write callback to be invoked
+  // before returning.
+  void Write(absl::string_view bytes) {
+    ExecCtx exec_ctx;
+    grpc_slice slice =
+        StaticSlice::FromStaticBuffer(bytes.data(), bytes.size()).TakeCSlice();
+    grpc_slice_buffer buffer;
+    grpc_slice_buffer_init(&buffer);
+    grpc_slice_buffer_add(&buffer, slice);
+    Notification on_write_done_notification;
+    GRPC_CLOSURE_INIT(&on_write_done_, OnWriteDone,
+                      &on_write_done_notification, nullptr);
+    grpc_endpoint_write(
+        fds_.client, &buffer, &on_write_done_,
+        grpc_event_engine::experimental::EventEngine::Endpoint::WriteArgs());
+    ExecCtx::Get()->Flush();
+    GRPC_CHECK(on_write_done_notification.WaitForNotificationWithTimeout(
+        absl::Seconds(5)));
+    grpc_slice_buffer_destroy(&buffer);
+  }
+
+  static void OnWriteDone(void* arg, grpc_error_handle error) {
+    if (!error.ok()) {
+      Crash(absl::StrCat("Write failed: ", error.ToString()));
+    }
+    static_cast<Notification*>(arg)->Notify();
+  }
+
+  static uint32_t DefaultHeaderTableSize() {
+    return Http2Settings().header_table_size();
+  }
+
+  // Held when destroying fds_.client so we know not to start another read.
+  Mutex ep_destroy_mu_;
+
+  ResourceQuotaRefPtr quota_;
+  grpc_endpoint_pair fds_;
+  grpc_server* server_ = nullptr;
+  grpc_completion_queue* cq_ = nullptr;
+  std::unique_ptr<CqVerifier> cqv_;
+  std::unique_ptr<std::thread> client_poll_thread_;
+  std::atomic<bool> shutdown_{false};
+  grpc_closure on_read_done_;
+  grpc_closure on_read_done_scheduler_;
+  Mutex mu_;
+  CondVar read_cv_;
+  Notification read_end_notification_;
+  grpc_slice_buffer read_buffer_;
+  std::string read_bytes_ ABSL_GUARDED_BY(mu_);
+  grpc_closure on_write_done_;
+};
+
+TEST_F(IdleMemoryTrimTest, TrimsAndRestoresHeaderTableSize) {
+  SetupAndStart(
+      ChannelArgs().Set(GRPC_ARG_HTTP2_IDLE_MEMORY_TRIM_TIMEOUT_MS, 100));
+  EXPECT_EQ(NextHeaderTableSize(absl::Seconds(30)), 0u);
+  AckSettings();
+  Write(RequestFrame(1));
+  EXPECT_EQ(NextHeaderTableSize(absl::Seconds(30)), DefaultHeaderTableSize());
+  AckSettings();
+}
+
+TEST_F(IdleMemoryTrimTest, RestoreBeforeTrimIsAckedIsSentOnAck) {
+  SetupAndStart(
+      ChannelArgs().Set(GRPC_ARG_HTTP2_IDLE_MEMORY_TRIM_TIMEOUT_MS, 100));
+  EXPECT_EQ(NextHeaderTableSize(absl::Seconds(30)), 0u);
+  // The new stream restores the table size while the trim is in flight, so
+  // the restore can only be sent once the trim is acked.
+  Write(RequestFrame(1));
+  EXPECT_FALSE(NextSettings(absl::Milliseconds(500)).has_value());
+  AckSettings();
+  EXPECT_EQ(NextHeaderTableSize(absl::Seconds(30)), DefaultHeaderTableSize());
+  AckSettings();
+}
+
+TEST_F(IdleMemoryTrimTest, NewStreamCancelsTrimTimer) {
+  SetupAndStart(
+      ChannelArgs().Set(GRPC_ARG_HTTP2_IDLE_MEMORY_TRIM_TIMEOUT_MS, 1000));
+  Write(RequestFrame(1));
+  // Ending the only stream arms the timer, and the next stream cancels it.
+  Write(CancelFrame(1));
+  Write(RequestFrame(3));
+  EXPECT_FALSE(NextSettings(absl::Seconds(2)).has_value());
+  Write(CancelFrame(3));
+  EXPECT_EQ(NextHeaderTableSize(absl::Seconds(30)), 0u);
+  AckSettings();
+}
+
+TEST_F(IdleMemoryTrimTest, IdleReclaimerTrimsConnectionWithStreams) {
+  SetupAndStart(ChannelArgs());
+  grpc_call* s;
+  grpc_call_details call_details;
+  grpc_metadata_array request_metadata_recv;
+  grpc_call_details_init(&call_details);
+  grpc_metadata_array_init(&request_metadata_recv);
+  GRPC_CHECK_EQ(grpc_server_request_call(server_, &s, &call_details,
+                                         &request_metadata_recv, cq_, cq_,
+                                         Tag(100)),
+                GRPC_CALL_OK);
+  Write(RequestFrame(1));
+  cqv_->Expect(Tag(100), true);
+  cqv_->Verify();
+  // Run the quota short. The benign reclaimer leaves a connection with
+  // streams alone, so the idle reclaimer is the first to act on it, before
+  // the destructive one may cancel the stream.
+  {
+    ExecCtx exec_ctx;
+    quota_->memory_quota()->SetSize(1);
+  }
+  std::vector<Frame> skipped;
+  EXPECT_EQ(NextHeaderTableSize(absl::Seconds(30), &skipped), 0u);
+  {
+    ExecCtx exec_ctx;
+    quota_->memory_quota()->SetSize(kQuotaSize);
+  }
+  for (const Frame& frame : skipped) {
+    EXPECT_NE(frame.type, kRstStreamFrame)
+        << "stream " << frame.stream_id << " cancelled before the trim";
+  }
+  grpc_call_cancel(s, nullptr);
+  grpc_call_unref(s);
+  grpc_metadata_array_destroy(&request_metadata_recv);
+  grpc_call_details_destroy(&call_details);
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc::testing::TestEnvironment env(&argc, argv);
+  grpc_init();
+  int result = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return result;
+}
@@ -0,0 +1,350 @@
+//
+//
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+// Checks that write coalescing cuts the number of writes on a connection
+// that is kept busy by many concurrent calls, without adding much latency.
+
+#include <grpc/byte_buffer.h>
+#include <grpc/credentials.h>
+#include <grpc/grpc.h>
+#include <grpc/impl/channel_arg_names.h>
+#include <grpc/impl/propagation_bits.h>
+#include <grpc/slice.h>
+#include <grpc/support/time.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/telemetry/stats_data.h"
+#include "src/core/util/grpc_check.h"
+#include "test/core/test_util/port.h"
+#include "test/core/test_util/resolve_localhost_ip46.h"
+#include "test/core/test_util/test_config.h"
+#include "gtest/gtest.h"
+#include "absl/log/log.h"
+
+namespace grpc_core {
+namespace {
+
+constexpr size_t kConcurrentCalls = 16;
+constexpr size_t kWarmupCalls = 500;
+constexpr size_t kMeasuredCalls = 4000;
+
+// Completion queue tags carry the kind of operation in their low bits and
+// the slot it belongs to above them.
+enum TagKind : intptr_t {
+  kClientCallDone = 1,
+  kServerCallArrived,
+  kServerCallDone,
+  kShutdown,
+};
+constexpr intptr_t kTagKindBits = 3;
+
+void* MakeTag(TagKind kind, size_t slot) {
+  return reinterpret_cast<void*>(static_cast<intptr_t>(slot)
+                                     << kTagKindBits |
+                                 kind);
+}
+TagKind KindOf(void* tag) {
+  return static_cast<TagKind>(reinterpret_cast<intptr_t>(tag) &
+                              ((1 << kTagKindBits) - 1));
+}
+size_t SlotOf(void* tag) {
+  return static_cast<size_t>(reinterpret_cast<intptr_t>(tag) >> kTagKindBits);
+}
+
+class BusyConnection {
+ public:
+  explicit BusyConnection(int coalescing_delay_us) {
+    const ChannelArgs args =
+        ChannelArgs()
+            .Set(GRPC_ARG_HTTP2_WRITE_COALESCING_DELAY_US, coalescing_delay_us)
+            .Set(GRPC_ARG_ENABLE_RETRIES, false);
+    cq_ = grpc_completion_queue_create_for_next(nullptr);
+    server_ = grpc_server_create(args.ToC().get(), nullptr);
+    grpc_server_register_completion_queue(server_, cq_, nullptr);
+    const std::string addr = LocalIpAndPort(grpc_pick_unused_port_or_die());
+    grpc_server_credentials* server_creds =
+        grpc_insecure_server_credentials_create();
+    GRPC_CHECK(grpc_server_add_http2_port(server_, addr.c_str(), server_creds));
+    grpc_server_credentials_release(server_creds);
+    grpc_server_start(server_);
+    grpc_channel_credentials* client_creds = grpc_insecure_credentials_create();
+    channel_ =
+        grpc_channel_create(addr.c_str(), client_creds, args.ToC().get());
+    grpc_channel_credentials_release(client_creds);
+  }
+
+  ~BusyConnection() {
+    grpc_channel_destroy(channel_);
+    grpc_server_shutdown_and_notify(server_, cq_, MakeTag(kShutdown, 0));
+    grpc_server_cancel_all_calls(server_);
+    grpc_completion_queue_shutdown(cq_);
+    while (true) {
+      grpc_event ev = grpc_completion_queue_next(
+          cq_, gpr_inf_future(GPR_CLOCK_REALTIME), nullptr);
+      if (ev.type == GRPC_QUEUE_SHUTDOWN) break;
+      if (KindOf(ev.tag) == kServerCallArrived && ev.success) {
+        ServerSlot& slot = server_slots_[SlotOf(ev.tag)];
+        grpc_call_unref(slot.call);
+      }
+    }
+    for (ServerSlot& slot : server_slots_) {
+      grpc_metadata_array_destroy(&slot.request_metadata);
+      grpc_call_details_destroy(&slot.details);
+    }
+    grpc_server_destroy(server_);
+    grpc_completion_queue_destroy(cq_);
+  }
+
+  // Runs calls back to back, kConcurrentCalls at a time, and returns the
+  // median time from starting a call to receiving its status.
+  std::chrono::microseconds MedianCallLatency() {
+    for (size_t i = 0; i < kConcurrentCalls; ++i) {
+      RequestServerCall(i);
+      StartClientCall(i);
+    }
+    std::vector<std::chrono::microseconds> latencies;
+    latencies.reserve(kMeasuredCalls);
+    size_t finished = 0;
+    while (finished < kWarmupCalls + kMeasuredCalls) {
+      grpc_event ev = grpc_completion_queue_next(
+          cq_, grpc_timeout_seconds_to_deadline(30), nullptr);
+      GRPC_CHECK(ev.type == GRPC_OP_COMPLETE);
+      GRPC_CHECK(ev.success);
+      const size_t slot = SlotOf(ev.tag);
+      switch (KindOf(ev.tag)) {
+        case kClientCallDone: {
+          const auto latency = FinishClientCall(slot);
+          if (++finished > kWarmupCalls) latencies.push_back(latency);
+          StartClientCall(slot);
+          break;
+        }
+        case kServerCallArrived:
+          RespondToServerCall(slot);
+          break;
+        case kServerCallDone:
+          FinishServerCall(slot);
+          RequestServerCall(slot);
+          break;
+        case kShutdown:
+          GRPC_CHECK(false) << "unexpected shutdown";
+      }
+    }
+    // Let the calls still in flight finish, so that nothing is left on the
+    // queue when the connection goes away.
+    size_t in_flight = kConcurrentCalls;
+    while (in_flight > 0 || responding_ > 0) {
+      grpc_event ev = grpc_completion_queue_next(
+          cq_, grpc_timeout_seconds_to_deadline(30), nullptr);
+      GRPC_CHECK(ev.type == GRPC_OP_COMPLETE);
+      const size_t slot = SlotOf(ev.tag);
+      switch (KindOf(ev.tag)) {
+        case kClientCallDone:
+          FinishClientCall(slot);
+          --in_flight;
+          break;
+        case kServerCallArrived:
+          RespondToServerCall(slot);
+          break;
+        case kServerCallDone:
+          FinishServerCall(slot);
+          RequestServerCall(slot);
+          break;
+        case kShutdown:
+          GRPC_CHECK(false) << "unexpected shutdown";
+      }
+    }
+    std::nth_element(latencies.begin(),
+                     latencies.begin() + latencies.size() / 2,
+                     latencies.end());
+    return latencies[latencies.size() / 2];
+  }
+
+ private:
+  struct ClientSlot {
+    grpc_call* call = nullptr;
+    grpc_metadata_array initial_metadata;
+    grpc_metadata_array trailing_metadata;
+    grpc_byte_buffer* response = nullptr;
+    grpc_status_code status;
+    grpc_slice details;
+    std::chrono::steady_clock::time_point start;
+  };
+  struct ServerSlot {
+    grpc_call* call = nullptr;
+    grpc_call_details details;
+    grpc_metadata_array request_metadata;
+    int cancelled = 0;
+  };
+
+  void StartClientCall(size_t i) {
+    ClientSlot& slot = client_slots_[i];
+    grpc_metadata_array_init(&slot.initial_metadata);
+    grpc_metadata_array_init(&slot.trailing_metadata);
+    slot.start = std::chrono::steady_clock::now();
+    slot.call = grpc_channel_create_call(
+        channel_, nullptr, GRPC_PROPAGATE_DEFAULTS, cq_,
+        grpc_slice_from_static_string("/write_coalescing/Echo"), nullptr,
+        gpr_inf_future(GPR_CLOCK_REALTIME), nullptr);
+    grpc_slice payload = grpc_slice_from_static_string("ping");
+    grpc_byte_buffer* request = grpc_raw_byte_buffer_create(&payload, 1);
+    grpc_op ops[6] = {};
+    ops[0].op = GRPC_OP_SEND_INITIAL_METADATA;
+    ops[0].flags = GRPC_INITIAL_METADATA_WAIT_FOR_READY;
+    ops[1].op = GRPC_OP_SEND_MESSAGE;
+    ops[1].data.send_message.send_message = request;
+    ops[2].op = GRPC_OP_SEND_CLOSE_FROM_CLIENT;
+    ops[3].op = GRPC_OP_RECV_INITIAL_METADATA;
+    ops[3].data.recv_initial_metadata.recv_initial_metadata =
+        &slot.initial_metadata;
+    ops[4].op = GRPC_OP_RECV_MESSAGE;
+    ops[4].data.recv_message.recv_message = &slot.response;
+    ops[5].op = GRPC_OP_RECV_STATUS_ON_CLIENT;
+    ops[5].data.recv_status_on_client.trailing_metadata =
+        &slot.trailing_metadata;
+    ops[5].data.recv_status_on_client.status = &slot.status;
+    ops[5].data.recv_status_on_client.status_details = &slot.details;
+    GRPC_CHECK(GRPC_CALL_OK ==
+               grpc_call_start_batch(slot.call, ops, 6,
+                                     MakeTag(kClientCallDone, i), nullptr));
+    grpc_byte_buffer_destroy(request);
+  }
+
+  std::chrono::microseconds FinishClientCall(size_t i) {
+    ClientSlot& slot = client_slots_[i];
+    const auto latency = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - slot.start);
+    GRPC_CHECK_EQ(slot.status, GRPC_STATUS_OK);
+    grpc_byte_buffer_destroy(slot.response);
+    slot.response = nullptr;
+    grpc_slice_unref(slot.details);
+    grpc_metadata_array_destroy(&slot.initial_metadata);
+    grpc_metadata_array_destroy(&slot.trailing_metadata);
+    grpc_call_unref(slot.call);
+    slot.call = nullptr;
+    return latency;
+  }
+
+  void RequestServerCall(size_t i) {
+    ServerSlot& slot = server_slots_[i];
+    grpc_call_details_init(&slot.details);
+    grpc_metadata_array_init(&slot.request_metadata);
+    GRPC_CHECK(GRPC_CALL_OK ==
+               grpc_server_request_call(server_, &slot.call, &slot.details,
+                                        &slot.request_metadata, cq_, cq_,
+                                        MakeTag(kServerCallArrived, i)));
+  }
+
+  void RespondToServerCall(size_t i) {
+    ServerSlot& slot = server_slots_[i];
+    ++responding_;
+    grpc_slice payload = grpc_slice_from_static_string("pong");
+    grpc_byte_buffer* response = grpc_raw_byte_buffer_create(&payload, 1);
+    grpc_op ops[4] = {};
+    ops[0].op = GRPC_OP_SEND_INITIAL_METADATA;
+    ops[1].op = GRPC_OP_SEND_MESSAGE;
+    ops[1].data.send_message.send_message = response;
+    ops[2].op = GRPC_OP_SEND_STATUS_FROM_SERVER;
+    ops[2].data.send_status_from_server.status = GRPC_STATUS_OK;
+    ops[3].op = GRPC_OP_RECV_CLOSE_ON_SERVER;
+    ops[3].data.recv_close_on_server.cancelled = &slot.cancelled;
+    GRPC_CHECK(GRPC_CALL_OK ==
+               grpc_call_start_batch(slot.call, ops, 4,
+                                     MakeTag(kServerCallDone, i), nullptr));
+    grpc_byte_buffer_destroy(response);
+  }
+
+  void FinishServerCall(size_t i) {
+    ServerSlot& slot = server_slots_[i];
+    --responding_;
+    grpc_call_unref(slot.call);
+    slot.call = nullptr;
+    grpc_call_details_destroy(&slot.details);
+    grpc_metadata_array_destroy(&slot.request_metadata);
+  }
+
+  grpc_completion_queue* cq_;
+  grpc_server* server_;
+  grpc_channel* channel_;
+  ClientSlot client_slots_[kConcurrentCalls];
+  ServerSlot server_slots_[kConcurrentCalls];
+  // Server calls that have been answered but not yet closed.
+  size_t responding_ = 0;
+};
+
+struct BusyConnectionStats {
+  std::chrono::microseconds median_latency;
+  // Writes started by the chttp2 transports on both ends, and write
+  // syscalls made for them.
+  uint64_t http2_writes;
+  uint64_t syscall_writes;
+};
+
+// Runs the same number of calls on a fresh connection with the given
+// coalescing delay, and returns what they cost.
+BusyConnectionStats RunBusyConnection(int coalescing_delay_us) {
+  auto http2_before = http2_global_stats().Collect();
+  auto global_before = global_stats().Collect();
+  BusyConnectionStats stats;
+  {
+    BusyConnection connection(coalescing_delay_us);
+    stats.median_latency = connection.MedianCallLatency();
+  }
+  stats.http2_writes = http2_global_stats()
+                           .Collect()
+                           ->Diff(*http2_before)
+                           ->http2_writes_begun;
+  stats.syscall_writes =
+      global_stats().Collect()->Diff(*global_before)->syscall_write;
+  LOG(INFO) << "coalescing delay " << coalescing_delay_us
+            << "us: median call latency " << stats.median_latency.count()
+            << "us, " << stats.http2_writes << " http2 writes, "
+            << stats.syscall_writes << " write syscalls";
+  return stats;
+}
+
+TEST(WriteCoalescingTest, BusyConnectionMakesFewerWrites) {
+  const BusyConnectionStats plain =
+      RunBusyConnection(/*coalescing_delay_us=*/0);
+  const BusyConnectionStats coalesced =
+      RunBusyConnection(/*coalescing_delay_us=*/1000);
+  EXPECT_LT(coalesced.http2_writes, plain.http2_writes);
+  EXPECT_LT(coalesced.syscall_writes, plain.syscall_writes);
+  // Holding back a write must never wait on a timer: event engine timers
+  // fire no sooner than 2ms, and a call makes several writes, so waiting on
+  // them would add well over this to every call.
+  EXPECT_LT(coalesced.median_latency,
+            2 * plain.median_latency + std::chrono::milliseconds(2));
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc::testing::TestEnvironment env(&argc, argv);
+  grpc_init();
+  int result = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return result;
+}
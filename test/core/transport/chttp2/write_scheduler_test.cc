@@ -0,0 +1,126 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/transport/chttp2/transport/write_scheduler.h"
+
+#include <grpc/impl/channel_arg_names.h>
+
+#include <limits>
+
+#include "src/core/call/metadata_batch.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "gtest/gtest.h"
+#include "absl/strings/string_view.h"
+
+namespace grpc_core {
+namespace {
+
+void FailOnParseError(absl::string_view, const Slice&) { FAIL(); }
+
+ChannelArgs DrrArgs() {
+  return ChannelArgs()
+      .Set(GRPC_ARG_HTTP2_WRITE_SCHEDULER, "drr")
+      .Set(GRPC_ARG_HTTP2_WRITE_SCHEDULER_QUANTUM, 1000)
+      .Set(GRPC_ARG_HTTP2_WRITE_WEIGHT_METADATA_KEY, "x-weight");
+}
+
+TEST(WriteSchedulerTest, DisabledByDefault) {
+  Chttp2WriteScheduler scheduler(ChannelArgs{});
+  EXPECT_FALSE(scheduler.enabled());
+  Chttp2WriteScheduler::StreamState stream;
+  EXPECT_EQ(scheduler.BeginTurn(stream), std::numeric_limits<uint32_t>::max());
+}
+
+TEST(WriteSchedulerTest, DefaultQuantum) {
+  Chttp2WriteScheduler scheduler(
+      ChannelArgs().Set(GRPC_ARG_HTTP2_WRITE_SCHEDULER, "drr"));
+  EXPECT_TRUE(scheduler.enabled());
+  EXPECT_EQ(scheduler.quantum(), Chttp2WriteScheduler::kDefaultQuantum);
+}
+
+TEST(WriteSchedulerTest, GrantsQuantumEachTurn) {
+  Chttp2WriteScheduler scheduler(DrrArgs());
+  Chttp2WriteScheduler::StreamState stream;
+  EXPECT_EQ(scheduler.BeginTurn(stream), 1000);
+  scheduler.EndTurn(1000, /*has_more_data=*/true, stream);
+  EXPECT_EQ(scheduler.BeginTurn(stream), 1000);
+}
+
+TEST(WriteSchedulerTest, UnusedGrantCarriesOver) {
+  Chttp2WriteScheduler scheduler(DrrArgs());
+  Chttp2WriteScheduler::StreamState stream;
+  EXPECT_EQ(scheduler.BeginTurn(stream), 1000);
+  // Stalled on flow control after sending part of its grant.
+  scheduler.EndTurn(400, /*has_more_data=*/true, stream);
+  EXPECT_EQ(scheduler.BeginTurn(stream), 1600);
+  // A stream that keeps stalling can't save up more than two grants.
+  scheduler.EndTurn(0, /*has_more_data=*/true, stream);
+  EXPECT_EQ(scheduler.BeginTurn(stream), 2000);
+}
+
+TEST(WriteSchedulerTest, IdleStreamLosesGrant) {
+  Chttp2WriteScheduler scheduler(DrrArgs());
+  Chttp2WriteScheduler::StreamState stream;
+  EXPECT_EQ(scheduler.BeginTurn(stream), 1000);
+  scheduler.EndTurn(100, /*has_more_data=*/false, stream);
+  EXPECT_EQ(scheduler.BeginTurn(stream), 1000);
+}
+
+TEST(WriteSchedulerTest, WeightFromMetadata) {
+  Chttp2WriteScheduler scheduler(DrrArgs());
+  Chttp2WriteScheduler::StreamState stream;
+  grpc_metadata_batch md;
+  md.Append("x-weight", Slice::FromStaticString("4"), FailOnParseError);
+  scheduler.SetWeightFromMetadata(md, stream);
+  EXPECT_EQ(stream.weight(), 4);
+  EXPECT_EQ(scheduler.BeginTurn(stream), 4000);
+}
+
+TEST(WriteSchedulerTest, WeightIsClamped) {
+  Chttp2WriteScheduler scheduler(DrrArgs());
+  Chttp2WriteScheduler::StreamState stream;
+  grpc_metadata_batch md;
+  md.Append("x-weight", Slice::FromStaticString("1000"), FailOnParseError);
+  scheduler.SetWeightFromMetadata(md, stream);
+  EXPECT_EQ(stream.weight(), Chttp2WriteScheduler::kMaxWeight);
+}
+
+TEST(WriteSchedulerTest, InvalidWeightIgnored) {
+  Chttp2WriteScheduler scheduler(DrrArgs());
+  for (absl::string_view value : {"0", "-3", "heavy"}) {
+    Chttp2WriteScheduler::StreamState stream;
+    grpc_metadata_batch md;
+    md.Append("x-weight", Slice::FromCopiedString(value), FailOnParseError);
+    scheduler.SetWeightFromMetadata(md, stream);
+    EXPECT_EQ(stream.weight(), 1) << value;
+  }
+}
+
+TEST(WriteSchedulerTest, WeightIgnoredWithoutKey) {
+  Chttp2WriteScheduler scheduler(
+      ChannelArgs().Set(GRPC_ARG_HTTP2_WRITE_SCHEDULER, "drr"));
+  Chttp2WriteScheduler::StreamState stream;
+  grpc_metadata_batch md;
+  md.Append("x-weight", Slice::FromStaticString("4"), FailOnParseError);
+  scheduler.SetWeightFromMetadata(md, stream);
+  EXPECT_EQ(stream.weight(), 1);
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -14,7 +14,9 @@
 
 #include "src/core/ext/transport/chttp2/transport/write_size_policy.h"
 
+#include <chrono>
 #include <memory>
+#include <thread>
 
 #include "gtest/gtest.h"
 
@@ -116,6 +118,93 @@ TEST(WriteSizePolicyTest, MediumWritesJustHangOut) {
   EXPECT_EQ(policy.WriteTargetSize(), 131072);
 }
 
+TEST(WriteCoalescingPolicyTest, DisabledByDefault) {
+  Chttp2WriteCoalescingPolicy policy;
+  policy.BeginWrite(false, 1);
+  EXPECT_FALSE(policy.StartHold(1));
+}
+
+TEST(WriteCoalescingPolicyTest, NoHoldWhenIdle) {
+  ScopedTimeCache time_cache;
+  time_cache.TestOnlySetNow(Timestamp::ProcessEpoch());
+  Chttp2WriteCoalescingPolicy policy(std::chrono::microseconds(1000), 16384);
+  // Nothing has been written yet.
+  EXPECT_FALSE(policy.StartHold(1));
+  policy.BeginWrite(false, 1);
+  EXPECT_TRUE(policy.StartHold(1));
+  policy.BeginWrite(true, 2);
+  time_cache.TestOnlySetNow(Timestamp::ProcessEpoch() +
+                            Duration::Milliseconds(10));
+  EXPECT_FALSE(policy.StartHold(1));
+}
+
+TEST(WriteCoalescingPolicyTest, HoldsWhileMessagesArrive) {
+  ScopedTimeCache time_cache;
+  time_cache.TestOnlySetNow(Timestamp::ProcessEpoch());
+  Chttp2WriteCoalescingPolicy policy(std::chrono::microseconds(1000), 16384);
+  policy.BeginWrite(false, 1);
+  ASSERT_TRUE(policy.StartHold(1));
+  EXPECT_TRUE(policy.ContinueHold(2));
+  EXPECT_TRUE(policy.ContinueHold(3));
+  // A pass that adds nothing ends the hold.
+  EXPECT_FALSE(policy.ContinueHold(3));
+}
+
+TEST(WriteCoalescingPolicyTest, HoldEndsAfterMaxDelay) {
+  ScopedTimeCache time_cache;
+  time_cache.TestOnlySetNow(Timestamp::ProcessEpoch());
+  Chttp2WriteCoalescingPolicy policy(std::chrono::microseconds(1), 16384);
+  policy.BeginWrite(false, 1);
+  ASSERT_TRUE(policy.StartHold(1));
+  std::this_thread::sleep_for(std::chrono::microseconds(100));
+  EXPECT_FALSE(policy.ContinueHold(2));
+}
+
+TEST(WriteCoalescingPolicyTest, BacksOffWhenHoldingGathersNothing) {
+  ScopedTimeCache time_cache;
+  time_cache.TestOnlySetNow(Timestamp::ProcessEpoch());
+  Chttp2WriteCoalescingPolicy policy(std::chrono::microseconds(1000), 16384);
+  policy.BeginWrite(false, 1);
+  auto writes_until_hold = [&policy]() {
+    int writes = 0;
+    while (!policy.StartHold(1)) {
+      policy.BeginWrite(false, 1);
+      ++writes;
+    }
+    return writes;
+  };
+  EXPECT_EQ(writes_until_hold(), 0);
+  policy.BeginWrite(true, 1);
+  EXPECT_EQ(writes_until_hold(), 1);
+  policy.BeginWrite(true, 0);
+  EXPECT_EQ(writes_until_hold(), 2);
+  for (int i = 0; i < 10; ++i) {
+    writes_until_hold();
+    policy.BeginWrite(true, 1);
+  }
+  EXPECT_EQ(writes_until_hold(),
+            static_cast<int>(Chttp2WriteCoalescingPolicy::MaxBackoff()));
+  // Holding back a write that gathers several messages recovers.
+  policy.BeginWrite(true, 8);
+  EXPECT_EQ(writes_until_hold(), 0);
+  policy.BeginWrite(true, 1);
+  EXPECT_EQ(writes_until_hold(), 1);
+}
+
+TEST(WriteCoalescingPolicyTest, StopsHoldingAfterEnoughBytes) {
+  ScopedTimeCache time_cache;
+  time_cache.TestOnlySetNow(Timestamp::ProcessEpoch());
+  Chttp2WriteCoalescingPolicy policy(std::chrono::microseconds(1000), 1000);
+  policy.BeginWrite(false, 1);
+  ASSERT_TRUE(policy.StartHold(1));
+  policy.AddPendingBytes(600);
+  EXPECT_TRUE(policy.ContinueHold(2));
+  policy.AddPendingBytes(600);
+  EXPECT_FALSE(policy.ContinueHold(3));
+  policy.BeginWrite(true, 3);
+  EXPECT_TRUE(policy.StartHold(1));
+}
+
 }  // namespace
 }  // namespace grpc_core
 
@@ -0,0 +1,142 @@
+//
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include "src/core/lib/transport/tcp_info_bdp_estimator.h"
+
+#include <grpc/grpc.h>
+
+#include <atomic>
+
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/iomgr/timer_manager.h"
+#include "src/core/lib/transport/bdp_estimator.h"
+#include "test/core/test_util/test_config.h"
+#include "gtest/gtest.h"
+
+extern gpr_timespec (*gpr_now_impl)(gpr_clock_type clock_type);
+
+namespace grpc_core {
+namespace testing {
+namespace {
+std::atomic<int> g_clock{123};
+
+gpr_timespec fake_gpr_now(gpr_clock_type clock_type) {
+  gpr_timespec ts;
+  ts.tv_sec = g_clock.load();
+  ts.tv_nsec = 0;
+  ts.clock_type = clock_type;
+  return ts;
+}
+
+void increment_time(const int seconds) {
+  g_clock.fetch_add(seconds);
+  ExecCtx::Get()->InvalidateNow();
+}
+
+class TcpInfoBdpEstimatorTest : public ::testing::Test {
+ protected:
+  void SetUp() override { g_clock.store(123); }
+
+  ExecCtx exec_ctx_;
+  TcpInfoBdpEstimator est_{/*name=*/"test"};
+};
+
+}  // namespace
+
+TEST_F(TcpInfoBdpEstimatorTest, NoSamples) {
+  EXPECT_EQ(est_.EstimateBdp(), kInitialBdpDefault);
+  const Timestamp next = est_.Update();
+  EXPECT_EQ(next - Timestamp::Now(),
+            Duration::Milliseconds(kDefaultInterPingDelayMillis));
+  EXPECT_EQ(est_.EstimateBdp(), kInitialBdpDefault);
+}
+
+TEST_F(TcpInfoBdpEstimatorTest, KeepsInitialEstimateWithoutRtt) {
+  est_.Update();
+  est_.AddIncomingBytes(100000000);
+  increment_time(/*seconds=*/1);
+  est_.Update();
+  EXPECT_DOUBLE_EQ(est_.EstimateBandwidth(), 100000000);
+  EXPECT_EQ(est_.EstimateBdp(), kInitialBdpDefault);
+}
+
+TEST_F(TcpInfoBdpEstimatorTest, LatestMinRttIsUsed) {
+  // 100 MB/s over a 50ms path.
+  est_.Update();
+  est_.sampler()->AddSample(/*min_rtt_us=*/60000);
+  est_.sampler()->AddSample(/*min_rtt_us=*/50000);
+  est_.sampler()->AddSample(/*min_rtt_us=*/0);
+  est_.AddIncomingBytes(100000000);
+  increment_time(/*seconds=*/1);
+  est_.Update();
+  EXPECT_DOUBLE_EQ(est_.EstimateBandwidth(), 100000000);
+  EXPECT_EQ(est_.EstimateBdp(), 5000000);
+}
+
+TEST_F(TcpInfoBdpEstimatorTest, IncomingBytesGiveBandwidth) {
+  est_.sampler()->AddSample(/*min_rtt_us=*/100000);
+  est_.Update();
+  est_.AddIncomingBytes(20000000);
+  EXPECT_EQ(est_.accumulator(), 20000000);
+  increment_time(/*seconds=*/2);
+  est_.Update();
+  EXPECT_EQ(est_.accumulator(), 0);
+  EXPECT_DOUBLE_EQ(est_.EstimateBandwidth(), 10000000);
+  EXPECT_EQ(est_.EstimateBdp(), 1000000);
+}
+
+TEST_F(TcpInfoBdpEstimatorTest, BytesBeforeFirstUpdateAreNotBandwidth) {
+  // Without a previous update there is no interval to divide by.
+  est_.sampler()->AddSample(/*min_rtt_us=*/100000);
+  est_.AddIncomingBytes(20000000);
+  est_.Update();
+  EXPECT_EQ(est_.accumulator(), 0);
+  EXPECT_DOUBLE_EQ(est_.EstimateBandwidth(), 0);
+  EXPECT_EQ(est_.EstimateBdp(), kInitialBdpDefault);
+}
+
+TEST_F(TcpInfoBdpEstimatorTest, OldBandwidthSamplesAgeOut) {
+  est_.sampler()->AddSample(/*min_rtt_us=*/10000);
+  est_.Update();
+  est_.AddIncomingBytes(100000000);
+  increment_time(/*seconds=*/1);
+  est_.Update();
+  EXPECT_EQ(est_.EstimateBdp(), 1000000);
+  for (size_t i = 1; i < TcpInfoBdpEstimator::kBandwidthFilterLength; ++i) {
+    est_.AddIncomingBytes(5000000);
+    increment_time(/*seconds=*/1);
+    est_.Update();
+    EXPECT_EQ(est_.EstimateBdp(), 1000000);
+  }
+  est_.AddIncomingBytes(5000000);
+  increment_time(/*seconds=*/1);
+  est_.Update();
+  EXPECT_EQ(est_.EstimateBdp(), kInitialBdpDefault);
+}
+
+}  // namespace testing
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  gpr_now_impl = grpc_core::testing::fake_gpr_now;
+  grpc_init();
+  grpc_timer_manager_set_threading(false);
+  ::testing::InitGoogleTest(&argc, argv);
+  int ret = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return ret;
+}
@@ -29,6 +29,7 @@
 constexpr size_t kMaxDataSize = 1024;
 constexpr size_t kMaxSlices = 10;
 constexpr size_t kSealRepeatTimes = 5;
+constexpr size_t kBatchSize = 4;
 constexpr size_t kTagLength = 16;
 
 // Test fixtures for each test cases.
@@ -578,6 +579,100 @@ static void privacy_integrity_corrupted_data(
   alts_iovec_record_protocol_test_var_destroy(var);
 }
 
+static void privacy_integrity_batch_seal_unseal(
+    alts_iovec_record_protocol* sender, alts_iovec_record_protocol* receiver) {
+  for (size_t i = 0; i < kSealRepeatTimes; i++) {
+    alts_iovec_record_protocol_test_var* vars[kBatchSize];
+    alts_iovec_record_protocol_protect_frame protect_frames[kBatchSize];
+    alts_iovec_record_protocol_unprotect_frame unprotect_frames[kBatchSize];
+    for (size_t j = 0; j < kBatchSize; j++) {
+      vars[j] = alts_iovec_record_protocol_test_var_create();
+      protect_frames[j] = {vars[j]->data_iovec, vars[j]->data_iovec_length,
+                           vars[j]->protected_iovec};
+    }
+    // Seals the whole batch at once.
+    grpc_status_code status =
+        alts_iovec_record_protocol_privacy_integrity_protect_batch(
+            sender, protect_frames, kBatchSize, nullptr);
+    ASSERT_EQ(status, GRPC_STATUS_OK);
+    for (size_t j = 0; j < kBatchSize; j++) {
+      alts_iovec_record_protocol_test_var* var = vars[j];
+      gpr_free(var->data_iovec);
+      // Randomly slices protected buffer, excluding the header.
+      randomly_slice(var->protected_buf + var->header_length,
+                     var->data_length + var->tag_length, &var->data_iovec,
+                     &var->data_iovec_length);
+      unprotect_frames[j] = {{var->protected_buf, var->header_length},
+                             var->data_iovec,
+                             var->data_iovec_length,
+                             var->unprotected_iovec};
+    }
+    // The first frame is unsealed on its own to make sure batched frames are
+    // interchangeable with individually protected ones, and the rest are
+    // unsealed as a batch.
+    status = alts_iovec_record_protocol_privacy_integrity_unprotect(
+        receiver, unprotect_frames[0].header, unprotect_frames[0].protected_vec,
+        unprotect_frames[0].protected_vec_length,
+        unprotect_frames[0].unprotected_data, nullptr);
+    ASSERT_EQ(status, GRPC_STATUS_OK);
+    status = alts_iovec_record_protocol_privacy_integrity_unprotect_batch(
+        receiver, unprotect_frames + 1, kBatchSize - 1, nullptr);
+    ASSERT_EQ(status, GRPC_STATUS_OK);
+    // Makes sure unprotected data are the same as the original.
+    for (size_t j = 0; j < kBatchSize; j++) {
+      ASSERT_EQ(
+          memcmp(vars[j]->data_buf, vars[j]->dup_buf, vars[j]->data_length), 0);
+      alts_iovec_record_protocol_test_var_destroy(vars[j]);
+    }
+  }
+}
+
+static void privacy_integrity_batch_corrupted_header(
+    alts_iovec_record_protocol* sender, alts_iovec_record_protocol* receiver) {
+  alts_iovec_record_protocol_test_var* vars[kBatchSize];
+  alts_iovec_record_protocol_protect_frame protect_frames[kBatchSize];
+  alts_iovec_record_protocol_unprotect_frame unprotect_frames[kBatchSize];
+  for (size_t j = 0; j < kBatchSize; j++) {
+    vars[j] = alts_iovec_record_protocol_test_var_create();
+    protect_frames[j] = {vars[j]->data_iovec, vars[j]->data_iovec_length,
+                         vars[j]->protected_iovec};
+  }
+  grpc_status_code status =
+      alts_iovec_record_protocol_privacy_integrity_protect_batch(
+          sender, protect_frames, kBatchSize, nullptr);
+  ASSERT_EQ(status, GRPC_STATUS_OK);
+  iovec_t protected_iovecs[kBatchSize];
+  for (size_t j = 0; j < kBatchSize; j++) {
+    alts_iovec_record_protocol_test_var* var = vars[j];
+    protected_iovecs[j] = {var->protected_buf + var->header_length,
+                           var->data_length + var->tag_length};
+    unprotect_frames[j] = {{var->protected_buf, var->header_length},
+                           &protected_iovecs[j],
+                           1,
+                           var->unprotected_iovec};
+  }
+  // Alters the frame length field of the last frame. The whole batch should be
+  // rejected before any frame is decrypted, so the receiver stays in sync.
+  uint8_t* header_buf = vars[kBatchSize - 1]->protected_buf;
+  size_t offset = alter_random_byte(header_buf, kZeroCopyFrameLengthFieldSize);
+  char* error_message = nullptr;
+  status = alts_iovec_record_protocol_privacy_integrity_unprotect_batch(
+      receiver, unprotect_frames, kBatchSize, &error_message);
+  ASSERT_TRUE(gsec_test_expect_compare_code_and_substr(
+      status, GRPC_STATUS_INTERNAL, error_message, "Bad frame length."));
+  gpr_free(error_message);
+  revert_back_alter(header_buf, offset);
+  // Reverted batch should be verified correctly.
+  status = alts_iovec_record_protocol_privacy_integrity_unprotect_batch(
+      receiver, unprotect_frames, kBatchSize, nullptr);
+  ASSERT_EQ(status, GRPC_STATUS_OK);
+  for (size_t j = 0; j < kBatchSize; j++) {
+    ASSERT_EQ(memcmp(vars[j]->data_buf, vars[j]->dup_buf, vars[j]->data_length),
+              0);
+    alts_iovec_record_protocol_test_var_destroy(vars[j]);
+  }
+}
+
 static void privacy_integrity_protect_input_check(
     alts_iovec_record_protocol* rp) {
   alts_iovec_record_protocol_test_var* var =
@@ -891,6 +986,29 @@ TEST(AltsIovecRecordProtocolTest, AltsIovecRecordProtocolCorruptedDataTests) {
   alts_iovec_record_protocol_test_fixture_destroy(fixture);
 }
 
+TEST(AltsIovecRecordProtocolTest, AltsIovecRecordProtocolBatchSealUnsealTests) {
+  alts_iovec_record_protocol_test_fixture* fixture =
+      alts_iovec_record_protocol_test_fixture_create(
+          /*rekey=*/false, /*integrity_only=*/false);
+  privacy_integrity_batch_seal_unseal(fixture->client_protect,
+                                      fixture->server_unprotect);
+  privacy_integrity_batch_seal_unseal(fixture->server_protect,
+                                      fixture->client_unprotect);
+  privacy_integrity_batch_corrupted_header(fixture->client_protect,
+                                           fixture->server_unprotect);
+  alts_iovec_record_protocol_test_fixture_destroy(fixture);
+
+  fixture = alts_iovec_record_protocol_test_fixture_create(
+      /*rekey=*/true, /*integrity_only=*/false);
+  privacy_integrity_batch_seal_unseal(fixture->client_protect,
+                                      fixture->server_unprotect);
+  privacy_integrity_batch_seal_unseal(fixture->server_protect,
+                                      fixture->client_unprotect);
+  privacy_integrity_batch_corrupted_header(fixture->client_protect,
+                                           fixture->server_unprotect);
+  alts_iovec_record_protocol_test_fixture_destroy(fixture);
+}
+
 TEST(AltsIovecRecordProtocolTest, AltsIovecRecordProtocolInputCheckTests) {
   alts_iovec_record_protocol_test_fixture* fixture =
       alts_iovec_record_protocol_test_fixture_create(
@@ -18,15 +18,19 @@
 
 #include "src/core/tsi/ssl_transport_security.h"
 
+#include <errno.h>
 #include <grpc/grpc.h>
 #include <grpc/support/alloc.h>
 #include <grpc/support/string_util.h>
+#include <netinet/in.h>
 #include <openssl/crypto.h>
 #include <openssl/err.h>
 #include <openssl/pem.h>
 #include <stdbool.h>
 #include <stdio.h>
 #include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
 
 #include <cstdint>
 #include <map>
@@ -38,6 +42,7 @@
 #include <vector>
 
 #include "src/core/telemetry/instrument.h"
+#include "src/core/tsi/ssl/ktls/ssl_ktls.h"
 #include "src/core/tsi/tls_telemetry.h"
 #include "src/core/tsi/transport_security.h"
 #include "src/core/tsi/transport_security_interface.h"
@@ -48,6 +53,7 @@
 #include "test/core/tsi/transport_security_test_lib.h"
 #include "gtest/gtest.h"
 #include "absl/log/log.h"
+#include "absl/strings/escaping.h"
 #include "absl/strings/str_cat.h"
 #include "absl/strings/string_view.h"
 
@@ -432,6 +438,7 @@ class SslTransportSecurityTest
             TSI_DONT_REQUEST_CLIENT_CERTIFICATE;
       }
       server_options.send_client_ca_list = ssl_fixture->send_client_ca_list_;
+      server_options.enable_kernel_tls = ssl_fixture->enable_kernel_tls_;
       server_options.session_ticket_key = ssl_fixture->session_ticket_key_;
       server_options.session_ticket_key_size =
           ssl_fixture->session_ticket_key_size_;
@@ -738,6 +745,7 @@ class SslTransportSecurityTest
     bool verify_root_cert_subject_;
     tsi_tls_version tls_version_;
     bool send_client_ca_list_;
+    bool enable_kernel_tls_ = false;
     std::optional<std::string> alpn_client_overriden_protocols_ = std::nullopt;
     std::optional<std::string> alpn_server_overriden_protocols_ = std::nullopt;
     std::optional<std::string> expected_alpn_negotiated_protocol_ =
@@ -1187,8 +1195,199 @@ TEST_P(SslTransportSecurityTest, ConcurrentlyProtectAndUnprotectOnServer) {
   tsi_frame_protector_destroy(client_protector);
   tsi_frame_protector_destroy(server_protector);
 }
+
+#ifdef GPR_LINUX
+TEST_P(SslTransportSecurityTest, KernelTlsFallsBackOnUnsupportedSocket) {
+  SetUpSslFixture(tsi_tls_version::TSI_TLS1_3, /*send_client_ca_list=*/false);
+  ssl_fixture_->enable_kernel_tls_ = true;
+  DoHandshake();
+  // A Unix domain socket has no TLS ULP, and clients never offload.
+  int fds[2];
+  ASSERT_EQ(socketpair(AF_UNIX, SOCK_STREAM, 0, fds), 0);
+  EXPECT_EQ(tsi_handshaker_result_install_kernel_tls(
+                ssl_tsi_test_fixture_->client_result, fds[0]),
+            TSI_UNIMPLEMENTED);
+  EXPECT_EQ(tsi_handshaker_result_install_kernel_tls(
+                ssl_tsi_test_fixture_->server_result, fds[1]),
+            TSI_UNIMPLEMENTED);
+  close(fds[0]);
+  close(fds[1]);
+  // The results must still be usable for user-space record protection.
+  tsi_frame_protector_type frame_protector_type;
+  EXPECT_EQ(tsi_handshaker_result_get_frame_protector_type(
+                ssl_tsi_test_fixture_->server_result, &frame_protector_type),
+            TSI_OK);
+  EXPECT_EQ(frame_protector_type, TSI_FRAME_PROTECTOR_NORMAL);
+  tsi_frame_protector* client_protector;
+  EXPECT_EQ(tsi_handshaker_result_create_frame_protector(
+                ssl_tsi_test_fixture_->client_result,
+                /*max_output_protected_frame_size=*/nullptr, &client_protector),
+            TSI_OK);
+  ASSERT_NE(client_protector, nullptr);
+  tsi_frame_protector* server_protector;
+  EXPECT_EQ(tsi_handshaker_result_create_frame_protector(
+                ssl_tsi_test_fixture_->server_result,
+                /*max_output_protected_frame_size=*/nullptr, &server_protector),
+            TSI_OK);
+  ASSERT_NE(server_protector, nullptr);
+  std::string buffer(1024, 'a');
+  std::string protected_bytes = Protect(client_protector, buffer);
+  EXPECT_EQ(Unprotect(server_protector, protected_bytes), buffer);
+  tsi_frame_protector_destroy(client_protector);
+  tsi_frame_protector_destroy(server_protector);
+}
+
+// Connects two TCP sockets to each other over the loopback interface.
+bool ConnectLoopbackTcpPair(int* client_fd, int* server_fd) {
+  *client_fd = -1;
+  *server_fd = -1;
+  int listen_fd = socket(AF_INET, SOCK_STREAM, 0);
+  if (listen_fd < 0) return false;
+  sockaddr_in address;
+  memset(&address, 0, sizeof(address));
+  address.sin_family = AF_INET;
+  address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  socklen_t address_size = sizeof(address);
+  bool ok =
+      bind(listen_fd, reinterpret_cast<sockaddr*>(&address), address_size) ==
+          0 &&
+      listen(listen_fd, 1) == 0 &&
+      getsockname(listen_fd, reinterpret_cast<sockaddr*>(&address),
+                  &address_size) == 0;
+  if (ok) {
+    *client_fd = socket(AF_INET, SOCK_STREAM, 0);
+    ok = *client_fd >= 0 &&
+         connect(*client_fd, reinterpret_cast<sockaddr*>(&address),
+                 address_size) == 0;
+  }
+  if (ok) {
+    *server_fd = accept(listen_fd, nullptr, nullptr);
+    ok = *server_fd >= 0;
+  }
+  close(listen_fd);
+  return ok;
+}
+
+bool WriteAll(int fd, absl::string_view bytes) {
+  while (!bytes.empty()) {
+    ssize_t written = write(fd, bytes.data(), bytes.size());
+    if (written <= 0) return false;
+    bytes.remove_prefix(written);
+  }
+  return true;
+}
+
+std::string ReadExactly(int fd, size_t size) {
+  std::string bytes(size, '\0');
+  size_t offset = 0;
+  while (offset < size) {
+    ssize_t n = read(fd, &bytes[offset], size - offset);
+    if (n <= 0) break;
+    offset += n;
+  }
+  bytes.resize(offset);
+  return bytes;
+}
+
+TEST_P(SslTransportSecurityTest, KernelTlsProtectsRecordsOnTcpSocket) {
+  SetUpSslFixture(tsi_tls_version::TSI_TLS1_3, /*send_client_ca_list=*/false);
+  ssl_fixture_->enable_kernel_tls_ = true;
+  DoHandshake();
+  int client_fd;
+  int server_fd;
+  if (!ConnectLoopbackTcpPair(&client_fd, &server_fd)) {
+    if (client_fd >= 0) close(client_fd);
+    if (server_fd >= 0) close(server_fd);
+    GTEST_SKIP() << "No loopback TCP: " << strerror(errno);
+  }
+  const tsi_result result = tsi_handshaker_result_install_kernel_tls(
+      ssl_tsi_test_fixture_->server_result, server_fd);
+  if (result == TSI_UNIMPLEMENTED) {
+    close(client_fd);
+    close(server_fd);
+    GTEST_SKIP() << "Kernel TLS is not available";
+  }
+  ASSERT_EQ(result, TSI_OK);
+  tsi_frame_protector* client_protector;
+  ASSERT_EQ(tsi_handshaker_result_create_frame_protector(
+                ssl_tsi_test_fixture_->client_result,
+                /*max_output_protected_frame_size=*/nullptr, &client_protector),
+            TSI_OK);
+  // The kernel decrypts the records the client protects in user space.
+  const std::string request(1024, 'a');
+  ASSERT_TRUE(WriteAll(client_fd, Protect(client_protector, request)));
+  EXPECT_EQ(ReadExactly(server_fd, request.size()), request);
+  // And the client can unprotect the records the kernel sends back.
+  const std::string response(1024, 'b');
+  ASSERT_TRUE(WriteAll(server_fd, response));
+  std::string received;
+  while (received.size() < response.size()) {
+    char buffer[2048];
+    ssize_t n = read(client_fd, buffer, sizeof(buffer));
+    ASSERT_GT(n, 0);
+    received += Unprotect(client_protector, absl::string_view(buffer, n));
+  }
+  EXPECT_EQ(received, response);
+  tsi_frame_protector_destroy(client_protector);
+  close(client_fd);
+  close(server_fd);
+}
+#endif  // GPR_LINUX
 #endif  // defined(OPENSSL_IS_BORINGSSL)
 
+#ifdef TSI_SSL_KTLS_SUPPORTED
+std::string HexToBytes(absl::string_view hex) {
+  std::string bytes;
+  EXPECT_TRUE(absl::HexStringToBytes(hex, &bytes));
+  return bytes;
+}
+
+std::string ExpandLabel(absl::string_view secret, absl::string_view label,
+                        size_t size) {
+  std::string out(size, '\0');
+  EXPECT_TRUE(tsi::internal::SslKtlsExpandLabel(
+      EVP_sha256(), secret, label, reinterpret_cast<uint8_t*>(&out[0]),
+      out.size()));
+  return out;
+}
+
+// The secrets, keys and IVs come from the simple 1-RTT handshake of RFC 8448
+// section 3, which negotiates TLS_AES_128_GCM_SHA256.
+TEST(SslKtlsTest, ExpandLabelMatchesRfc8448) {
+  const std::string server_handshake_secret = HexToBytes(
+      "b67b7d690cc16c4e75e54213cb2d37b4e9c912bcded9105d42befd59d391ad38");
+  EXPECT_EQ(absl::BytesToHexString(
+                ExpandLabel(server_handshake_secret, "key", 16)),
+            "3fce516009c21727d0f2e4e86ee403bc");
+  EXPECT_EQ(absl::BytesToHexString(
+                ExpandLabel(server_handshake_secret, "iv", 12)),
+            "5d313eb2671276ee13000b30");
+  const std::string client_handshake_secret = HexToBytes(
+      "b3eddb126e067f35a780b3abf45e2d8f3b1a950738f52e9600746a0e27a55a21");
+  EXPECT_EQ(absl::BytesToHexString(
+                ExpandLabel(client_handshake_secret, "key", 16)),
+            "dbfaa693d1762c5b666af5d950258d01");
+  EXPECT_EQ(absl::BytesToHexString(
+                ExpandLabel(client_handshake_secret, "iv", 12)),
+            "5bd3c71b836e0b76bb73265f");
+}
+
+TEST(SslKtlsTest, DeriveTrafficKeysMatchesRfc8448) {
+  const std::string server_application_secret = HexToBytes(
+      "a11af9f05531f856ad47116b45a950328204b4f44bfb6b3a4b4f1f3fcb631643");
+  uint8_t key[16];
+  uint8_t iv[12];
+  ASSERT_TRUE(tsi::internal::SslKtlsDeriveTrafficKeys(
+      EVP_sha256(), server_application_secret, sizeof(key), key, iv));
+  EXPECT_EQ(absl::BytesToHexString(absl::string_view(
+                reinterpret_cast<const char*>(key), sizeof(key))),
+            "9f02283b6c9c07efc26bb9f2ac92e356");
+  EXPECT_EQ(absl::BytesToHexString(absl::string_view(
+                reinterpret_cast<const char*>(iv), sizeof(iv))),
+            "cf782b88dd83549aadf1e984");
+}
+#endif  // TSI_SSL_KTLS_SUPPORTED
+
 const tsi_ssl_handshaker_factory_vtable* original_vtable;
 bool handshaker_factory_destructor_called;
 
@@ -316,5 +316,136 @@ TEST(LatentSeeTest, FlowWorksAppenderStartsLate) {
   EXPECT_TRUE(IsCollectionStartMark(elems[0]));
 }
 
+Json::Array ParseTrace(const std::string& json) {
+  auto a = JsonParse(json);
+  CHECK_OK(a);
+  CHECK_EQ(a->type(), Json::Type::kArray);
+  return a->array();
+}
+
+Json::Array DumpFlightRecorder() {
+  std::ostringstream out;
+  {
+    latent_see::JsonOutput output(out);
+    latent_see::FlightRecorder::Dump(&output);
+  }
+  return ParseTrace(out.str());
+}
+
+size_t CountEventsNamed(const Json::Array& elems, absl::string_view name) {
+  size_t count = 0;
+  for (const auto& elem : elems) {
+    if (elem.type() != Json::Type::kObject) continue;
+    auto it = elem.object().find("name");
+    if (it != elem.object().end() && it->second.string() == name) ++count;
+  }
+  return count;
+}
+
+void WaitForGatherer() {
+  latent_see::Flush();
+  // Longer than the gatherer's maximum backoff.
+  absl::SleepFor(absl::Seconds(1));
+}
+
+TEST(LatentSeeTest, FlightRecorderDumpsOnDemand) {
+  latent_see::FlightRecorder::Start(latent_see::FlightRecorderOptions());
+  EXPECT_TRUE(latent_see::FlightRecorder::IsRunning());
+  {
+    GRPC_LATENT_SEE_ALWAYS_ON_SCOPE("foo");
+  }
+  WaitForGatherer();
+  auto elems = DumpFlightRecorder();
+  EXPECT_EQ(CountEventsNamed(elems, "foo"), 1);
+  // The dump takes the events out of the recorder.
+  EXPECT_EQ(CountEventsNamed(DumpFlightRecorder(), "foo"), 0);
+  latent_see::FlightRecorder::Stop();
+  EXPECT_FALSE(latent_see::FlightRecorder::IsRunning());
+}
+
+TEST(LatentSeeTest, CollectLeavesFlightRecorderEvents) {
+  latent_see::FlightRecorder::Start(latent_see::FlightRecorderOptions());
+  {
+    GRPC_LATENT_SEE_ALWAYS_ON_SCOPE("foo");
+  }
+  WaitForGatherer();
+  std::ostringstream out;
+  {
+    latent_see::JsonOutput output(out);
+    latent_see::Collect(nullptr, absl::Milliseconds(1),
+                        std::numeric_limits<size_t>::max(), &output);
+  }
+  EXPECT_EQ(CountEventsNamed(ParseTrace(out.str()), "foo"), 1);
+  EXPECT_EQ(CountEventsNamed(DumpFlightRecorder(), "foo"), 1);
+  latent_see::FlightRecorder::Stop();
+}
+
+TEST(LatentSeeTest, CollectHonorsMemoryLimitWhileFlightRecorderRuns) {
+  latent_see::FlightRecorder::Start(latent_see::FlightRecorderOptions());
+  for (size_t i = 0; i < 10 * latent_see::Bin::kEventsPerBin; ++i) {
+    GRPC_LATENT_SEE_ALWAYS_ON_MARK("old");
+  }
+  GRPC_LATENT_SEE_ALWAYS_ON_MARK("new");
+  WaitForGatherer();
+  std::ostringstream out;
+  {
+    latent_see::JsonOutput output(out);
+    latent_see::Collect(nullptr, absl::Milliseconds(1),
+                        sizeof(latent_see::Bin), &output);
+  }
+  auto elems = ParseTrace(out.str());
+  EXPECT_EQ(CountEventsNamed(elems, "new"), 1);
+  EXPECT_LE(CountEventsNamed(elems, "old"),
+            2 * latent_see::Bin::kEventsPerBin);
+  // The recorder itself still holds everything.
+  EXPECT_GT(CountEventsNamed(DumpFlightRecorder(), "old"),
+            2 * latent_see::Bin::kEventsPerBin);
+  latent_see::FlightRecorder::Stop();
+}
+
+TEST(LatentSeeTest, FlightRecorderOverwritesOldestEvents) {
+  latent_see::FlightRecorderOptions options;
+  options.memory_limit = sizeof(latent_see::Bin);
+  latent_see::FlightRecorder::Start(std::move(options));
+  // Fill many more bins than the recorder keeps.
+  for (size_t i = 0; i < 10 * latent_see::Bin::kEventsPerBin; ++i) {
+    GRPC_LATENT_SEE_ALWAYS_ON_MARK("old");
+  }
+  GRPC_LATENT_SEE_ALWAYS_ON_MARK("new");
+  WaitForGatherer();
+  auto elems = DumpFlightRecorder();
+  latent_see::FlightRecorder::Stop();
+  EXPECT_EQ(CountEventsNamed(elems, "new"), 1);
+  EXPECT_LE(CountEventsNamed(elems, "old"),
+            2 * latent_see::Bin::kEventsPerBin);
+}
+
+TEST(LatentSeeTest, FlightRecorderDumpsOnSloBreach) {
+  Notification dumped;
+  std::string trace_json;
+  latent_see::FlightRecorderOptions options;
+  options.latency_slo = absl::Milliseconds(10);
+  options.on_slo_breach = [&](std::string json) {
+    trace_json = std::move(json);
+    dumped.Notify();
+  };
+  latent_see::FlightRecorder::Start(std::move(options));
+  {
+    GRPC_LATENT_SEE_ALWAYS_ON_SCOPE("fast");
+  }
+  latent_see::FlightRecorder::ReportLatency(
+      absl::ToInt64Nanoseconds(absl::Milliseconds(1)));
+  {
+    GRPC_LATENT_SEE_ALWAYS_ON_SCOPE("slow");
+  }
+  latent_see::FlightRecorder::ReportLatency(
+      absl::ToInt64Nanoseconds(absl::Milliseconds(50)));
+  ASSERT_TRUE(dumped.WaitForNotificationWithTimeout(absl::Seconds(10)));
+  latent_see::FlightRecorder::Stop();
+  auto elems = ParseTrace(trace_json);
+  EXPECT_EQ(CountEventsNamed(elems, "fast"), 1);
+  EXPECT_EQ(CountEventsNamed(elems, "slow"), 1);
+}
+
 }  // namespace
 }  // namespace grpc_core
@@ -3606,6 +3606,43 @@ TEST_F(ConnectionScalingTest, MultipleConnections) {
   EXPECT_EQ(servers_[0]->service_.clients().size(), 2);
 }
 
+TEST_F(ConnectionScalingTest, ScalesUpBeforeConnectionIsFull) {
+  SKIP_TEST_FOR_PH2_CLIENT("TODO(tjagtap) [PH2][P3][Client] Fix bug");
+  constexpr char kServiceConfig[] =
+      "{\n"
+      "  \"connectionScaling\": {\n"
+      "    \"maxConnectionsPerSubchannel\": 2\n"
+      "  }\n"
+      "}";
+  const int kMaxConcurrentStreams = 4;
+  // Start a server with MAX_CONCURRENT_STREAMS set.
+  StartServers(1, {}, nullptr,
+               /*max_concurrent_streams=*/kMaxConcurrentStreams);
+  FakeResolverResponseGeneratorWrapper response_generator;
+  ChannelArguments args;
+  args.SetInt(GRPC_ARG_SUBCHANNEL_CONNECTION_SCALE_UP_PERCENT, 50);
+  auto channel = BuildChannel("pick_first", response_generator, args);
+  auto stub = BuildStub(channel);
+  response_generator.SetNextResolution(GetServersPorts(), kServiceConfig);
+  // Start 2 long-running RPCs.  The second one brings the first
+  // connection to half of its MAX_CONCURRENT_STREAMS, which should
+  // trigger a second connection even though the first one still has
+  // room.
+  std::vector<std::unique_ptr<LongRunningRpc>> rpcs;
+  for (size_t i = 0; i < 2; ++i) {
+    rpcs.emplace_back(StartLongRunningRpc(stub.get()));
+  }
+  LOG(INFO) << "Waiting for server to see the initial RPCs...";
+  EXPECT_TRUE(WaitFor([&]() {
+    return servers_[0]->service_.RpcsWaitingForClientCancel() == 2;
+  })) << "timeout waiting for initial RPCs to start -- RPCs started: "
+      << servers_[0]->service_.RpcsWaitingForClientCancel();
+  LOG(INFO) << "Waiting for the second connection...";
+  EXPECT_TRUE(WaitFor([&]() {
+    return servers_[0]->service_.clients().size() == 2;
+  })) << "timeout waiting for second connection";
+}
+
 TEST_F(ConnectionScalingTest, HonorsMaxConnectionsPerSubchannel) {
   SKIP_TEST_FOR_PH2_CLIENT("TODO(tjagtap) [PH2][P3][Client] Fix bug");
   constexpr char kServiceConfig[] =
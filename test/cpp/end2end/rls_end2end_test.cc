@@ -1131,6 +1131,150 @@ TEST_F(RlsEnd2endTest, StaleCacheEntryWithHeaderData) {
   EXPECT_EQ(rls_server_->service_.response_count(), 2);
 }
 
+TEST_F(RlsEnd2endTest, StaleCacheEntryRefreshedTwice) {
+  StartBackends(1);
+  SetNextResolution(
+      MakeServiceConfigBuilder()
+          .AddKeyBuilder(absl::StrFormat("\"names\":[{"
+                                         "  \"service\":\"%s\","
+                                         "  \"method\":\"%s\""
+                                         "}],"
+                                         "\"headers\":["
+                                         "  {"
+                                         "    \"key\":\"%s\","
+                                         "    \"names\":["
+                                         "      \"key1\""
+                                         "    ]"
+                                         "  }"
+                                         "]",
+                                         kServiceValue, kMethodValue, kTestKey))
+          .set_max_age(grpc_core::Duration::Seconds(10))
+          .set_stale_age(grpc_core::Duration::Seconds(1))
+          .Build());
+  rls_server_->service_.SetResponse(
+      BuildRlsRequest({{kTestKey, kTestValue}}),
+      BuildRlsResponse({grpc_core::LocalIpUri(backends_[0]->port_)}));
+  CheckRpcSendOk(DEBUG_LOCATION,
+                 RpcOptions().set_metadata({{"key1", kTestValue}}));
+  EXPECT_EQ(rls_server_->service_.request_count(), 1);
+  rls_server_->service_.RemoveResponse(
+      BuildRlsRequest({{kTestKey, kTestValue}}));
+  rls_server_->service_.SetResponse(
+      BuildRlsRequest({{kTestKey, kTestValue}},
+                      RouteLookupRequest::REASON_STALE),
+      BuildRlsResponse({grpc_core::LocalIpUri(backends_[0]->port_)}));
+  // Once stale, the entry is refreshed by the next pick.
+  gpr_sleep_until(grpc_timeout_seconds_to_deadline(2));
+  CheckRpcSendOk(DEBUG_LOCATION,
+                 RpcOptions().set_metadata({{"key1", kTestValue}}));
+  gpr_sleep_until(grpc_timeout_milliseconds_to_deadline(500));
+  EXPECT_EQ(rls_server_->service_.request_count(), 2);
+  // The response only moved the entry's times, so the entry is fresh again
+  // for the picker that was already published.
+  CheckRpcSendOk(DEBUG_LOCATION,
+                 RpcOptions().set_metadata({{"key1", kTestValue}}));
+  EXPECT_EQ(rls_server_->service_.request_count(), 2);
+  // ... and becoming stale again starts another refresh.
+  gpr_sleep_until(grpc_timeout_seconds_to_deadline(2));
+  CheckRpcSendOk(DEBUG_LOCATION,
+                 RpcOptions().set_metadata({{"key1", kTestValue}}));
+  gpr_sleep_until(grpc_timeout_milliseconds_to_deadline(500));
+  EXPECT_EQ(rls_server_->service_.request_count(), 3);
+  EXPECT_EQ(rls_server_->service_.response_count(), 3);
+  EXPECT_EQ(backends_[0]->service_.request_count(), 4);
+}
+
+TEST_F(RlsEnd2endTest, CachedEntryFollowsNewTargets) {
+  StartBackends(2);
+  SetNextResolution(
+      MakeServiceConfigBuilder()
+          .AddKeyBuilder(absl::StrFormat("\"names\":[{"
+                                         "  \"service\":\"%s\","
+                                         "  \"method\":\"%s\""
+                                         "}],"
+                                         "\"headers\":["
+                                         "  {"
+                                         "    \"key\":\"%s\","
+                                         "    \"names\":["
+                                         "      \"key1\""
+                                         "    ]"
+                                         "  }"
+                                         "]",
+                                         kServiceValue, kMethodValue, kTestKey))
+          .set_max_age(grpc_core::Duration::Seconds(10))
+          .set_stale_age(grpc_core::Duration::Seconds(1))
+          .Build());
+  rls_server_->service_.SetResponse(
+      BuildRlsRequest({{kTestKey, kTestValue}}),
+      BuildRlsResponse({grpc_core::LocalIpUri(backends_[0]->port_)}));
+  CheckRpcSendOk(DEBUG_LOCATION,
+                 RpcOptions().set_metadata({{"key1", kTestValue}}));
+  EXPECT_EQ(backends_[0]->service_.request_count(), 1);
+  // The refresh moves the key to the other backend.
+  rls_server_->service_.RemoveResponse(
+      BuildRlsRequest({{kTestKey, kTestValue}}));
+  rls_server_->service_.SetResponse(
+      BuildRlsRequest({{kTestKey, kTestValue}},
+                      RouteLookupRequest::REASON_STALE),
+      BuildRlsResponse({grpc_core::LocalIpUri(backends_[1]->port_)}));
+  gpr_sleep_until(grpc_timeout_seconds_to_deadline(2));
+  // Served from the stale data while the refresh is pending.
+  CheckRpcSendOk(DEBUG_LOCATION,
+                 RpcOptions().set_metadata({{"key1", kTestValue}}));
+  EXPECT_EQ(backends_[0]->service_.request_count(), 2);
+  // Once the new child policy is ready, the key goes to the new target.
+  for (int i = 0; backends_[1]->service_.request_count() == 0; ++i) {
+    ASSERT_LT(i, 50) << "key never moved to backend 1";
+    CheckRpcSendOk(DEBUG_LOCATION,
+                   RpcOptions().set_metadata({{"key1", kTestValue}}));
+    gpr_sleep_until(grpc_timeout_milliseconds_to_deadline(100));
+  }
+  const size_t backend0_requests = backends_[0]->service_.request_count();
+  for (int i = 0; i < 5; ++i) {
+    CheckRpcSendOk(DEBUG_LOCATION,
+                   RpcOptions().set_metadata({{"key1", kTestValue}}));
+  }
+  EXPECT_EQ(backends_[0]->service_.request_count(), backend0_requests);
+  EXPECT_EQ(rls_server_->service_.request_count(), 2);
+}
+
+TEST_F(RlsEnd2endTest, CachedEntryFollowsChildPolicyState) {
+  StartBackends(2);
+  SetNextResolution(
+      MakeServiceConfigBuilder()
+          .AddKeyBuilder(absl::StrFormat("\"names\":[{"
+                                         "  \"service\":\"%s\","
+                                         "  \"method\":\"%s\""
+                                         "}],"
+                                         "\"headers\":["
+                                         "  {"
+                                         "    \"key\":\"%s\","
+                                         "    \"names\":["
+                                         "      \"key1\""
+                                         "    ]"
+                                         "  }"
+                                         "]",
+                                         kServiceValue, kMethodValue, kTestKey))
+          .Build());
+  rls_server_->service_.SetResponse(
+      BuildRlsRequest({{kTestKey, kTestValue}}),
+      BuildRlsResponse({grpc_core::LocalIpUri(backends_[0]->port_),
+                        grpc_core::LocalIpUri(backends_[1]->port_)}));
+  CheckRpcSendOk(DEBUG_LOCATION,
+                 RpcOptions().set_metadata({{"key1", kTestValue}}));
+  EXPECT_EQ(backends_[0]->service_.request_count(), 1);
+  EXPECT_EQ(backends_[1]->service_.request_count(), 0);
+  // When the first target's child policy fails, the entry's snapshot is
+  // rebuilt and picks move to the second target without a new RLS
+  // response.
+  backends_[0]->Shutdown();
+  CheckRpcSendOk(DEBUG_LOCATION, RpcOptions()
+                                     .set_metadata({{"key1", kTestValue}})
+                                     .set_wait_for_ready(true));
+  EXPECT_EQ(backends_[1]->service_.request_count(), 1);
+  EXPECT_EQ(rls_server_->service_.request_count(), 1);
+}
+
 TEST_F(RlsEnd2endTest, ExpiredCacheEntry) {
   StartBackends(1);
   SetNextResolution(
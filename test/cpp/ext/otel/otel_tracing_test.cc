@@ -783,6 +783,93 @@ TEST_F(OTelTracingTestNoPropagator, PropagationParentToChildWithoutPropagator) {
   EXPECT_NE((*server_span)->GetTraceId(), (*test_span)->GetTraceId());
 }
 
+class OTelTracingTestWithCpuBudget : public OTelTracingTest {
+ protected:
+  absl::Status BuildAndRegisterOpenTelemetryPlugin(
+      std::shared_ptr<opentelemetry::sdk::trace::TracerProvider>
+          tracer_provider) override {
+    // No budget at all, so calls that start a trace are sampled at the
+    // minimum rate once the sampler has adjusted.
+    return OpenTelemetryPluginBuilder()
+        .SetTracerProvider(std::move(tracer_provider))
+        .SetTextMapPropagator(
+            OpenTelemetryPluginBuilder::MakeGrpcTraceBinTextMapPropagator())
+        .SetTracingCpuBudget(0)
+        .BuildAndRegisterGlobal();
+  }
+
+  // Sends calls without a parent span until one is not traced.
+  bool WaitForRootCallsToBeUnsampled() {
+    const absl::Time deadline = absl::Now() + absl::Seconds(30);
+    while (absl::Now() < deadline) {
+      SendRPC(stub_.get());
+      const auto spans = data_->GetSpans();
+      if (std::none_of(spans.begin(), spans.end(),
+                       [](const std::unique_ptr<SpanData>& span) {
+                         return span->GetName() ==
+                                "Sent.grpc.testing.EchoTestService/Echo";
+                       })) {
+        // Let spans of earlier server calls finish before the test looks.
+        absl::SleepFor(absl::Milliseconds(100));
+        data_->GetSpans();
+        return true;
+      }
+    }
+    return false;
+  }
+};
+
+// Tests that a sampled parent's decision is followed across calls even once
+// the sampler has stopped tracing calls that start a trace.
+TEST_F(OTelTracingTestWithCpuBudget, SampledParentPropagatesToChild) {
+  ASSERT_TRUE(WaitForRootCallsToBeUnsampled());
+  {
+    grpc::ServerBuilder builder;
+    int port = grpc_pick_unused_port_or_die();
+    builder.AddListeningPort(grpc_core::JoinHostPort("0.0.0.0", port),
+                             grpc::InsecureServerCredentials(), nullptr);
+    PropagatingEchoTestServiceImpl service(stub_.get());
+    builder.RegisterService(&service);
+    auto server = builder.BuildAndStart();
+    auto channel = grpc::CreateChannel(absl::StrCat("localhost:", port),
+                                       grpc::InsecureChannelCredentials());
+    auto stub = EchoTestService::NewStub(channel);
+    auto span = tracer_->StartSpan("TestSpan");
+    auto scope = opentelemetry::sdk::trace::Tracer::WithActiveSpan(span);
+    SendRPC(stub.get());
+  }
+  // Test span, then a client, attempt and server span for each of the two
+  // calls.
+  auto spans = GetSpans(7);
+  EXPECT_EQ(spans.size(), 7);
+  const auto test_span = std::find_if(
+      spans.begin(), spans.end(), [&](const std::unique_ptr<SpanData>& span) {
+        return span->GetName() == "TestSpan";
+      });
+  ASSERT_NE(test_span, spans.end());
+  for (const auto& span : spans) {
+    EXPECT_EQ(span->GetTraceId(), (*test_span)->GetTraceId())
+        << span->GetName();
+  }
+  // The server span of the second call is the end of the chain.
+  const auto server_span = std::find_if(
+      spans.begin(), spans.end(), [&](const std::unique_ptr<SpanData>& span) {
+        return span->GetName() == "Recv.grpc.testing.EchoTestService/Echo" &&
+               std::none_of(spans.begin(), spans.end(),
+                            [&](const std::unique_ptr<SpanData>& child) {
+                              return child->GetParentSpanId() ==
+                                     span->GetSpanId();
+                            });
+      });
+  ASSERT_NE(server_span, spans.end());
+  const auto attempt_span = std::find_if(
+      spans.begin(), spans.end(), [&](const std::unique_ptr<SpanData>& span) {
+        return span->GetName() == "Attempt.grpc.testing.EchoTestService/Echo" &&
+               span->GetSpanId() == (*server_span)->GetParentSpanId();
+      });
+  EXPECT_NE(attempt_span, spans.end());
+}
+
 #ifdef GRPC_LINUX_ERRQUEUE
 // Test presence of TCP write annotations
 TEST_F(OTelTracingTest, TcpWriteAnnotations) {
@@ -26,8 +26,11 @@
 
 #include <memory>
 #include <sstream>
+#include <string>
+#include <vector>
 
 #include "src/core/call/metadata_batch.h"
+#include "src/core/ext/transport/chttp2/transport/hpack_constants.h"
 #include "src/core/ext/transport/chttp2/transport/hpack_encoder.h"
 #include "src/core/ext/transport/chttp2/transport/hpack_parser.h"
 #include "src/core/lib/resource_quota/resource_quota.h"
@@ -42,6 +45,7 @@
 #include "test/cpp/util/test_config.h"
 #include "absl/log/log.h"
 #include "absl/random/random.h"
+#include "absl/strings/str_format.h"
 
 static grpc_slice MakeSlice(const std::vector<uint8_t>& bytes) {
   grpc_slice s = grpc_slice_malloc(bytes.size());
@@ -630,6 +634,37 @@ class SameDeadline {
   }
 };
 
+// Fill the dynamic table with kEntries headers, then look every one of them
+// up by index.
+template <int kEntries>
+class IndexedLargeTable {
+ public:
+  static_assert(kEntries < 127 - grpc_core::hpack_constants::kLastStaticEntry,
+                "indices must fit in one byte");
+
+  static std::vector<grpc_slice> GetInitSlices() {
+    std::vector<uint8_t> bytes;
+    for (int i = 0; i < kEntries; ++i) {
+      const std::string key = absl::StrFormat("x-key-%02d", i);
+      const std::string value = absl::StrFormat("value-%02d", i);
+      bytes.push_back(0x40);
+      bytes.push_back(key.size());
+      bytes.insert(bytes.end(), key.begin(), key.end());
+      bytes.push_back(value.size());
+      bytes.insert(bytes.end(), value.begin(), value.end());
+    }
+    return {MakeSlice(bytes)};
+  }
+  static std::vector<grpc_slice> GetBenchmarkSlices() {
+    std::vector<uint8_t> bytes;
+    for (int i = 0; i < kEntries; ++i) {
+      bytes.push_back(0x80 |
+                      (grpc_core::hpack_constants::kLastStaticEntry + 1 + i));
+    }
+    return {MakeSlice(bytes)};
+  }
+};
+
 BENCHMARK_TEMPLATE(BM_HpackParserParseHeader, EmptyBatch);
 BENCHMARK_TEMPLATE(BM_HpackParserParseHeader, IndexedSingleStaticElem);
 BENCHMARK_TEMPLATE(BM_HpackParserParseHeader, AddIndexedSingleStaticElem);
@@ -663,6 +698,8 @@ BENCHMARK_TEMPLATE(BM_HpackParserParseHeader,
 BENCHMARK_TEMPLATE(BM_HpackParserParseHeader,
                    RepresentativeServerInitialMetadata);
 BENCHMARK_TEMPLATE(BM_HpackParserParseHeader, SameDeadline);
+BENCHMARK_TEMPLATE(BM_HpackParserParseHeader, IndexedLargeTable<16>);
+BENCHMARK_TEMPLATE(BM_HpackParserParseHeader, IndexedLargeTable<64>);
 
 }  // namespace hpack_parser_fixtures
 
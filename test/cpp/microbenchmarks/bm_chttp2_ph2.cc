@@ -0,0 +1,233 @@
+//
+//
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+// Microbenchmarks for the pieces of the promise based HTTP/2 transport (ph2)
+// that sit between the call stack and the endpoint: header (dis)assembly, the
+// per stream data queue and the write cycle.
+
+#include <benchmark/benchmark.h>
+#include <grpc/support/port_platform.h>
+
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <variant>
+
+#include "src/core/call/message.h"
+#include "src/core/call/metadata.h"
+#include "src/core/call/metadata_batch.h"
+#include "src/core/ext/transport/chttp2/transport/frame.h"
+#include "src/core/ext/transport/chttp2/transport/header_assembler.h"
+#include "src/core/ext/transport/chttp2/transport/hpack_encoder.h"
+#include "src/core/ext/transport/chttp2/transport/hpack_parser.h"
+#include "src/core/ext/transport/chttp2/transport/http2_status.h"
+#include "src/core/ext/transport/chttp2/transport/stream_data_queue.h"
+#include "src/core/ext/transport/chttp2/transport/write_cycle.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/resource_quota/arena.h"
+#include "src/core/lib/slice/slice.h"
+#include "src/core/lib/slice/slice_buffer.h"
+#include "src/core/util/grpc_check.h"
+#include "src/core/util/ref_counted_ptr.h"
+#include "test/core/test_util/test_config.h"
+#include "test/cpp/microbenchmarks/helpers.h"
+#include "test/cpp/util/test_config.h"
+
+namespace grpc_core {
+namespace http2 {
+namespace {
+
+// The default SETTINGS_MAX_FRAME_SIZE.
+constexpr uint32_t kMaxFrameLength = 16384;
+constexpr uint32_t kUnlimitedTokens = std::numeric_limits<uint32_t>::max();
+
+ClientMetadataHandle RepresentativeClientInitialMetadata() {
+  ClientMetadataHandle md = Arena::MakePooledForOverwrite<ClientMetadata>();
+  md->Set(HttpSchemeMetadata(), HttpSchemeMetadata::kHttp);
+  md->Set(HttpMethodMetadata(), HttpMethodMetadata::kPost);
+  md->Set(HttpPathMetadata(),
+          Slice::FromStaticString("/grpc.testing.EchoTestService/Echo"));
+  md->Set(HttpAuthorityMetadata(),
+          Slice::FromStaticString("foo.test.google.fr:1234"));
+  md->Set(TeMetadata(), TeMetadata::kTrailers);
+  md->Set(ContentTypeMetadata(), ContentTypeMetadata::kApplicationGrpc);
+  md->Set(UserAgentMetadata(),
+          Slice::FromStaticString("grpc-c/3.0.0-dev (linux; chttp2)"));
+  return md;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Header assembly
+//
+
+// Encodes client initial metadata into HEADERS/CONTINUATION frames of at most
+// state.range(0) bytes, then reassembles and parses them as the server would.
+void BM_Ph2HeaderRoundTrip(benchmark::State& state) {
+  ExecCtx exec_ctx;
+  const uint32_t max_frame_length = state.range(0);
+  HPackCompressor encoder;
+  HPackParser parser;
+  uint32_t stream_id = 1;
+  int64_t frames = 0;
+  for (auto _ : state) {
+    HeaderDisassembler disassembler(/*is_trailing_metadata=*/false);
+    disassembler.Initialize(stream_id,
+                            /*allow_true_binary_metadata_peer=*/false);
+    GRPC_CHECK(disassembler.PrepareForSending(
+        RepresentativeClientInitialMetadata(), encoder));
+    HeaderAssembler assembler(/*is_client=*/false);
+    assembler.SetStreamId(stream_id);
+    while (disassembler.HasMoreData()) {
+      bool end_headers;
+      Http2Frame frame =
+          disassembler.GetNextFrame(max_frame_length, end_headers);
+      ++frames;
+      Http2Status status =
+          std::holds_alternative<Http2HeaderFrame>(frame)
+              ? assembler.AppendFrame(std::get<Http2HeaderFrame>(frame))
+              : assembler.AppendFrame(std::get<Http2ContinuationFrame>(frame));
+      GRPC_CHECK(status.IsOk());
+    }
+    GRPC_CHECK(assembler.IsReady());
+    auto metadata = assembler.ReadMetadata(parser, /*is_initial_metadata=*/true,
+                                           kUnlimitedTokens, kUnlimitedTokens);
+    GRPC_CHECK(metadata.IsOk());
+    stream_id += 2;
+    ExecCtx::Get()->Flush();
+  }
+  state.counters["frames_per_header"] =
+      benchmark::Counter(frames, benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(BM_Ph2HeaderRoundTrip)->Arg(kMaxFrameLength)->Arg(64)->Arg(16);
+
+////////////////////////////////////////////////////////////////////////////////
+// StreamDataQueue
+//
+
+// A client stream's whole life through its data queue: initial metadata,
+// state.range(1) messages of state.range(0) bytes and a half close are
+// enqueued, then drained into one write cycle and serialized.
+void BM_Ph2StreamDataQueue(benchmark::State& state) {
+  ExecCtx exec_ctx;
+  const uint32_t message_size = state.range(0);
+  const int64_t messages = state.range(1);
+  auto arena_allocator = SimpleArenaAllocator(0);
+  HPackCompressor encoder;
+  TransportWriteContext write_context(/*is_client=*/true);
+  const Slice payload = Slice::ZeroContentsWithLength(message_size);
+  uint32_t stream_id = 1;
+  for (auto _ : state) {
+    // Like the transport, allocate each stream's queue from its call arena.
+    RefCountedPtr<Arena> arena = arena_allocator->MakeArena();
+    auto queue = MakeRefCounted<StreamDataQueue<ClientMetadataHandle>>(
+        arena.get(), /*is_client=*/true, /*queue_size=*/kUnlimitedTokens);
+    queue->SetStreamId(stream_id, /*allow_true_binary_metadata_peer=*/false);
+    GRPC_CHECK_OK(
+        queue->EnqueueInitialMetadata(RepresentativeClientInitialMetadata()));
+    for (int64_t i = 0; i < messages; ++i) {
+      // The queue is large enough that enqueueing never has to wait.
+      auto enqueue = queue->EnqueueMessage(Arena::MakePooled<Message>(
+          SliceBuffer(payload.Ref()), /*flags=*/0));
+      auto result = enqueue();
+      GRPC_CHECK(result.ready());
+      GRPC_CHECK_OK(result.value());
+    }
+    GRPC_CHECK_OK(queue->EnqueueHalfClosed());
+    write_context.StartWriteCycle();
+    WriteCycle& write_cycle = write_context.GetWriteCycle();
+    FrameSender frame_sender = write_cycle.GetFrameSender();
+    auto dequeued = queue->DequeueFrames(kUnlimitedTokens, kMaxFrameLength,
+                                         kUnlimitedTokens, encoder,
+                                         frame_sender,
+                                         /*can_send_reset_stream=*/true);
+    GRPC_CHECK(dequeued.IsHalfCloseDequeued());
+    bool should_reset_ping_clock;
+    SliceBuffer output =
+        write_cycle.SerializeRegularFrames({should_reset_ping_clock});
+    benchmark::DoNotOptimize(output.Length());
+    write_context.EndWriteCycle();
+    stream_id += 2;
+    ExecCtx::Get()->Flush();
+  }
+  state.SetBytesProcessed(state.iterations() * messages * message_size);
+}
+BENCHMARK(BM_Ph2StreamDataQueue)
+    ->Args({0, 1})
+    ->Args({1, 1})
+    ->Args({1024, 1})
+    ->Args({1024, 16})
+    ->Args({64 * 1024, 1})
+    ->Args({1024 * 1024, 1});
+
+////////////////////////////////////////////////////////////////////////////////
+// Write cycle
+//
+
+// Queues state.range(0) DATA frames of state.range(1) bytes into a write cycle
+// and serializes them into one endpoint write.
+void BM_Ph2WriteCycleSerialize(benchmark::State& state) {
+  ExecCtx exec_ctx;
+  const int64_t num_frames = state.range(0);
+  const uint32_t frame_size = state.range(1);
+  TransportWriteContext write_context(/*is_client=*/true);
+  const Slice payload = Slice::ZeroContentsWithLength(frame_size);
+  for (auto _ : state) {
+    write_context.StartWriteCycle();
+    WriteCycle& write_cycle = write_context.GetWriteCycle();
+    {
+      FrameSender frame_sender = write_cycle.GetFrameSender();
+      frame_sender.ReserveRegularFrames(num_frames);
+      for (int64_t i = 0; i < num_frames; ++i) {
+        frame_sender.AddRegularFrame(Http2DataFrame{
+            static_cast<uint32_t>(2 * i + 1), /*end_stream=*/false,
+            SliceBuffer(payload.Ref())});
+      }
+    }
+    bool should_reset_ping_clock;
+    SliceBuffer output =
+        write_cycle.SerializeRegularFrames({should_reset_ping_clock});
+    benchmark::DoNotOptimize(output.Length());
+    write_context.EndWriteCycle();
+  }
+  state.SetBytesProcessed(state.iterations() * num_frames * frame_size);
+}
+BENCHMARK(BM_Ph2WriteCycleSerialize)
+    ->Args({1, 0})
+    ->Args({1, 1024})
+    ->Args({8, 1024})
+    ->Args({64, 1024})
+    ->Args({8, kMaxFrameLength});
+
+}  // namespace
+}  // namespace http2
+}  // namespace grpc_core
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  LibraryInitializer libInit;
+  ::benchmark::Initialize(&argc, argv);
+  grpc::testing::InitTest(&argc, &argv, false);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
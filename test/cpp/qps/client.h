@@ -42,6 +42,7 @@
 #include "src/proto/grpc/testing/payloads.pb.h"
 #include "test/cpp/qps/histogram.h"
 #include "test/cpp/qps/interarrival.h"
+#include "test/cpp/qps/load_profile.h"
 #include "test/cpp/qps/qps_worker.h"
 #include "test/cpp/qps/server.h"
 #include "test/cpp/qps/usage_timer.h"
@@ -251,13 +252,31 @@ class Client {
 
   gpr_timespec NextIssueTime(int thread_idx) {
     const gpr_timespec result = next_time_[thread_idx];
-    next_time_[thread_idx] =
-        gpr_time_add(next_time_[thread_idx],
-                     gpr_time_from_nanos(interarrival_timer_.next(thread_idx),
-                                         GPR_TIMESPAN));
+    int64_t interval_ns = interarrival_timer_.next(thread_idx);
+    if (load_profile_ != nullptr) {
+      // The table holds interarrival times for one RPC per second; scale
+      // them to this thread's share of the load at this point in the run.
+      const double seconds =
+          gpr_timespec_to_micros(gpr_time_sub(result, load_start_time_)) /
+          1e6;
+      interval_ns = static_cast<int64_t>(
+          interval_ns * load_threads_ / load_profile_->OfferedLoadAt(seconds));
+    }
+    next_time_[thread_idx] = gpr_time_add(
+        next_time_[thread_idx], gpr_time_from_nanos(interval_ns, GPR_TIMESPAN));
     return result;
   }
 
+  // Open-loop RPCs measure their latency from the time they were scheduled
+  // to be issued rather than when they actually went out. Otherwise a client
+  // that falls behind its schedule quietly lowers the offered load instead
+  // of reporting the queueing it would have caused (coordinated omission).
+  static double IssueTimeToUsageTime(gpr_timespec issue_time) {
+    const gpr_timespec t =
+        gpr_convert_clock_type(issue_time, GPR_CLOCK_REALTIME);
+    return t.tv_sec + 1e-9 * t.tv_nsec;
+  }
+
   bool ThreadCompleted() {
     return static_cast<bool>(gpr_atm_acq_load(&thread_pool_done_));
   }
@@ -373,6 +392,11 @@ class Client {
         random_dist = std::make_unique<ExpDist>(load.poisson().offered_load() /
                                                 num_threads);
         break;
+      case LoadParams::kStepped:
+        load_profile_ = std::make_unique<LoadProfile>(load.stepped());
+        load_threads_ = num_threads;
+        random_dist = std::make_unique<ExpDist>(1.0);
+        break;
       default:
         grpc_core::Crash("unreachable");
     }
@@ -385,10 +409,10 @@ class Client {
       // set up interarrival timer according to random dist
       interarrival_timer_.init(*random_dist, num_threads);
       const auto now = gpr_now(GPR_CLOCK_MONOTONIC);
+      load_start_time_ = now;
       for (size_t i = 0; i < num_threads; i++) {
-        next_time_.push_back(gpr_time_add(
-            now,
-            gpr_time_from_nanos(interarrival_timer_.next(i), GPR_TIMESPAN)));
+        next_time_.push_back(now);
+        NextIssueTime(i);
       }
     }
   }
@@ -405,6 +429,10 @@ class Client {
 
   InterarrivalTimer interarrival_timer_;
   std::vector<gpr_timespec> next_time_;
+  // Only set for stepped load.
+  std::unique_ptr<LoadProfile> load_profile_;
+  gpr_timespec load_start_time_;
+  size_t load_threads_ = 1;
 
   std::mutex thread_completion_mu_;
   size_t threads_remaining_;
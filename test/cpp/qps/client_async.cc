@@ -92,7 +92,7 @@ class ClientRpcContextUnaryImpl : public ClientRpcContext {
   bool RunNextState(bool /*ok*/, HistogramEntry* entry) override {
     switch (next_state_) {
       case State::READY:
-        start_ = UsageTimer::Now();
+        if (!next_issue_) start_ = UsageTimer::Now();
         response_reader_ = prepare_req_(stub_, &context_, req_, cq_);
         response_reader_->StartCall();
         next_state_ = State::RESP_DONE;
@@ -143,8 +143,10 @@ class ClientRpcContextUnaryImpl : public ClientRpcContext {
     if (!next_issue_) {  // ready to issue
       RunNextState(true, nullptr);
     } else {  // wait for the issue time
+      const gpr_timespec issue_time = next_issue_();
+      start_ = Client::IssueTimeToUsageTime(issue_time);
       alarm_ = std::make_unique<Alarm>();
-      alarm_->Set(cq_, next_issue_(), ClientRpcContext::tag(this));
+      alarm_->Set(cq_, issue_time, ClientRpcContext::tag(this));
     }
   }
 };
@@ -375,16 +377,19 @@ class ClientRpcContextStreamingPingPongImpl : public ClientRpcContext {
             next_state_ = State::WAIT;
           }
           break;  // loop around, don't return
-        case State::WAIT:
+        case State::WAIT: {
+          const gpr_timespec issue_time = next_issue_();
+          start_ = Client::IssueTimeToUsageTime(issue_time);
           next_state_ = State::READY_TO_WRITE;
           alarm_ = std::make_unique<Alarm>();
-          alarm_->Set(cq_, next_issue_(), ClientRpcContext::tag(this));
+          alarm_->Set(cq_, issue_time, ClientRpcContext::tag(this));
           return true;
+        }
         case State::READY_TO_WRITE:
           if (!ok) {
             return false;
           }
-          start_ = UsageTimer::Now();
+          if (!next_issue_) start_ = UsageTimer::Now();
           next_state_ = State::WRITE_DONE;
           if (coalesce_ && messages_issued_ == messages_per_stream_ - 1) {
             stream_->WriteLast(req_, WriteOptions(),
@@ -561,16 +566,19 @@ class ClientRpcContextStreamingFromClientImpl : public ClientRpcContext {
             next_state_ = State::WAIT;
           }
           break;  // loop around, don't return
-        case State::WAIT:
+        case State::WAIT: {
+          const gpr_timespec issue_time = next_issue_();
+          start_ = Client::IssueTimeToUsageTime(issue_time);
           alarm_ = std::make_unique<Alarm>();
-          alarm_->Set(cq_, next_issue_(), ClientRpcContext::tag(this));
+          alarm_->Set(cq_, issue_time, ClientRpcContext::tag(this));
           next_state_ = State::READY_TO_WRITE;
           return true;
+        }
         case State::READY_TO_WRITE:
           if (!ok) {
             return false;
           }
-          start_ = UsageTimer::Now();
+          if (!next_issue_) start_ = UsageTimer::Now();
           next_state_ = State::WRITE_DONE;
           stream_->Write(req_, ClientRpcContext::tag(this));
           return true;
@@ -808,16 +816,19 @@ class ClientRpcContextGenericStreamingImpl : public ClientRpcContext {
             next_state_ = State::WAIT;
           }
           break;  // loop around, don't return
-        case State::WAIT:
+        case State::WAIT: {
+          const gpr_timespec issue_time = next_issue_();
+          start_ = Client::IssueTimeToUsageTime(issue_time);
           next_state_ = State::READY_TO_WRITE;
           alarm_ = std::make_unique<Alarm>();
-          alarm_->Set(cq_, next_issue_(), ClientRpcContext::tag(this));
+          alarm_->Set(cq_, issue_time, ClientRpcContext::tag(this));
           return true;
+        }
         case State::READY_TO_WRITE:
           if (!ok) {
             return false;
           }
-          start_ = UsageTimer::Now();
+          if (!next_issue_) start_ = UsageTimer::Now();
           next_state_ = State::WRITE_DONE;
           stream_->Write(req_, ClientRpcContext::tag(this));
           return true;
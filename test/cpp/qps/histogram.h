@@ -19,8 +19,13 @@
 #ifndef GRPC_TEST_CPP_QPS_HISTOGRAM_H
 #define GRPC_TEST_CPP_QPS_HISTOGRAM_H
 
+#include <algorithm>
+#include <cmath>
+#include <string>
+
 #include "src/proto/grpc/testing/stats.pb.h"
 #include "test/core/test_util/histogram.h"
+#include "absl/strings/str_format.h"
 
 namespace grpc {
 namespace testing {
@@ -68,6 +73,49 @@ class Histogram {
                                   p.sum_of_squares(), p.count());
   }
 
+  // Renders the histogram in HdrHistogram's percentile distribution format,
+  // so that it can be fed to the usual HdrHistogram plotting tools. Values
+  // are divided by value_scale, e.g. 1000 to turn nanoseconds into
+  // microseconds. Each halving of the distance to the 100th percentile gets
+  // ticks_per_half_distance rows.
+  std::string ToHdrPercentileDistribution(
+      double value_scale, int ticks_per_half_distance = 5) const {
+    std::string out = absl::StrFormat("%12s %14s %10s %14s\n\n", "Value",
+                                      "Percentile", "TotalCount",
+                                      "1/(1-Percentile)");
+    const double count = Count();
+    auto add_row = [&](double percentile) {
+      absl::StrAppendFormat(&out, "%12.3f %2.12f %10.0f",
+                            Percentile(percentile * 100) / value_scale,
+                            percentile, std::ceil(count * percentile));
+      if (percentile < 1) {
+        absl::StrAppendFormat(&out, " %14.2f", 1 / (1 - percentile));
+      }
+      out += "\n";
+    };
+    if (count > 0) {
+      // Stop once the remaining distance covers less than one sample.
+      for (double base = 0, half = 0.5; 1 - base > 1 / count;
+           base += half, half /= 2) {
+        for (int i = 0; i < ticks_per_half_distance; i++) {
+          add_row(base + half * i / ticks_per_half_distance);
+        }
+      }
+      add_row(1);
+    }
+    const double mean = count > 0 ? grpc_histogram_sum(impl_) / count : 0;
+    const double variance =
+        count > 0 ? grpc_histogram_sum_of_squares(impl_) / count - mean * mean
+                  : 0;
+    absl::StrAppendFormat(
+        &out, "#[Mean    = %12.3f, StdDeviation   = %12.3f]\n",
+        mean / value_scale, std::sqrt(std::max(variance, 0.0)) / value_scale);
+    absl::StrAppendFormat(&out,
+                          "#[Max     = %12.3f, Total count    = %12.0f]\n",
+                          grpc_histogram_maximum(impl_) / value_scale, count);
+    return out;
+  }
+
   static double default_resolution() { return 0.01; }
   static double default_max_possible() { return 60e9; }
 
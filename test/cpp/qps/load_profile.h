@@ -0,0 +1,78 @@
+//
+//
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#ifndef GRPC_TEST_CPP_QPS_LOAD_PROFILE_H
+#define GRPC_TEST_CPP_QPS_LOAD_PROFILE_H
+
+#include <vector>
+
+#include "src/core/util/crash.h"
+#include "src/proto/grpc/testing/control.pb.h"
+#include "absl/strings/str_format.h"
+
+namespace grpc {
+namespace testing {
+
+// The offered load of a stepped run as a function of time since the client
+// started. Each step holds its rate for its duration, or with ramp set moves
+// linearly towards the next step's rate. The last step's rate is held once
+// the profile runs out.
+class LoadProfile {
+ public:
+  explicit LoadProfile(const SteppedLoadParams& params) : ramp_(params.ramp()) {
+    if (params.steps().empty()) {
+      grpc_core::Crash("stepped load needs at least one step");
+    }
+    for (const auto& step : params.steps()) {
+      if (step.offered_load() <= 0) {
+        grpc_core::Crash(absl::StrFormat(
+            "offered_load must be positive, got %f", step.offered_load()));
+      }
+      steps_.push_back({step.offered_load(), step.duration_seconds()});
+    }
+  }
+
+  double OfferedLoadAt(double seconds) const {
+    for (size_t i = 0; i < steps_.size(); i++) {
+      const Step& step = steps_[i];
+      if (seconds >= step.duration_seconds) {
+        seconds -= step.duration_seconds;
+        continue;
+      }
+      if (!ramp_ || i + 1 == steps_.size()) return step.offered_load;
+      const double next = steps_[i + 1].offered_load;
+      return step.offered_load +
+             (next - step.offered_load) * seconds / step.duration_seconds;
+    }
+    return steps_.back().offered_load;
+  }
+
+ private:
+  struct Step {
+    double offered_load;
+    double duration_seconds;
+  };
+
+  const bool ramp_;
+  std::vector<Step> steps_;
+};
+
+}  // namespace testing
+}  // namespace grpc
+
+#endif  // GRPC_TEST_CPP_QPS_LOAD_PROFILE_H
@@ -52,6 +52,7 @@ def qps_json_driver_batch():
             deps = [
                 ":benchmark_config",
                 ":driver_impl",
+                ":histogram",
                 "//:gpr",
                 "//:grpc++",
                 "//:grpc++_config_proto",
@@ -66,6 +67,7 @@ def qps_json_driver_batch():
                 "absl/log:check",
                 "absl/log",
                 "absl/flags:flag",
+                "absl/strings",
             ],
             tags = [
                 "qps_json_driver",
@@ -28,6 +28,7 @@
 #include "test/core/test_util/test_config.h"
 #include "test/cpp/qps/benchmark_config.h"
 #include "test/cpp/qps/driver.h"
+#include "test/cpp/qps/histogram.h"
 #include "test/cpp/qps/parse_json.h"
 #include "test/cpp/qps/report.h"
 #include "test/cpp/qps/server.h"
@@ -35,6 +36,7 @@
 #include "test/cpp/util/test_credentials_provider.h"
 #include "absl/flags/flag.h"
 #include "absl/log/log.h"
+#include "absl/strings/str_cat.h"
 
 ABSL_FLAG(std::string, scenarios_file, "",
           "JSON file containing an array of Scenario objects");
@@ -46,11 +48,19 @@ ABSL_FLAG(std::string, search_param, "",
           "targeted cpu load. For now, we have 'offered_load'. Later, "
           "'num_channels', 'num_outstanding_requests', etc. shall be "
           "added.");
+ABSL_FLAG(std::string, search_metric, "cpu_load",
+          "What the search holds at its target: 'cpu_load' searches for the "
+          "load that reaches --targeted_cpu_load, 'p99_latency' for the "
+          "highest load whose p99 latency stays under "
+          "--targeted_p99_latency_us.");
 ABSL_FLAG(
     double, initial_search_value, 0.0,
     "initial parameter value to start the search with (i.e. lower bound)");
 ABSL_FLAG(double, targeted_cpu_load, 70.0,
           "Targeted cpu load (unit: %, range [0,100])");
+ABSL_FLAG(double, targeted_p99_latency_us, 1000.0,
+          "Targeted p99 latency in microseconds, for "
+          "--search_metric=p99_latency");
 ABSL_FLAG(double, stride, 1,
           "Defines each stride of the search. The larger the stride is, "
           "the coarser the result will be, but will also be faster.");
@@ -64,6 +74,9 @@ ABSL_FLAG(std::string, qps_server_target_override, "",
           "Only applicable if there is a single benchmark server.");
 
 ABSL_FLAG(std::string, json_file_out, "", "File to write the JSON output to.");
+ABSL_FLAG(std::string, latency_hdr_file_out, "",
+          "File to write the latency histogram to, in HdrHistogram's "
+          "percentile distribution format with microsecond values.");
 
 ABSL_FLAG(std::string, credential_type, grpc::testing::kInsecureCredentialsType,
           "Credential type for communication with workers");
@@ -170,10 +183,20 @@ static std::unique_ptr<ScenarioResult> RunAndReport(
     json_outfile.close();
   }
 
+  if (!absl::GetFlag(FLAGS_latency_hdr_file_out).empty()) {
+    Histogram latencies;
+    latencies.MergeProto(result->latencies());
+    std::ofstream hdr_outfile(absl::GetFlag(FLAGS_latency_hdr_file_out));
+    hdr_outfile << latencies.ToHdrPercentileDistribution(1000);
+  }
+
   return result;
 }
 
-static double GetCpuLoad(
+// Runs the scenario at the given offered load and returns the value of
+// --search_metric. Both metrics grow with the load, so the search looks for
+// the largest load that keeps the metric under its target.
+static double GetSearchMetric(
     Scenario* scenario, double offered_load,
     const std::map<std::string, std::string>& per_worker_credential_types,
     bool* success) {
@@ -182,23 +205,26 @@ static double GetCpuLoad(
       ->mutable_poisson()
       ->set_offered_load(offered_load);
   auto result = RunAndReport(*scenario, per_worker_credential_types, success);
+  if (absl::GetFlag(FLAGS_search_metric) == "p99_latency") {
+    return result->summary().latency_99() / 1000;
+  }
   return result->summary().server_cpu_usage();
 }
 
 static double BinarySearch(
-    Scenario* scenario, double targeted_cpu_load, double low, double high,
+    Scenario* scenario, double targeted_metric, double low, double high,
     const std::map<std::string, std::string>& per_worker_credential_types,
     bool* success) {
   while (low <= high * (1 - absl::GetFlag(FLAGS_error_tolerance))) {
     double mid = low + ((high - low) / 2);
-    double current_cpu_load =
-        GetCpuLoad(scenario, mid, per_worker_credential_types, success);
+    double current_metric =
+        GetSearchMetric(scenario, mid, per_worker_credential_types, success);
     VLOG(2) << absl::StrFormat("Binary Search: current_offered_load %.0f", mid);
     if (!*success) {
       LOG(ERROR) << "Client/Server Failure";
       break;
     }
-    if (targeted_cpu_load <= current_cpu_load) {
+    if (targeted_metric <= current_metric) {
       high = mid - absl::GetFlag(FLAGS_stride);
     } else {
       low = mid + absl::GetFlag(FLAGS_stride);
@@ -209,28 +235,28 @@ static double BinarySearch(
 }
 
 static double SearchOfferedLoad(
-    double initial_offered_load, double targeted_cpu_load, Scenario* scenario,
+    double initial_offered_load, double targeted_metric, Scenario* scenario,
     const std::map<std::string, std::string>& per_worker_credential_types,
     bool* success) {
   std::cerr << "RUNNING SCENARIO: " << scenario->name() << "\n";
   double current_offered_load = initial_offered_load;
-  double current_cpu_load = GetCpuLoad(scenario, current_offered_load,
-                                       per_worker_credential_types, success);
-  if (current_cpu_load > targeted_cpu_load) {
+  double current_metric = GetSearchMetric(scenario, current_offered_load,
+                                          per_worker_credential_types, success);
+  if (current_metric > targeted_metric) {
     LOG(ERROR) << "Initial offered load too high";
     return -1;
   }
 
-  while (*success && (current_cpu_load < targeted_cpu_load)) {
+  while (*success && (current_metric < targeted_metric)) {
     current_offered_load *= 2;
-    current_cpu_load = GetCpuLoad(scenario, current_offered_load,
-                                  per_worker_credential_types, success);
+    current_metric = GetSearchMetric(scenario, current_offered_load,
+                                     per_worker_credential_types, success);
     VLOG(2) << absl::StrFormat("Binary Search: current_offered_load %.0f",
                                current_offered_load);
   }
 
   double targeted_offered_load =
-      BinarySearch(scenario, targeted_cpu_load, current_offered_load / 2,
+      BinarySearch(scenario, targeted_metric, current_offered_load / 2,
                    current_offered_load, per_worker_credential_types, success);
 
   return targeted_offered_load;
@@ -284,13 +310,22 @@ static bool QpsDriver() {
     } else {
       if (absl::GetFlag(FLAGS_search_param) == "offered_load") {
         Scenario* scenario = scenarios.mutable_scenarios(i);
+        double targeted_metric;
+        if (absl::GetFlag(FLAGS_search_metric) == "cpu_load") {
+          targeted_metric = absl::GetFlag(FLAGS_targeted_cpu_load);
+        } else if (absl::GetFlag(FLAGS_search_metric) == "p99_latency") {
+          targeted_metric = absl::GetFlag(FLAGS_targeted_p99_latency_us);
+        } else {
+          grpc_core::Crash(absl::StrCat("Unknown search metric: ",
+                                        absl::GetFlag(FLAGS_search_metric)));
+        }
         double targeted_offered_load =
             SearchOfferedLoad(absl::GetFlag(FLAGS_initial_search_value),
-                              absl::GetFlag(FLAGS_targeted_cpu_load), scenario,
+                              targeted_metric, scenario,
                               per_worker_credential_types, &success);
         LOG(INFO) << "targeted_offered_load " << targeted_offered_load;
-        GetCpuLoad(scenario, targeted_offered_load, per_worker_credential_types,
-                   &success);
+        GetSearchMetric(scenario, targeted_offered_load,
+                        per_worker_credential_types, &success);
       } else {
         LOG(ERROR) << "Unimplemented search param";
       }